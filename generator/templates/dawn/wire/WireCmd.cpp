@@ -269,6 +269,12 @@
             {
                 auto memberLength = {{member_length(member, "record.")}};
 
+                {% if member.json_data["wire_is_data_only"] %}
+                    //* Data-only members can be gathered by the serialization buffer instead of
+                    //* copied in it.
+                    {{ assert(member.type.is_wire_transparent) }}
+                    WIRE_TRY(buffer->NextData(memberLength, record.{{memberName}}));
+                {% else %}
                 {{member_transfer_type(member)}}* memberBuffer;
                 WIRE_TRY(buffer->NextN(memberLength, &memberBuffer));
 
@@ -284,6 +290,7 @@
                         {{serialize_member(member, "record." + memberName + "[i]", "memberBuffer[i]" )}}
                     }
                 {% endif %}
+                {% endif %}
             }
         {% endfor %}
         return WireResult::Success;
@@ -437,6 +444,21 @@
         return size;
     }
 
+    size_t {{Cmd}}::GetDataOnlySize() const {
+        size_t size = 0;
+        {% for member in command.members if member.json_data["wire_is_data_only"] %}
+            {% if member.optional %}
+                if ({{as_varName(member.name)}} != nullptr)
+            {% endif %}
+            {
+                auto memberSize = WireAlignSizeofN<{{member_transfer_type(member)}}>({{member_length(member, "")}});
+                ASSERT(memberSize);
+                size += *memberSize;
+            }
+        {% endfor %}
+        return size;
+    }
+
     {% if command.may_have_dawn_object %}
         WireResult {{Cmd}}::Serialize(
             size_t commandSize,
@@ -760,6 +782,16 @@ namespace dawn::wire {
 
     }  // anonymous namespace
 
+    const char* WireCmdAsString(WireCmd cmd) {
+        switch (cmd) {
+            {% for command in cmd_records["command"] %}
+                case WireCmd::{{command.name.CamelCase()}}:
+                    return "{{command.name.CamelCase()}}";
+            {% endfor %}
+        }
+        return nullptr;
+    }
+
     {% for command in cmd_records["command"] %}
         {{ write_command_serialization_methods(command, False) }}
     {% endfor %}
@@ -68,6 +68,9 @@ namespace dawn::wire {
         uint64_t commandSize;
     };
 
+    //* Returns the name of the command, or nullptr if it isn't a valid command.
+    const char* WireCmdAsString(WireCmd cmd);
+
 {% macro write_command_struct(command, is_return_command) %}
     {% set Return = "Return" if is_return_command else "" %}
     {% set Cmd = command.name.CamelCase() + "Cmd" %}
@@ -75,6 +78,10 @@ namespace dawn::wire {
         //* From a filled structure, compute how much size will be used in the serialization buffer.
         size_t GetRequiredSize() const;
 
+        //* The part of GetRequiredSize used by data-only members, which the serialization buffer
+        //* can gather from the structure instead of copying.
+        size_t GetDataOnlySize() const;
+
         //* Serialize the structure and everything it points to into serializeBuffer which must be
         //* big enough to contain all the data (as queried from GetRequiredSize).
         WireResult Serialize(size_t commandSize, SerializeBuffer* serializeBuffer, const ObjectIdProvider& objectIdProvider) const;
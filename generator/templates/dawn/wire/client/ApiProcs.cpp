@@ -68,6 +68,11 @@ namespace dawn::wire::client {
                         cmd.{{as_varName(arg.name)}} = {{as_varName(arg.name)}};
                     {% endfor %}
 
+                    //* Send the commands packed before this one first to keep them in order.
+                    {% if Type in client_packed_command_objects %}
+                        self->FlushPackedCommands();
+                    {% endif %}
+
                     //* Allocate space to send the command and copy the value args over.
                     self->GetClient()->SerializeCommand(cmd);
 
@@ -90,6 +95,9 @@ namespace dawn::wire::client {
             if (!obj->Release()) {
                 return;
             }
+            {% if Type in client_packed_command_objects %}
+                obj->FlushPackedCommands();
+            {% endif %}
 
             DestroyObjectCmd cmd;
             cmd.objectType = ObjectType::{{type.name.CamelCase()}};
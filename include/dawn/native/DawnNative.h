@@ -145,6 +145,19 @@ struct DAWN_NATIVE_EXPORT AdapterDiscoveryOptionsBase {
 
 enum BackendValidationLevel { Full, Partial, Disabled };
 
+// Statistics of the in-memory cache that an instance keeps in front of the platform's
+// CachingInterface.
+struct BlobCacheStats {
+    // Loads served from memory.
+    uint64_t hitCount = 0;
+    // Loads that had to go to the CachingInterface.
+    uint64_t missCount = 0;
+    // Entries dropped to stay within the memory budget.
+    uint64_t evictionCount = 0;
+    size_t entryCount = 0;
+    size_t memoryUsage = 0;
+};
+
 // Represents a connection to dawn_native and is used for dependency injection, discovering
 // system adapters and injecting custom adapters (like a Swiftshader Vulkan adapter).
 //
@@ -187,6 +200,8 @@ class DAWN_NATIVE_EXPORT Instance {
 
     uint64_t GetDeviceCountForTesting() const;
 
+    BlobCacheStats GetBlobCacheStats() const;
+
     // Returns the underlying WGPUInstance object.
     WGPUInstance Get() const;
 
@@ -200,6 +215,11 @@ DAWN_NATIVE_EXPORT const DawnProcTable& GetProcs();
 // Query the names of all the toggles that are enabled in device
 DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 
+// Returns the statistics of the shader modules and shader compilations of the device as a JSON
+// object, or an empty string if the device wasn't created with the
+// "record_shader_compilation_statistics" toggle. Only the most recent entries are kept.
+DAWN_NATIVE_EXPORT std::string GetShaderCompilationStatisticsJSON(WGPUDevice device);
+
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
@@ -225,6 +245,57 @@ DAWN_NATIVE_EXPORT bool DeviceTick(WGPUDevice device);
 
 DAWN_NATIVE_EXPORT bool InstanceProcessEvents(WGPUInstance instance);
 
+// Futures let threads block until asynchronous operations complete instead of polling
+// InstanceProcessEvents. The *F variants of the asynchronous methods behave like the methods of the
+// proc table, and also return a future that completes once their callback has been called. The
+// callbacks are still called from InstanceProcessEvents or DeviceTick, and from InstanceWaitAny.
+// Futures are never 0.
+enum class WaitStatus {
+    // At least one of the futures completed.
+    Success,
+    // None of the futures completed before the timeout.
+    TimedOut,
+    // One of the futures wasn't returned by this instance.
+    UnknownFuture,
+};
+
+struct FutureWaitInfo {
+    uint64_t future;
+    // Set by InstanceWaitAny when the future completed.
+    bool completed = false;
+};
+
+DAWN_NATIVE_EXPORT uint64_t BufferMapAsyncF(WGPUBuffer buffer,
+                                            WGPUMapModeFlags mode,
+                                            size_t offset,
+                                            size_t size,
+                                            WGPUBufferMapCallback callback,
+                                            void* userdata);
+DAWN_NATIVE_EXPORT uint64_t QueueOnSubmittedWorkDoneF(WGPUQueue queue,
+                                                      uint64_t signalValue,
+                                                      WGPUQueueWorkDoneCallback callback,
+                                                      void* userdata);
+DAWN_NATIVE_EXPORT uint64_t
+DeviceCreateComputePipelineAsyncF(WGPUDevice device,
+                                  const WGPUComputePipelineDescriptor* descriptor,
+                                  WGPUCreateComputePipelineAsyncCallback callback,
+                                  void* userdata);
+DAWN_NATIVE_EXPORT uint64_t
+DeviceCreateRenderPipelineAsyncF(WGPUDevice device,
+                                 const WGPURenderPipelineDescriptor* descriptor,
+                                 WGPUCreateRenderPipelineAsyncCallback callback,
+                                 void* userdata);
+
+// Blocks until at least one of |futures| completes or |timeoutNS| nanoseconds pass, while
+// processing the events of the instance. Sets |completed| for each of the futures that completed.
+// The thread sleeps on a condition variable that is signaled when a callback is ready, for example
+// when a worker thread finishes creating a pipeline. When only the GPU can complete the futures,
+// like for BufferMapAsyncF and QueueOnSubmittedWorkDoneF, it blocks on the fences of the device.
+DAWN_NATIVE_EXPORT WaitStatus InstanceWaitAny(WGPUInstance instance,
+                                              size_t futureCount,
+                                              FutureWaitInfo* futures,
+                                              uint64_t timeoutNS);
+
 // ErrorInjector functions used for testing only. Defined in dawn_native/ErrorInjector.cpp
 DAWN_NATIVE_EXPORT void EnableErrorInjector();
 DAWN_NATIVE_EXPORT void DisableErrorInjector();
@@ -97,6 +97,11 @@ class DAWN_PLATFORM_EXPORT Platform {
     // cache objects.
     virtual CachingInterface* GetCachingInterface();
 
+    // The size in bytes of the in-memory cache Dawn keeps in front of the CachingInterface so that
+    // frequently used entries don't need to be loaded from it again. 0 disables the in-memory
+    // cache.
+    virtual size_t GetCachingMemoryBudget();
+
     virtual std::unique_ptr<WorkerTaskPool> CreateWorkerTaskPool();
 
   private:
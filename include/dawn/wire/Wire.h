@@ -50,6 +50,21 @@ class DAWN_WIRE_EXPORT CommandHandler {
     virtual const volatile char* HandleCommands(const volatile char* commands, size_t size) = 0;
 };
 
+// Description of a serialized client command, for tools inspecting streams of commands.
+struct CommandInfo {
+    // The serialized size of the command, including its header. It can be larger than the
+    // stream when the command is split in chunks.
+    uint64_t size = 0;
+    // The name of the command, or nullptr if it isn't a valid command.
+    const char* name = nullptr;
+};
+
+// Describes the first command of a stream of client commands. Returns false if the stream is too
+// small to contain the header of a command.
+DAWN_WIRE_EXPORT bool GetClientCommandInfo(const volatile char* commands,
+                                           size_t size,
+                                           CommandInfo* info);
+
 }  // namespace dawn::wire
 
 // TODO(dawn:824): Remove once the deprecation period is passed.
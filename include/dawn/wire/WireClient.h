@@ -172,6 +172,14 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
     MemoryTransferService& operator=(const MemoryTransferService&) = delete;
 };
 
+// Creates a MemoryTransferService that shares the mapped data of buffers with the server in
+// memfd shared memory, instead of copying it in the commands. The file descriptors of the shared
+// memory are sent on |socket|, a connected AF_UNIX SOCK_SEQPACKET or SOCK_DGRAM socket whose peer
+// is given to server::CreateSharedMemoryTransferService. Ownership of |socket| is taken even on
+// failure. Returns nullptr if shared memory isn't supported.
+DAWN_WIRE_EXPORT std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    int socket);
+
 // Backdoor to get the order of the ProcMap for testing
 DAWN_WIRE_EXPORT std::vector<const char*> GetProcMapNamesForTesting();
 }  // namespace client
@@ -147,6 +147,12 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
     MemoryTransferService(const MemoryTransferService&) = delete;
     MemoryTransferService& operator=(const MemoryTransferService&) = delete;
 };
+
+// Creates the MemoryTransferService for clients using client::CreateSharedMemoryTransferService.
+// The file descriptors of the shared memory are received on |socket|, the peer of the socket given
+// to the client, and the commands only reference them by id. Ownership of |socket| is taken.
+DAWN_WIRE_EXPORT std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    int socket);
 }  // namespace server
 
 }  // namespace dawn::wire
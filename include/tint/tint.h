@@ -38,6 +38,7 @@
 #include "src/tint/writer/binding_remapper_options.h"
 #include "src/tint/writer/external_texture_options.h"
 #include "src/tint/writer/flatten_bindings.h"
+#include "src/tint/writer/generate_entry_points.h"
 #include "src/tint/writer/writer.h"
 
 #if TINT_BUILD_SPV_READER
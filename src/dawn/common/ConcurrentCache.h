@@ -15,40 +15,132 @@
 #ifndef SRC_DAWN_COMMON_CONCURRENTCACHE_H_
 #define SRC_DAWN_COMMON_CONCURRENTCACHE_H_
 
+#include <array>
+#include <cstdint>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_set>
 #include <utility>
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/RefCounted.h"
 
+// An unordered_set of pointers to objects compared by value, that can be used from multiple
+// threads.
+//
+// The set is split in shards selected by the hash of the objects, each with its own reader-writer
+// lock. Lookups only take a shared lock on a single shard so that concurrent lookups of existing
+// objects, which is the common case for object deduplication, never block each other. Insertions
+// and erasures take the exclusive lock of their shard only.
+//
+// When the cached objects are RefCounted and remove themselves from the cache on destruction, the
+// *AndReference methods should be used to look them up: they only return objects that could be
+// referenced, so that an object whose last reference was just removed is never resurrected.
 template <typename T>
 class ConcurrentCache : public NonMovable {
   public:
     ConcurrentCache() = default;
 
     T* Find(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto iter = mCache.find(object);
-        if (iter == mCache.end()) {
+        Shard& shard = GetShard(object);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.cache.find(object);
+        if (iter == shard.cache.end()) {
             return nullptr;
         }
         return *iter;
     }
 
     std::pair<T*, bool> Insert(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto [value, inserted] = mCache.insert(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::shared_mutex> lock(shard.mutex);
+        auto [value, inserted] = shard.cache.insert(object);
         return {*value, inserted};
     }
 
+    // Returns a new reference to the cached object equal to |blueprint|, or nullptr if there is
+    // none or if it is being destroyed. |RefCountedT| is the type of the cached objects, which
+    // may derive from the blueprint type T.
+    template <typename RefCountedT = T>
+    Ref<RefCountedT> FindAndReference(T* blueprint) {
+        Shard& shard = GetShard(blueprint);
+        // TryReference is atomic so it is safe to call with only the shared lock. Objects are
+        // erased with the exclusive lock, so the found object isn't deleted before it returns.
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.cache.find(blueprint);
+        if (iter == shard.cache.end()) {
+            return nullptr;
+        }
+        RefCountedT* cached = static_cast<RefCountedT*>(*iter);
+        if (!cached->TryReference()) {
+            return nullptr;
+        }
+        return AcquireRef(cached);
+    }
+
+    // Inserts |object| unless an equal object that can be referenced is already cached, in which
+    // case a new reference to the cached object is returned instead. An equal object that is being
+    // destroyed is replaced by |object|; its own Erase will then be a no-op.
+    template <typename RefCountedT>
+    std::pair<Ref<RefCountedT>, bool> InsertAndReference(RefCountedT* object) {
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::shared_mutex> lock(shard.mutex);
+        auto [iter, inserted] = shard.cache.insert(object);
+        if (inserted) {
+            return {object, true};
+        }
+
+        RefCountedT* cached = static_cast<RefCountedT*>(*iter);
+        if (cached->TryReference()) {
+            return {AcquireRef(cached), false};
+        }
+        shard.cache.erase(iter);
+        shard.cache.insert(object);
+        return {object, true};
+    }
+
+    // Erases |object| itself, but not other objects equal to it. Returns the number of objects
+    // erased.
     size_t Erase(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.erase(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.cache.find(object);
+        if (iter == shard.cache.end() || *iter != object) {
+            return 0;
+        }
+        shard.cache.erase(iter);
+        return 1;
+    }
+
+    bool Empty() {
+        for (Shard& shard : mShards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            if (!shard.cache.empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 
   private:
-    std::mutex mMutex;
-    std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> mCache;
+    static constexpr size_t kShardCountLog2 = 4;
+    static constexpr size_t kShardCount = size_t(1) << kShardCountLog2;
+
+    // Shards are aligned to separate cache lines so that threads using different shards don't
+    // contend on the memory of their locks.
+    struct alignas(64) Shard {
+        std::shared_mutex mutex;
+        std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> cache;
+    };
+
+    Shard& GetShard(const T* object) {
+        // The low bits of the hash also select the bucket inside the shard, so the shard is chosen
+        // from the high bits of the hash after mixing it with a multiplicative hash.
+        uint64_t hash = static_cast<uint64_t>(typename T::HashFunc()(object));
+        return mShards[(hash * 0x9E3779B97F4A7C15ull) >> (64 - kShardCountLog2)];
+    }
+
+    std::array<Shard, kShardCount> mShards;
 };
 
 #endif  // SRC_DAWN_COMMON_CONCURRENTCACHE_H_
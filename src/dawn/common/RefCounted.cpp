@@ -54,6 +54,19 @@ void RefCount::Increment() {
     mRefCount.fetch_add(kRefCountIncrement, std::memory_order_relaxed);
 }
 
+bool RefCount::TryIncrement() {
+    uint64_t current = mRefCount.load(std::memory_order_relaxed);
+    do {
+        if ((current & ~kPayloadMask) == 0) {
+            return false;
+        }
+        // Like in Increment, the relaxed ordering is enough since the reference is only acquired
+        // while the object is still alive.
+    } while (!mRefCount.compare_exchange_weak(current, current + kRefCountIncrement,
+                                              std::memory_order_relaxed));
+    return true;
+}
+
 bool RefCount::Decrement() {
     ASSERT((mRefCount & ~kPayloadMask) != 0);
 
@@ -102,6 +115,10 @@ void RefCounted::Reference() {
     mRefCount.Increment();
 }
 
+bool RefCounted::TryReference() {
+    return mRefCount.TryIncrement();
+}
+
 void RefCounted::Release() {
     if (mRefCount.Decrement()) {
         DeleteThis();
@@ -31,6 +31,12 @@ class RefCount {
     // Add a reference.
     void Increment();
 
+    // Add a reference only if there is at least one other. Returns false if the last reference was
+    // already removed, in which case the object must not be used anymore. This makes it possible
+    // to acquire references to objects found in containers of weak pointers that are only erased
+    // on destruction.
+    bool TryIncrement();
+
     // Remove a reference. Returns true if this was the last reference.
     bool Decrement();
 
@@ -46,6 +52,8 @@ class RefCounted {
     uint64_t GetRefCountPayload() const;
 
     void Reference();
+    // Adds a reference unless the object is already being destroyed. See RefCount::TryIncrement.
+    [[nodiscard]] bool TryReference();
     // Release() is called by internal code, so it's assumed that there is already a thread
     // synchronization in place for destruction.
     void Release();
@@ -0,0 +1,160 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/common/Sha256.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace dawn {
+
+namespace {
+
+constexpr std::array<uint32_t, 64> kRoundConstants = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+constexpr uint32_t RotateRight(uint32_t value, uint32_t bits) {
+    return (value >> bits) | (value << (32 - bits));
+}
+
+}  // anonymous namespace
+
+Sha256::Sha256()
+    : mState({0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab,
+              0x5be0cd19}) {}
+
+void Sha256::Update(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    mTotalSize += size;
+
+    // Complete the partially filled block first.
+    if (mBufferSize > 0) {
+        size_t copySize = std::min(size, kBlockSize - mBufferSize);
+        memcpy(mBuffer.data() + mBufferSize, bytes, copySize);
+        mBufferSize += copySize;
+        bytes += copySize;
+        size -= copySize;
+
+        if (mBufferSize < kBlockSize) {
+            return;
+        }
+        ProcessBlock(mBuffer.data());
+        mBufferSize = 0;
+    }
+
+    // Process full blocks directly from the input.
+    while (size >= kBlockSize) {
+        ProcessBlock(bytes);
+        bytes += kBlockSize;
+        size -= kBlockSize;
+    }
+
+    if (size > 0) {
+        memcpy(mBuffer.data(), bytes, size);
+        mBufferSize = size;
+    }
+}
+
+Sha256::Digest Sha256::Finalize() {
+    uint64_t totalBits = mTotalSize * 8;
+
+    // Pad with a single 1 bit, then zeroes until there are 8 bytes left in the block for the
+    // big-endian message length.
+    mBuffer[mBufferSize++] = 0x80;
+    if (mBufferSize > kBlockSize - 8) {
+        std::fill(mBuffer.begin() + mBufferSize, mBuffer.end(), 0);
+        ProcessBlock(mBuffer.data());
+        mBufferSize = 0;
+    }
+    std::fill(mBuffer.begin() + mBufferSize, mBuffer.end() - 8, 0);
+    for (size_t i = 0; i < 8; ++i) {
+        mBuffer[kBlockSize - 1 - i] = static_cast<uint8_t>(totalBits >> (8 * i));
+    }
+    ProcessBlock(mBuffer.data());
+
+    Digest digest;
+    for (size_t i = 0; i < mState.size(); ++i) {
+        digest[4 * i + 0] = static_cast<uint8_t>(mState[i] >> 24);
+        digest[4 * i + 1] = static_cast<uint8_t>(mState[i] >> 16);
+        digest[4 * i + 2] = static_cast<uint8_t>(mState[i] >> 8);
+        digest[4 * i + 3] = static_cast<uint8_t>(mState[i]);
+    }
+    return digest;
+}
+
+// static
+Sha256::Digest Sha256::Hash(const void* data, size_t size) {
+    Sha256 sha;
+    sha.Update(data, size);
+    return sha.Finalize();
+}
+
+void Sha256::ProcessBlock(const uint8_t* block) {
+    std::array<uint32_t, 64> w;
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+               (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        uint32_t s0 = RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = mState[0];
+    uint32_t b = mState[1];
+    uint32_t c = mState[2];
+    uint32_t d = mState[3];
+    uint32_t e = mState[4];
+    uint32_t f = mState[5];
+    uint32_t g = mState[6];
+    uint32_t h = mState[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t temp1 = h + s1 + ch + kRoundConstants[i] + w[i];
+        uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t temp2 = s0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    mState[0] += a;
+    mState[1] += b;
+    mState[2] += c;
+    mState[3] += d;
+    mState[4] += e;
+    mState[5] += f;
+    mState[6] += g;
+    mState[7] += h;
+}
+
+}  // namespace dawn
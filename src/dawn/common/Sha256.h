@@ -0,0 +1,54 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_COMMON_SHA256_H_
+#define SRC_DAWN_COMMON_SHA256_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace dawn {
+
+// An incremental implementation of the SHA-256 hash function (FIPS 180-4). It is used where a
+// fixed-size digest must identify arbitrarily large contents, for example in persistent cache keys.
+class Sha256 {
+  public:
+    static constexpr size_t kDigestSize = 32;
+    using Digest = std::array<uint8_t, kDigestSize>;
+
+    Sha256();
+
+    void Update(const void* data, size_t size);
+
+    // Returns the digest of all the data passed to Update. The object must not be used afterwards.
+    Digest Finalize();
+
+    // Returns the digest of |data| in a single call.
+    static Digest Hash(const void* data, size_t size);
+
+  private:
+    static constexpr size_t kBlockSize = 64;
+
+    void ProcessBlock(const uint8_t* block);
+
+    std::array<uint32_t, 8> mState;
+    std::array<uint8_t, kBlockSize> mBuffer;
+    size_t mBufferSize = 0;
+    uint64_t mTotalSize = 0;
+};
+
+}  // namespace dawn
+
+#endif  // SRC_DAWN_COMMON_SHA256_H_
@@ -0,0 +1,145 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_COMMON_SINGLEFLIGHTCACHE_H_
+#define SRC_DAWN_COMMON_SINGLEFLIGHTCACHE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/NonCopyable.h"
+
+// A thread-safe cache of expensive-to-create values where concurrent requests for the same key
+// are coalesced: the first thread to miss on a key becomes responsible for creating the value and
+// the other threads asking for that key wait for it instead of creating the value again.
+//
+// Usage:
+//     const Value* value = cache.Acquire(key);
+//     if (value == nullptr) {
+//         // This thread must create the value. On failure, call Abandon(key) instead so that
+//         // one of the waiting threads takes over.
+//         value = cache.Complete(key, CreateValue());
+//     }
+//
+// Values are never removed from the cache so the returned pointers stay valid for the lifetime
+// of the cache.
+template <typename Key,
+          typename Value,
+          typename HashFunc = std::hash<Key>,
+          typename EqualityFunc = std::equal_to<Key>>
+class SingleFlightCache : public NonMovable {
+  public:
+    struct Stats {
+        // Number of Acquire calls that found the value already created.
+        uint64_t hits = 0;
+        // Number of Acquire calls that made the caller responsible for creating the value.
+        uint64_t misses = 0;
+        // Number of Acquire calls that waited for another thread to create the value.
+        uint64_t coalescedWaits = 0;
+    };
+
+    SingleFlightCache() = default;
+
+    // Returns the value for |key|, waiting for it if it is being created by another thread.
+    // Returns nullptr if the caller must create the value and call either Complete or Abandon.
+    const Value* Acquire(const Key& key) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        bool waited = false;
+        while (true) {
+            auto [iter, inserted] = mEntries.try_emplace(key);
+            if (inserted) {
+                mMisses.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            if (iter->second.has_value()) {
+                if (waited) {
+                    mCoalescedWaits.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    mHits.fetch_add(1, std::memory_order_relaxed);
+                }
+                return &*iter->second;
+            }
+
+            // The value is in flight, wait until it is completed or abandoned. If it is abandoned
+            // the entry is gone and the loop makes one of the waiters create it.
+            waited = true;
+            mCondition.wait(lock);
+        }
+    }
+
+    // Stores |value| as the result for |key|, which must have been acquired by the caller, and
+    // wakes up the threads waiting for it.
+    const Value* Complete(const Key& key, Value value) {
+        const Value* result = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = mEntries.find(key);
+            ASSERT(iter != mEntries.end() && !iter->second.has_value());
+            iter->second.emplace(std::move(value));
+            result = &*iter->second;
+        }
+        mCondition.notify_all();
+        return result;
+    }
+
+    // Gives up on creating the value for |key|, which must have been acquired by the caller.
+    void Abandon(const Key& key) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = mEntries.find(key);
+            ASSERT(iter != mEntries.end() && !iter->second.has_value());
+            mEntries.erase(iter);
+        }
+        mCondition.notify_all();
+    }
+
+    // Calls |f| on all the created values. Must not be called concurrently with Complete.
+    template <typename F>
+    void ForEachValue(F&& f) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto& [_, value] : mEntries) {
+            if (value.has_value()) {
+                f(*value);
+            }
+        }
+    }
+
+    Stats GetStats() const {
+        Stats stats;
+        stats.hits = mHits.load(std::memory_order_relaxed);
+        stats.misses = mMisses.load(std::memory_order_relaxed);
+        stats.coalescedWaits = mCoalescedWaits.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    // An entry without a value is being created by the thread that inserted it. Pointers to
+    // values in an unordered_map are stable when it rehashes.
+    std::unordered_map<Key, std::optional<Value>, HashFunc, EqualityFunc> mEntries;
+
+    std::atomic<uint64_t> mHits{0};
+    std::atomic<uint64_t> mMisses{0};
+    std::atomic<uint64_t> mCoalescedWaits{0};
+};
+
+#endif  // SRC_DAWN_COMMON_SINGLEFLIGHTCACHE_H_
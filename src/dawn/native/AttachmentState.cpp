@@ -134,7 +134,10 @@ AttachmentState::AttachmentState(DeviceBase* device, const AttachmentStateBluepr
     : AttachmentStateBlueprint(blueprint), ObjectBase(device) {}
 
 AttachmentState::~AttachmentState() {
-    GetDevice()->UncacheAttachmentState(this);
+    // An AttachmentState that lost the race to be inserted in the cache was never cached.
+    if (IsCachedReference()) {
+        GetDevice()->UncacheAttachmentState(this);
+    }
 }
 
 size_t AttachmentState::ComputeContentHash() {
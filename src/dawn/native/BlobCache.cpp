@@ -15,6 +15,10 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Version_autogen.h"
@@ -24,12 +28,65 @@
 
 namespace dawn::native {
 
-BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface)
-    : mCache(cachingInterface) {}
+namespace {
+
+size_t HashCacheKey(const CacheKey& key) {
+    return std::hash<std::string_view>()(
+        std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+}
+
+}  // anonymous namespace
+
+BlobCache::CachedBlob::CachedBlob(Blob blob) : mBlob(std::move(blob)) {}
+
+BlobCache::CachedBlob::~CachedBlob() = default;
+
+const Blob& BlobCache::CachedBlob::Get() const {
+    return mBlob;
+}
+
+BlobCache::BlobCache(dawn::platform::CachingInterface* cachingInterface, size_t memoryBudget)
+    : mCache(cachingInterface),
+      // The in-memory cache only fronts the CachingInterface.
+      mStripeMemoryBudget(cachingInterface != nullptr ? memoryBudget / kStripeCount : 0) {}
+
+BlobCache::~BlobCache() = default;
 
 Blob BlobCache::Load(const CacheKey& key) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    return LoadInternal(key);
+    ASSERT(ValidateCacheKey(key));
+    if (mCache == nullptr) {
+        return Blob();
+    }
+
+    Ref<CachedBlob> cached;
+    size_t hash = HashCacheKey(key);
+    if (mStripeMemoryBudget > 0) {
+        Stripe& stripe = GetStripe(hash);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        cached = FindInMemory(&stripe, hash, key);
+        if (cached == nullptr) {
+            stripe.missCount++;
+        } else {
+            stripe.hitCount++;
+        }
+    }
+
+    if (cached == nullptr) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        Blob blob = LoadInternal(key);
+        if (blob.Empty() || blob.Size() > mStripeMemoryBudget) {
+            return blob;
+        }
+        cached = AcquireRef(new CachedBlob(std::move(blob)));
+        // Added while |mMutex| is held so that it cannot race with a Store of the same key.
+        SetInMemory(hash, key, cached);
+    }
+
+    // Return a view of the cached data that keeps it alive.
+    const Blob& blob = cached->Get();
+    uint8_t* data = const_cast<uint8_t*>(blob.Data());
+    size_t size = blob.Size();
+    return Blob::UnsafeCreateWithDeleter(data, size, [cached = std::move(cached)]() {});
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
@@ -41,6 +98,72 @@ void BlobCache::Store(const CacheKey& key, const Blob& value) {
     Store(key, value.Size(), value.Data());
 }
 
+BlobCacheStats BlobCache::GetStats() {
+    BlobCacheStats stats;
+    for (Stripe& stripe : mStripes) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stats.hitCount += stripe.hitCount;
+        stats.missCount += stripe.missCount;
+        stats.evictionCount += stripe.evictionCount;
+        stats.entryCount += stripe.entries.size();
+        stats.memoryUsage += stripe.memoryUsage;
+    }
+    return stats;
+}
+
+Ref<BlobCache::CachedBlob> BlobCache::FindInMemory(Stripe* stripe,
+                                                   size_t hash,
+                                                   const CacheKey& key) {
+    auto it = stripe->entries.find(hash);
+    if (it == stripe->entries.end()) {
+        return nullptr;
+    }
+    // Entries are only indexed by hash, check that it isn't a collision.
+    const std::vector<uint8_t>& entryKey = it->second->key;
+    if (entryKey.size() != key.size() ||
+        !std::equal(entryKey.begin(), entryKey.end(), key.begin())) {
+        return nullptr;
+    }
+    stripe->lru.splice(stripe->lru.begin(), stripe->lru, it->second);
+    return it->second->value;
+}
+
+void BlobCache::SetInMemory(size_t hash, const CacheKey& key, Ref<CachedBlob> value) {
+    Stripe& stripe = GetStripe(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    // Drop the previous entry with the same hash, whether it is for this key or a collision.
+    auto previous = stripe.entries.find(hash);
+    if (previous != stripe.entries.end()) {
+        RemoveFromMemory(&stripe, previous->second);
+    }
+    if (value == nullptr) {
+        return;
+    }
+
+    ASSERT(value->Get().Size() <= mStripeMemoryBudget);
+    stripe.memoryUsage += value->Get().Size();
+    while (stripe.memoryUsage > mStripeMemoryBudget) {
+        ASSERT(!stripe.lru.empty());
+        RemoveFromMemory(&stripe, std::prev(stripe.lru.end()));
+        stripe.evictionCount++;
+    }
+
+    stripe.lru.push_front({hash, std::vector<uint8_t>(key.begin(), key.end()), std::move(value)});
+    stripe.entries.emplace(hash, stripe.lru.begin());
+}
+
+void BlobCache::RemoveFromMemory(Stripe* stripe, std::list<Entry>::iterator it) {
+    stripe->memoryUsage -= it->value->Get().Size();
+    stripe->entries.erase(it->hash);
+    stripe->lru.erase(it);
+}
+
+BlobCache::Stripe& BlobCache::GetStripe(size_t hash) {
+    // Use the high bits so that the stripe is independent of the hash map's bucket.
+    return mStripes[(hash >> (sizeof(size_t) * 8 - 4)) % kStripeCount];
+}
+
 Blob BlobCache::LoadInternal(const CacheKey& key) {
     ASSERT(ValidateCacheKey(key));
     if (mCache == nullptr) {
@@ -66,6 +189,18 @@ void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void*
         return;
     }
     mCache->StoreData(key.data(), key.size(), value, valueSize);
+
+    if (mStripeMemoryBudget == 0) {
+        return;
+    }
+    // Values too large for the in-memory cache still replace any previous entry for the key.
+    Ref<CachedBlob> cached;
+    if (valueSize <= mStripeMemoryBudget) {
+        Blob blob = CreateBlob(valueSize);
+        memcpy(blob.Data(), value, valueSize);
+        cached = AcquireRef(new CachedBlob(std::move(blob)));
+    }
+    SetInMemory(HashCacheKey(key), key, std::move(cached));
 }
 
 bool BlobCache::ValidateCacheKey(const CacheKey& key) {
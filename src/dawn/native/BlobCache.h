@@ -15,11 +15,17 @@
 #ifndef SRC_DAWN_NATIVE_BLOBCACHE_H_
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
+#include <array>
+#include <list>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "dawn/common/Platform.h"
+#include "dawn/common/RefCounted.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
+#include "dawn/native/DawnNative.h"
 
 namespace dawn::platform {
 class CachingInterface;
@@ -32,11 +38,19 @@ class InstanceBase;
 
 // This class should always be thread-safe because it may be called asynchronously. Its purpose
 // is to wrap the CachingInterface provided via a platform.
+//
+// Entries loaded from or stored to the CachingInterface are also kept in an in-memory LRU cache,
+// up to |memoryBudget| bytes, so that frequently used entries are returned without going through
+// the CachingInterface again. The in-memory cache is split in stripes, each with its own lock
+// and a share of the budget, so that concurrent loads of different keys rarely contend.
 class BlobCache {
   public:
-    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr);
+    explicit BlobCache(dawn::platform::CachingInterface* cachingInterface = nullptr,
+                       size_t memoryBudget = 0);
+    ~BlobCache();
 
-    // Returns empty blob if the key is not found in the cache.
+    // Returns empty blob if the key is not found in the cache. Blobs returned from the in-memory
+    // cache share their data with it and must not be written to.
     Blob Load(const CacheKey& key);
 
     // Value to store must be non-empty/non-null.
@@ -52,7 +66,50 @@ class BlobCache {
         }
     }
 
+    BlobCacheStats GetStats();
+
   private:
+    // A blob kept in the in-memory cache. Blobs returned by Load hold a reference to it instead of
+    // copying its data.
+    class CachedBlob : public RefCounted {
+      public:
+        explicit CachedBlob(Blob blob);
+        ~CachedBlob() override;
+
+        const Blob& Get() const;
+
+      private:
+        Blob mBlob;
+    };
+
+    struct Entry {
+        size_t hash;
+        std::vector<uint8_t> key;
+        Ref<CachedBlob> value;
+    };
+
+    // Entries are ordered from the most recently used to the least recently used.
+    struct Stripe {
+        std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<size_t, std::list<Entry>::iterator> entries;
+        size_t memoryUsage = 0;
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+    };
+    static constexpr size_t kStripeCount = 16;
+
+    // Returns the in-memory entry for |key| or nullptr if there is none, marking it as the most
+    // recently used. Must be entered with |stripe.mutex| held.
+    Ref<CachedBlob> FindInMemory(Stripe* stripe, size_t hash, const CacheKey& key);
+    // Sets |value| for |key| in the in-memory cache, replacing any previous entry and evicting the
+    // least recently used entries as needed to stay within the stripe's budget. A null |value|
+    // only removes the previous entry.
+    void SetInMemory(size_t hash, const CacheKey& key, Ref<CachedBlob> value);
+    void RemoveFromMemory(Stripe* stripe, std::list<Entry>::iterator it);
+    Stripe& GetStripe(size_t hash);
+
     // Non-thread safe internal implementations of load and store. Exposed callers that use
     // these helpers need to make sure that these are entered with `mMutex` held.
     Blob LoadInternal(const CacheKey& key);
@@ -65,6 +122,9 @@ class BlobCache {
     // Protects thread safety of access to mCache.
     std::mutex mMutex;
     dawn::platform::CachingInterface* mCache;
+
+    const size_t mStripeMemoryBudget;
+    std::array<Stripe, kStripeCount> mStripes;
 };
 
 }  // namespace dawn::native
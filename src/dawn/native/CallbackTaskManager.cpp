@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/native/EventManager.h"
 
 namespace dawn::native {
 
@@ -62,7 +63,8 @@ void CallbackTask::OnDeviceLoss() {
     mState = State::HandleDeviceLoss;
 }
 
-CallbackTaskManager::CallbackTaskManager() = default;
+CallbackTaskManager::CallbackTaskManager(Ref<EventManager> eventManager)
+    : mEventManager(std::move(eventManager)) {}
 
 CallbackTaskManager::~CallbackTaskManager() = default;
 
@@ -80,8 +82,13 @@ std::vector<std::unique_ptr<CallbackTask>> CallbackTaskManager::AcquireCallbackT
 }
 
 void CallbackTaskManager::AddCallbackTask(std::unique_ptr<CallbackTask> callbackTask) {
-    std::lock_guard<std::mutex> lock(mCallbackTaskQueueMutex);
-    mCallbackTaskQueue.push_back(std::move(callbackTask));
+    {
+        std::lock_guard<std::mutex> lock(mCallbackTaskQueueMutex);
+        mCallbackTaskQueue.push_back(std::move(callbackTask));
+    }
+    if (mEventManager != nullptr) {
+        mEventManager->NotifyWaiters();
+    }
 }
 
 void CallbackTaskManager::AddCallbackTask(std::function<void()> callback) {
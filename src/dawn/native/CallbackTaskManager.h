@@ -25,6 +25,8 @@
 
 namespace dawn::native {
 
+class EventManager;
+
 struct CallbackTask {
   public:
     virtual ~CallbackTask() = default;
@@ -50,7 +52,9 @@ struct CallbackTask {
 
 class CallbackTaskManager : public RefCounted {
   public:
-    CallbackTaskManager();
+    // |eventManager| is notified when callback tasks are added so that threads waiting for futures
+    // can process them.
+    explicit CallbackTaskManager(Ref<EventManager> eventManager = nullptr);
     ~CallbackTaskManager() override;
 
     void AddCallbackTask(std::unique_ptr<CallbackTask> callbackTask);
@@ -69,6 +73,8 @@ class CallbackTaskManager : public RefCounted {
   private:
     std::vector<std::unique_ptr<CallbackTask>> AcquireCallbackTasks();
 
+    Ref<EventManager> mEventManager;
+
     std::mutex mCallbackTaskQueueMutex;
     std::vector<std::unique_ptr<CallbackTask>> mCallbackTaskQueue;
 };
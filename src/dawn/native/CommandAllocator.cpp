@@ -24,6 +24,75 @@
 
 namespace dawn::native {
 
+namespace {
+
+void FreeBlock(const BlockDef& block) {
+    if (block.pool != nullptr) {
+        block.pool->Deallocate(block.block, block.size);
+    } else {
+        free(block.block);
+    }
+}
+
+}  // anonymous namespace
+
+// CommandBlockPool
+
+CommandBlockPool::CommandBlockPool(size_t maxCachedSize) : mMaxCachedSize(maxCachedSize) {}
+
+CommandBlockPool::~CommandBlockPool() {
+    for (std::vector<uint8_t*>& blocks : mFreeBlocks) {
+        for (uint8_t* block : blocks) {
+            free(block);
+        }
+    }
+}
+
+// static
+size_t CommandBlockPool::GetBlockSize(size_t minimumSize) {
+    if (minimumSize > kMaxBlockSize) {
+        return minimumSize;
+    }
+    return std::max(kMinBlockSize, static_cast<size_t>(NextPowerOfTwo(minimumSize)));
+}
+
+// static
+size_t CommandBlockPool::GetSizeClass(size_t size) {
+    ASSERT(IsPowerOfTwo(size) && size >= kMinBlockSize && size <= kMaxBlockSize);
+    return Log2(static_cast<uint64_t>(size)) - ConstexprLog2(kMinBlockSize);
+}
+
+uint8_t* CommandBlockPool::Allocate(size_t size) {
+    if (size <= kMaxBlockSize) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<uint8_t*>& blocks = mFreeBlocks[GetSizeClass(size)];
+        if (!blocks.empty()) {
+            uint8_t* block = blocks.back();
+            blocks.pop_back();
+            mCachedSize -= size;
+            return block;
+        }
+    }
+    return static_cast<uint8_t*>(malloc(size));
+}
+
+void CommandBlockPool::Deallocate(uint8_t* block, size_t size) {
+    if (size <= kMaxBlockSize) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mCachedSize + size <= mMaxCachedSize) {
+            mFreeBlocks[GetSizeClass(size)].push_back(block);
+            mCachedSize += size;
+            return;
+        }
+    }
+    free(block);
+}
+
+size_t CommandBlockPool::GetCachedSizeForTesting() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCachedSize;
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -103,7 +172,7 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
     }
 
     for (BlockDef& block : mBlocks) {
-        free(block.block);
+        FreeBlock(block);
     }
     mBlocks.clear();
     Reset();
@@ -128,12 +197,18 @@ CommandAllocator::CommandAllocator() {
     ResetPointers();
 }
 
+CommandAllocator::CommandAllocator(CommandBlockPool* blockPool) : mBlockPool(blockPool) {
+    ResetPointers();
+}
+
 CommandAllocator::~CommandAllocator() {
     Reset();
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize),
+      mBlockPool(other.mBlockPool) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -146,6 +221,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mBlockPool = other.mBlockPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -158,7 +234,7 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 
 void CommandAllocator::Reset() {
     for (BlockDef& block : mBlocks) {
-        free(block.block);
+        FreeBlock(block);
     }
     mBlocks.clear();
     mLastAllocationSize = kDefaultBaseAllocationSize;
@@ -205,14 +281,21 @@ uint8_t* CommandAllocator::AllocateInNewBlock(uint32_t commandId,
 
 bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
-    mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
+    mLastAllocationSize = std::max(
+        minimumSize, std::min(mLastAllocationSize * 2, CommandBlockPool::kMaxBlockSize));
 
-    uint8_t* block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    uint8_t* block;
+    if (mBlockPool != nullptr) {
+        mLastAllocationSize = CommandBlockPool::GetBlockSize(mLastAllocationSize);
+        block = mBlockPool->Allocate(mLastAllocationSize);
+    } else {
+        block = static_cast<uint8_t*>(malloc(mLastAllocationSize));
+    }
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
 
-    mBlocks.push_back({mLastAllocationSize, block});
+    mBlocks.push_back({mLastAllocationSize, block, mBlockPool});
     mCurrentPtr = AlignPtr(block, alignof(uint32_t));
     mEndPtr = block + mLastAllocationSize;
     return true;
@@ -15,9 +15,11 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 #include <vector>
 
 #include "dawn/common/Assert.h"
@@ -53,14 +55,51 @@ namespace dawn::native {
 // and must tell the CommandIterator when the allocated commands have been processed for
 // deletion.
 
+class CommandBlockPool;
+
 // These are the lists of blocks, should not be used directly, only through CommandAllocator
 // and CommandIterator
 struct BlockDef {
     size_t size;
     uint8_t* block;
+    // The pool the block must be returned to, or nullptr if it was allocated with malloc.
+    CommandBlockPool* pool;
 };
 using CommandBlocks = std::vector<BlockDef>;
 
+// A pool of blocks owned by the device to recycle them across command encoders, instead of
+// allocating and freeing them for each command buffer. Blocks are grouped in power-of-two size
+// classes and the total size of the blocks kept in the pool is capped. Blocks larger than the
+// largest size class aren't pooled. The pool is thread-safe since command buffers can be encoded
+// and destroyed on any thread.
+class CommandBlockPool : public NonCopyable {
+  public:
+    static constexpr size_t kMinBlockSize = 4096;
+    static constexpr size_t kMaxBlockSize = 16384;
+
+    explicit CommandBlockPool(size_t maxCachedSize);
+    ~CommandBlockPool();
+
+    // Returns the size of the block that should be requested to hold at least |minimumSize|
+    // bytes, which is rounded up to the size class.
+    static size_t GetBlockSize(size_t minimumSize);
+
+    // |size| must be a value returned by GetBlockSize. Returns nullptr on allocation failure.
+    uint8_t* Allocate(size_t size);
+    void Deallocate(uint8_t* block, size_t size);
+
+    size_t GetCachedSizeForTesting();
+
+  private:
+    static constexpr size_t kSizeClassCount = 3;
+    static size_t GetSizeClass(size_t size);
+
+    std::mutex mMutex;
+    std::array<std::vector<uint8_t*>, kSizeClassCount> mFreeBlocks;
+    size_t mCachedSize = 0;
+    const size_t mMaxCachedSize;
+};
+
 namespace detail {
 constexpr uint32_t kEndOfBlock = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
@@ -150,6 +189,8 @@ class CommandIterator : public NonCopyable {
 class CommandAllocator : public NonCopyable {
   public:
     CommandAllocator();
+    // The blocks are taken from |blockPool| if it isn't nullptr.
+    explicit CommandAllocator(CommandBlockPool* blockPool);
     ~CommandAllocator();
 
     // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
@@ -254,6 +295,7 @@ class CommandAllocator : public NonCopyable {
 
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
+    CommandBlockPool* mBlockPool = nullptr;
 
     // Data used for the block range at initialization so that the first call to Allocate sees
     // there is not enough space and calls GetNewBlock. This avoids having to special case the
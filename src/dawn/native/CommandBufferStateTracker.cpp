@@ -14,6 +14,8 @@
 
 #include "dawn/native/CommandBufferStateTracker.h"
 
+#include <algorithm>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -54,6 +56,29 @@ std::optional<uint32_t> FindFirstUndersizedBuffer(
     return std::nullopt;
 }
 
+// Returns the largest number of strides of the vertex buffer layout that fit in a buffer of
+// |bufferSize| bytes.
+uint64_t ComputeStrideCountLimit(const VertexBufferInfo& vertexBuffer, uint64_t bufferSize) {
+    if (vertexBuffer.arrayStride == 0) {
+        return vertexBuffer.usedBytesInStride <= bufferSize ? std::numeric_limits<uint64_t>::max()
+                                                            : 0;
+    }
+    if (vertexBuffer.lastStride > bufferSize) {
+        return 0;
+    }
+    // The required size for N strides is (N - 1) * arrayStride + lastStride.
+    return (bufferSize - vertexBuffer.lastStride) / vertexBuffer.arrayStride + 1;
+}
+
+bool MinBufferSizesEqual(const RequiredBufferSizes& a, const RequiredBufferSizes& b) {
+    for (BindGroupIndex i(0); i < kMaxBindGroupsTyped; ++i) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 struct BufferAliasing {
     struct Entry {
         BindGroupIndex bindGroupIndex;
@@ -317,6 +342,13 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForVertexBuffer(uint3
         return {};
     }
 
+    UpdateVertexBufferStrideCountLimits();
+    if (strideCount <= mVertexStrideCountLimit) {
+        return {};
+    }
+
+    // Look for the vertex buffer that is too small to produce the error message.
+
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const ityp::bitset<VertexBufferSlot, kMaxVertexBuffers>& vertexBufferSlotsUsedAsVertexBuffer =
@@ -365,6 +397,13 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForInstanceBuffer(
         return {};
     }
 
+    UpdateVertexBufferStrideCountLimits();
+    if (strideCount <= mInstanceStrideCountLimit) {
+        return {};
+    }
+
+    // Look for the instance buffer that is too small to produce the error message.
+
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const ityp::bitset<VertexBufferSlot, kMaxVertexBuffers>& vertexBufferSlotsUsedAsInstanceBuffer =
@@ -403,6 +442,34 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForInstanceBuffer(
     return {};
 }
 
+void CommandBufferStateTracker::UpdateVertexBufferStrideCountLimits() {
+    if (mDirtyVertexBufferSlots.none()) {
+        return;
+    }
+
+    RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
+    for (VertexBufferSlot slot :
+         IterateBitSet(mDirtyVertexBufferSlots & lastRenderPipeline->GetVertexBufferSlotsUsed())) {
+        mVertexBufferStrideCountLimits[slot] = ComputeStrideCountLimit(
+            lastRenderPipeline->GetVertexBuffer(slot), mVertexBufferSizes[slot]);
+    }
+    // The limits of the other slots are recomputed when a pipeline using them is set.
+    mDirtyVertexBufferSlots.reset();
+
+    mVertexStrideCountLimit = std::numeric_limits<uint64_t>::max();
+    for (VertexBufferSlot slot :
+         IterateBitSet(lastRenderPipeline->GetVertexBufferSlotsUsedAsVertexBuffer())) {
+        mVertexStrideCountLimit =
+            std::min(mVertexStrideCountLimit, mVertexBufferStrideCountLimits[slot]);
+    }
+    mInstanceStrideCountLimit = std::numeric_limits<uint64_t>::max();
+    for (VertexBufferSlot slot :
+         IterateBitSet(lastRenderPipeline->GetVertexBufferSlotsUsedAsInstanceBuffer())) {
+        mInstanceStrideCountLimit =
+            std::min(mInstanceStrideCountLimit, mVertexBufferStrideCountLimits[slot]);
+    }
+}
+
 MaybeError CommandBufferStateTracker::ValidateIndexBufferInRange(uint32_t indexCount,
                                                                  uint32_t firstIndex) {
     // Validate the range of index buffer
@@ -443,7 +510,9 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
     if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
         bool matches = true;
 
-        for (BindGroupIndex i : IterateBitSet(mLastPipelineLayout->GetBindGroupLayoutsMask())) {
+        // Only the bind groups that changed since they were last validated need to be checked.
+        for (BindGroupIndex i :
+             IterateBitSet(mDirtyBindGroups & mLastPipelineLayout->GetBindGroupLayoutsMask())) {
             if (mBindgroups[i] == nullptr ||
                 mLastPipelineLayout->GetBindGroupLayout(i) != mBindgroups[i]->GetLayout() ||
                 FindFirstUndersizedBuffer(mBindgroups[i]->GetUnverifiedBufferSizes(),
@@ -452,13 +521,16 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
                 matches = false;
                 break;
             }
+            mDirtyBindGroups.reset(i);
         }
 
-        if (matches) {
+        if (matches && !mBindGroupAliasingChecked) {
             // Continue checking if there is writable storage buffer binding aliasing or not
             if (FindStorageBufferBindingAliasing<bool>(mLastPipelineLayout, mBindgroups,
                                                        mDynamicOffsets)) {
                 matches = false;
+            } else {
+                mBindGroupAliasingChecked = true;
             }
         }
 
@@ -654,6 +726,8 @@ void CommandBufferStateTracker::SetBindGroup(BindGroupIndex index,
                                              const uint32_t* dynamicOffsets) {
     mBindgroups[index] = bindgroup;
     mDynamicOffsets[index].assign(dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
+    mDirtyBindGroups.set(index);
+    mBindGroupAliasingChecked = false;
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
 }
 
@@ -661,17 +735,43 @@ void CommandBufferStateTracker::SetIndexBuffer(wgpu::IndexFormat format, uint64_
     mIndexBufferSet = true;
     mIndexFormat = format;
     mIndexBufferSize = size;
+    // The index format may no longer match the strip index format of the pipeline.
+    mAspects.reset(VALIDATION_ASPECT_INDEX_BUFFER);
 }
 
 void CommandBufferStateTracker::SetVertexBuffer(VertexBufferSlot slot, uint64_t size) {
     mVertexBufferSlotsUsed.set(slot);
     mVertexBufferSizes[slot] = size;
+    mDirtyVertexBufferSlots.set(slot);
 }
 
 void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
+    // The lazy aspects only depend on the pipeline and the bound state, so they are still valid
+    // when the pipeline is set again.
+    if (pipeline == mLastPipeline && mAspects[VALIDATION_ASPECT_PIPELINE]) {
+        return;
+    }
+
+    PipelineLayoutBase* layout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
+    const RequiredBufferSizes* minBufferSizes =
+        pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
+
+    // Bind groups validated against the previous pipeline are still compatible if the pipeline
+    // layout and the minimum binding sizes are the same, which is common for pipelines sharing a
+    // layout. The aliasing of writable storage bindings only depends on the layout.
+    if (layout != mLastPipelineLayout) {
+        mDirtyBindGroups.set();
+        mBindGroupAliasingChecked = false;
+    } else if (minBufferSizes != mMinBufferSizes &&
+               (minBufferSizes == nullptr || mMinBufferSizes == nullptr ||
+                !MinBufferSizesEqual(*minBufferSizes, *mMinBufferSizes))) {
+        mDirtyBindGroups.set();
+    }
+    mDirtyVertexBufferSlots.set();
+
     mLastPipeline = pipeline;
-    mLastPipelineLayout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
-    mMinBufferSizes = pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
+    mLastPipelineLayout = layout;
+    mMinBufferSizes = minBufferSizes;
 
     mAspects.set(VALIDATION_ASPECT_PIPELINE);
 
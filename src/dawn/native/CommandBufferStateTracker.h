@@ -71,11 +71,30 @@ class CommandBufferStateTracker {
     MaybeError ValidateOperation(ValidationAspects requiredAspects);
     void RecomputeLazyAspects(ValidationAspects aspects);
     MaybeError CheckMissingAspects(ValidationAspects aspects);
+    void UpdateVertexBufferStrideCountLimits();
 
     void SetPipelineCommon(PipelineBase* pipeline);
 
     ValidationAspects mAspects;
 
+    // The bind groups that haven't been validated against the current pipeline since they, or the
+    // pipeline, were last set. Only those are revalidated to recompute the bind groups aspect.
+    ityp::bitset<BindGroupIndex, kMaxBindGroups> mDirtyBindGroups;
+    // Whether the writable storage bindings of the bind groups used by the current pipeline layout
+    // were checked for aliasing since the layout, a bind group or dynamic offsets were last set.
+    bool mBindGroupAliasingChecked = false;
+
+    // The vertex buffer slots whose stride count limit must be recomputed because the vertex
+    // buffer or the pipeline changed.
+    ityp::bitset<VertexBufferSlot, kMaxVertexBuffers> mDirtyVertexBufferSlots;
+    // For each slot used by the current pipeline, the largest number of strides that fit in the
+    // vertex buffer set at that slot.
+    ityp::array<VertexBufferSlot, uint64_t, kMaxVertexBuffers> mVertexBufferStrideCountLimits = {};
+    // The minimum of the limits of the slots used by the current pipeline as vertex (resp.
+    // instance) buffers, that is the number of vertices (resp. instances) that can be drawn.
+    uint64_t mVertexStrideCountLimit = 0;
+    uint64_t mInstanceStrideCountLimit = 0;
+
     ityp::array<BindGroupIndex, BindGroupBase*, kMaxBindGroups> mBindgroups = {};
     ityp::array<BindGroupIndex, std::vector<uint32_t>, kMaxBindGroups> mDynamicOffsets = {};
     ityp::bitset<VertexBufferSlot, kMaxVertexBuffers> mVertexBufferSlotsUsed;
@@ -1608,15 +1608,18 @@ void CommandEncoder::APIWriteTimestamp(QuerySetBase* querySet, uint32_t queryInd
 }
 
 CommandBufferBase* CommandEncoder::APIFinish(const CommandBufferDescriptor* descriptor) {
-    // This function will create new object, need to lock the Device.
-    auto deviceLock(GetDevice()->GetScopedLock());
-
-    Ref<CommandBufferBase> commandBuffer;
-    if (GetDevice()->ConsumedError(Finish(descriptor), &commandBuffer)) {
+    // Validating the encoded commands and moving them into the command buffer only touch state
+    // owned by the encoder, and command buffers are tracked in a thread-safe list, so the device
+    // lock is only needed to report errors. This lets multiple threads finish their encoders
+    // concurrently.
+    ResultOrError<Ref<CommandBufferBase>> result = Finish(descriptor);
+    if (result.IsError()) {
+        auto deviceLock(GetDevice()->GetScopedLock());
+        DAWN_UNUSED(GetDevice()->ConsumedError(result.AcquireError()));
         return CommandBufferBase::MakeError(GetDevice());
     }
     ASSERT(!IsError());
-    return commandBuffer.Detach();
+    return result.AcquireSuccess().Detach();
 }
 
 ResultOrError<Ref<CommandBufferBase>> CommandEncoder::Finish(
@@ -0,0 +1,267 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/CopyTextureData.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+#include "dawn/common/RefCounted.h"
+#include "dawn/platform/DawnPlatform.h"
+
+#if DAWN_PLATFORM_IS(X86)
+#include <emmintrin.h>
+#endif
+
+namespace dawn::native {
+
+namespace {
+
+// Copies smaller than this are done on the calling thread only, since waking up workers would
+// cost more than it saves.
+constexpr uint64_t kMinParallelCopySize = 4 * 1024 * 1024;
+// The minimum number of bytes copied by each band of a parallel copy.
+constexpr uint64_t kMinBandSize = 1024 * 1024;
+// Memory bandwidth is usually saturated with a handful of threads.
+constexpr uint32_t kMaxBandCount = 8;
+
+// Non-temporal stores only pay off when the data wouldn't stay in the caches anyway, and when
+// whole cache lines are written at once.
+constexpr uint64_t kMinNonTemporalCopySize = 1024 * 1024;
+constexpr uint32_t kMinNonTemporalBytesPerRow = 256;
+
+#if DAWN_PLATFORM_IS(X86)
+constexpr bool kHasNonTemporalStores = true;
+
+void CopyBytesNonTemporal(uint8_t* dst, const uint8_t* src, size_t size) {
+    // Streaming stores need a destination aligned on 16 bytes.
+    size_t head = std::min(size, (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15);
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 64; size -= 64, dst += 64, src += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+    }
+    for (; size >= 16; size -= 16, dst += 16, src += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+    memcpy(dst, src, size);
+}
+
+void FenceNonTemporalStores() {
+    _mm_sfence();
+}
+#else
+constexpr bool kHasNonTemporalStores = false;
+
+void CopyBytesNonTemporal(uint8_t* dst, const uint8_t* src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+void FenceNonTemporalStores() {}
+#endif
+
+struct RowCopy {
+    uint8_t* dstPointer;
+    const uint8_t* srcPointer;
+    uint32_t rowsPerImage;
+    uint64_t srcBytesPerImage;
+    uint32_t actualBytesPerRow;
+    uint32_t dstBytesPerRow;
+    uint32_t srcBytesPerRow;
+    // The rows of an image are contiguous in both the source and the destination.
+    bool copyWholeLayer;
+    // All the rows are contiguous in both the source and the destination.
+    bool copyWholeData;
+    bool nonTemporal;
+};
+
+void CopyBytes(const RowCopy& copy, uint8_t* dst, const uint8_t* src, uint64_t size) {
+    if (copy.nonTemporal) {
+        CopyBytesNonTemporal(dst, src, size);
+    } else {
+        memcpy(dst, src, size);
+    }
+}
+
+// Copies |rowCount| rows starting at |firstRow|, counting the rows of all the images.
+void CopyRows(const RowCopy& copy, uint64_t firstRow, uint64_t rowCount) {
+    if (copy.copyWholeData) {
+        uint64_t offset = firstRow * copy.actualBytesPerRow;
+        CopyBytes(copy, copy.dstPointer + offset, copy.srcPointer + offset,
+                  rowCount * copy.actualBytesPerRow);
+    } else {
+        uint64_t endRow = firstRow + rowCount;
+        for (uint64_t row = firstRow; row < endRow;) {
+            uint64_t image = row / copy.rowsPerImage;
+            uint64_t rowInImage = row % copy.rowsPerImage;
+            uint64_t rowsInImage = std::min(endRow - row, copy.rowsPerImage - rowInImage);
+
+            uint8_t* dst = copy.dstPointer + row * copy.dstBytesPerRow;
+            const uint8_t* src = copy.srcPointer + image * copy.srcBytesPerImage +
+                                 rowInImage * copy.srcBytesPerRow;
+            if (copy.copyWholeLayer) {
+                CopyBytes(copy, dst, src, rowsInImage * copy.actualBytesPerRow);
+            } else {
+                for (uint64_t i = 0; i < rowsInImage; ++i) {
+                    CopyBytes(copy, dst, src, copy.actualBytesPerRow);
+                    dst += copy.dstBytesPerRow;
+                    src += copy.srcBytesPerRow;
+                }
+            }
+            row += rowsInImage;
+        }
+    }
+
+    // Make the non-temporal stores visible to the thread waiting for the copy to complete.
+    if (copy.nonTemporal) {
+        FenceNonTemporalStores();
+    }
+}
+
+// The bands of a parallel copy. The calling thread and the worker tasks pick the next band to copy
+// until there are none left, so that a task that starts late doesn't delay the copy. The state is
+// refcounted and owns the description of the copy so that tasks starting after the copy is done
+// find no band left and return without touching the caller's data.
+class ParallelRowCopy : public RefCounted {
+  public:
+    ParallelRowCopy(const RowCopy& copy, uint64_t rowCount, uint32_t bandCount)
+        : mCopy(copy),
+          mRowCount(rowCount),
+          mRowsPerBand((rowCount + bandCount - 1) / bandCount),
+          mBandCount(static_cast<uint32_t>((rowCount + mRowsPerBand - 1) / mRowsPerBand)) {}
+
+    uint32_t GetBandCount() const { return mBandCount; }
+
+    // The worker task callback. |userdata| is a ParallelRowCopy with a reference for the task.
+    static void CopyBandsTask(void* userdata) {
+        ParallelRowCopy* self = static_cast<ParallelRowCopy*>(userdata);
+        self->CopyBands();
+        self->Release();
+    }
+
+    void CopyBands() {
+        uint32_t copiedBands = 0;
+        for (uint32_t band = mNextBand.fetch_add(1, std::memory_order_relaxed); band < mBandCount;
+             band = mNextBand.fetch_add(1, std::memory_order_relaxed)) {
+            uint64_t firstRow = band * mRowsPerBand;
+            CopyRows(mCopy, firstRow, std::min(mRowsPerBand, mRowCount - firstRow));
+            copiedBands++;
+        }
+
+        if (copiedBands > 0) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCompletedBands += copiedBands;
+            if (mCompletedBands == mBandCount) {
+                mCondition.notify_all();
+            }
+        }
+    }
+
+    // Waits for the bands picked by other threads to be copied. Only called once there is no band
+    // left to pick, so it only waits for copies that are in progress.
+    void WaitForCompletion() {
+        ASSERT(mNextBand.load(std::memory_order_relaxed) >= mBandCount);
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mCompletedBands == mBandCount; });
+    }
+
+  private:
+    const RowCopy mCopy;
+    const uint64_t mRowCount;
+    const uint64_t mRowsPerBand;
+    const uint32_t mBandCount;
+    std::atomic<uint32_t> mNextBand{0};
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint32_t mCompletedBands = 0;
+};
+
+uint32_t GetBandCount(uint64_t rowCount, uint64_t copySize) {
+    if (copySize < kMinParallelCopySize) {
+        return 1;
+    }
+    uint64_t maxBandCount =
+        std::min(kMaxBandCount, std::max(1u, std::thread::hardware_concurrency()));
+    return static_cast<uint32_t>(std::min({maxBandCount, rowCount, copySize / kMinBandSize}));
+}
+
+}  // namespace
+
+void CopyTextureData(uint8_t* dstPointer,
+                     const uint8_t* srcPointer,
+                     uint32_t depth,
+                     uint32_t rowsPerImage,
+                     uint64_t imageAdditionalStride,
+                     uint32_t actualBytesPerRow,
+                     uint32_t dstBytesPerRow,
+                     uint32_t srcBytesPerRow,
+                     const CopyTextureDataOptions& options) {
+    uint64_t rowCount = uint64_t(depth) * rowsPerImage;
+    uint64_t copySize = rowCount * actualBytesPerRow;
+    if (copySize == 0) {
+        return;
+    }
+
+    RowCopy copy;
+    copy.dstPointer = dstPointer;
+    copy.srcPointer = srcPointer;
+    copy.rowsPerImage = rowsPerImage;
+    copy.srcBytesPerImage = uint64_t(rowsPerImage) * srcBytesPerRow + imageAdditionalStride;
+    copy.actualBytesPerRow = actualBytesPerRow;
+    copy.dstBytesPerRow = dstBytesPerRow;
+    copy.srcBytesPerRow = srcBytesPerRow;
+    copy.copyWholeLayer =
+        actualBytesPerRow == dstBytesPerRow && dstBytesPerRow == srcBytesPerRow;
+    copy.copyWholeData = copy.copyWholeLayer && imageAdditionalStride == 0;
+    copy.nonTemporal = kHasNonTemporalStores && options.writeOnlyDestination &&
+                       copySize >= kMinNonTemporalCopySize &&
+                       (copy.copyWholeLayer || actualBytesPerRow >= kMinNonTemporalBytesPerRow);
+
+    uint32_t bandCount =
+        options.workerTaskPool != nullptr ? GetBandCount(rowCount, copySize) : 1;
+    if (bandCount <= 1) {
+        CopyRows(copy, 0, rowCount);
+        return;
+    }
+
+    Ref<ParallelRowCopy> parallelCopy =
+        AcquireRef(new ParallelRowCopy(copy, rowCount, bandCount));
+    for (uint32_t i = 1; i < parallelCopy->GetBandCount(); ++i) {
+        // The task keeps the copy state alive, so there is no need to wait for it to run.
+        parallelCopy->Reference();
+        options.workerTaskPool->PostWorkerTask(ParallelRowCopy::CopyBandsTask, parallelCopy.Get());
+    }
+    parallelCopy->CopyBands();
+    parallelCopy->WaitForCompletion();
+}
+
+}  // namespace dawn::native
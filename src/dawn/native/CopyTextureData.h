@@ -0,0 +1,52 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_COPYTEXTUREDATA_H_
+#define SRC_DAWN_NATIVE_COPYTEXTUREDATA_H_
+
+#include <cstdint>
+
+namespace dawn::platform {
+class WorkerTaskPool;
+}  // namespace dawn::platform
+
+namespace dawn::native {
+
+struct CopyTextureDataOptions {
+    // If set, large copies are split in bands of rows that are copied in parallel on the pool and
+    // on the calling thread. Otherwise everything is copied on the calling thread.
+    dawn::platform::WorkerTaskPool* workerTaskPool = nullptr;
+
+    // Whether the destination is only written by the CPU, like staging memory that is likely to
+    // be write-combined. Large copies then use non-temporal stores that bypass the CPU caches.
+    bool writeOnlyDestination = false;
+};
+
+// Copies |depth| images of |rowsPerImage| rows of |actualBytesPerRow| bytes from |srcPointer| to
+// |dstPointer|. Consecutive rows are |srcBytesPerRow| and |dstBytesPerRow| bytes apart in the
+// source and destination, and source images are separated by |imageAdditionalStride| additional
+// bytes. The copy is complete when the function returns.
+void CopyTextureData(uint8_t* dstPointer,
+                     const uint8_t* srcPointer,
+                     uint32_t depth,
+                     uint32_t rowsPerImage,
+                     uint64_t imageAdditionalStride,
+                     uint32_t actualBytesPerRow,
+                     uint32_t dstBytesPerRow,
+                     uint32_t srcBytesPerRow,
+                     const CopyTextureDataOptions& options = {});
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_COPYTEXTUREDATA_H_
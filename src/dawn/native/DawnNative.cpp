@@ -14,13 +14,19 @@
 
 #include "dawn/native/DawnNative.h"
 
+#include <memory>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "dawn/common/Log.h"
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/EventManager.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/Queue.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/Texture.h"
 #include "dawn/platform/DawnPlatform.h"
 #include "tint/tint.h"
@@ -71,6 +77,15 @@ std::vector<const char*> GetTogglesUsed(WGPUDevice device) {
     return FromAPI(device)->GetTogglesUsed();
 }
 
+std::string GetShaderCompilationStatisticsJSON(WGPUDevice device) {
+    ShaderCompilationStatisticsRecorder* recorder =
+        FromAPI(device)->GetShaderCompilationStatisticsRecorder();
+    if (recorder == nullptr) {
+        return "";
+    }
+    return recorder->ToJSON();
+}
+
 // DawnDeviceDescriptor
 
 DawnDeviceDescriptor::DawnDeviceDescriptor() = default;
@@ -251,6 +266,10 @@ uint64_t Instance::GetDeviceCountForTesting() const {
     return mImpl->GetDeviceCountForTesting();
 }
 
+BlobCacheStats Instance::GetBlobCacheStats() const {
+    return mImpl->GetBlobCacheStats();
+}
+
 WGPUInstance Instance::Get() const {
     return ToAPI(mImpl);
 }
@@ -298,6 +317,130 @@ DAWN_NATIVE_EXPORT bool InstanceProcessEvents(WGPUInstance instance) {
     return FromAPI(instance)->APIProcessEvents();
 }
 
+namespace {
+
+template <typename Callback>
+class FutureCallback;
+
+// Wraps the callback of an asynchronous operation to complete its future once the callback has
+// been called. The userdata is the last argument of all the callbacks and is used to find the
+// FutureCallback before the user's userdata is put back in its place.
+template <typename... Args>
+class FutureCallback<void (*)(Args...)> {
+  public:
+    using CallbackType = void (*)(Args...);
+
+    FutureCallback(Ref<EventManager> eventManager,
+                   EventManager::FutureKind kind,
+                   CallbackType callback,
+                   void* userdata)
+        : mEventManager(std::move(eventManager)),
+          mFuture(mEventManager->TrackFuture(kind)),
+          mCallback(callback),
+          mUserdata(userdata) {}
+
+    FutureID GetFuture() const { return mFuture; }
+
+    static void Callback(Args... args) {
+        constexpr size_t kUserdataIndex = sizeof...(Args) - 1;
+        std::tuple<Args...> arguments(args...);
+        std::unique_ptr<FutureCallback> self(
+            static_cast<FutureCallback*>(std::get<kUserdataIndex>(arguments)));
+        std::get<kUserdataIndex>(arguments) = self->mUserdata;
+
+        if (self->mCallback != nullptr) {
+            std::apply(self->mCallback, arguments);
+        }
+        self->mEventManager->CompleteFuture(self->mFuture);
+    }
+
+  private:
+    Ref<EventManager> mEventManager;
+    FutureID mFuture;
+    CallbackType mCallback;
+    void* mUserdata;
+};
+
+// Calls |call| with a callback and userdata that complete a new future of |instance|.
+template <typename Callback, typename Call>
+uint64_t CallWithFuture(InstanceBase* instance,
+                        EventManager::FutureKind kind,
+                        Callback callback,
+                        void* userdata,
+                        Call call) {
+    auto* futureCallback =
+        new FutureCallback<Callback>(instance->GetEventManager(), kind, callback, userdata);
+    // The callback may be called, and delete |futureCallback|, before |call| returns.
+    FutureID future = futureCallback->GetFuture();
+    call(&FutureCallback<Callback>::Callback, futureCallback);
+    return future;
+}
+
+InstanceBase* GetInstance(DeviceBase* device) {
+    return device->GetAdapter()->GetInstance();
+}
+
+}  // anonymous namespace
+
+DAWN_NATIVE_EXPORT uint64_t BufferMapAsyncF(WGPUBuffer buffer,
+                                            WGPUMapModeFlags mode,
+                                            size_t offset,
+                                            size_t size,
+                                            WGPUBufferMapCallback callback,
+                                            void* userdata) {
+    return CallWithFuture(GetInstance(FromAPI(buffer)->GetDevice()),
+                          EventManager::FutureKind::QueueSerial, callback, userdata,
+                          [&](WGPUBufferMapCallback futureCallback, void* futureUserdata) {
+                              GetProcs().bufferMapAsync(buffer, mode, offset, size,
+                                                        futureCallback, futureUserdata);
+                          });
+}
+
+DAWN_NATIVE_EXPORT uint64_t QueueOnSubmittedWorkDoneF(WGPUQueue queue,
+                                                      uint64_t signalValue,
+                                                      WGPUQueueWorkDoneCallback callback,
+                                                      void* userdata) {
+    return CallWithFuture(GetInstance(FromAPI(queue)->GetDevice()),
+                          EventManager::FutureKind::QueueSerial, callback, userdata,
+                          [&](WGPUQueueWorkDoneCallback futureCallback, void* futureUserdata) {
+                              GetProcs().queueOnSubmittedWorkDone(queue, signalValue,
+                                                                  futureCallback, futureUserdata);
+                          });
+}
+
+DAWN_NATIVE_EXPORT uint64_t
+DeviceCreateComputePipelineAsyncF(WGPUDevice device,
+                                  const WGPUComputePipelineDescriptor* descriptor,
+                                  WGPUCreateComputePipelineAsyncCallback callback,
+                                  void* userdata) {
+    return CallWithFuture(
+        GetInstance(FromAPI(device)), EventManager::FutureKind::CallbackTask, callback, userdata,
+        [&](WGPUCreateComputePipelineAsyncCallback futureCallback, void* futureUserdata) {
+            GetProcs().deviceCreateComputePipelineAsync(device, descriptor, futureCallback,
+                                                        futureUserdata);
+        });
+}
+
+DAWN_NATIVE_EXPORT uint64_t
+DeviceCreateRenderPipelineAsyncF(WGPUDevice device,
+                                 const WGPURenderPipelineDescriptor* descriptor,
+                                 WGPUCreateRenderPipelineAsyncCallback callback,
+                                 void* userdata) {
+    return CallWithFuture(
+        GetInstance(FromAPI(device)), EventManager::FutureKind::CallbackTask, callback, userdata,
+        [&](WGPUCreateRenderPipelineAsyncCallback futureCallback, void* futureUserdata) {
+            GetProcs().deviceCreateRenderPipelineAsync(device, descriptor, futureCallback,
+                                                       futureUserdata);
+        });
+}
+
+DAWN_NATIVE_EXPORT WaitStatus InstanceWaitAny(WGPUInstance instance,
+                                              size_t futureCount,
+                                              FutureWaitInfo* futures,
+                                              uint64_t timeoutNS) {
+    return FromAPI(instance)->WaitAny(futureCount, futures, timeoutNS);
+}
+
 // ExternalImageDescriptor
 
 ExternalImageDescriptor::ExternalImageDescriptor(ExternalImageType type) : mType(type) {}
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <unordered_set>
 
+#include "dawn/common/ConcurrentCache.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/Adapter.h"
@@ -30,6 +31,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils_autogen.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -38,6 +40,7 @@
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/ErrorInjector.h"
 #include "dawn/native/ErrorScope.h"
+#include "dawn/native/EventManager.h"
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/InternalPipelineStore.h"
@@ -48,6 +51,7 @@
 #include "dawn/native/RenderBundleEncoder.h"
 #include "dawn/native/RenderPipeline.h"
 #include "dawn/native/Sampler.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/Surface.h"
 #include "dawn/native/SwapChain.h"
 #include "dawn/native/Texture.h"
@@ -60,21 +64,23 @@ namespace dawn::native {
 
 // DeviceBase sub-structures
 
-// The caches are unordered_sets of pointers with special hash and compare functions
-// to compare the value of the objects, instead of the pointers.
+// The caches are sets of pointers with special hash and compare functions to compare the value
+// of the objects, instead of the pointers. They are thread-safe so that cached objects can be
+// looked up, and released from any thread, without holding the device lock. An object that is
+// being destroyed is replaced in the cache by a new equal object, so it may not be in the cache
+// anymore when it uncaches itself.
 template <typename Object>
-using ContentLessObjectCache =
-    std::unordered_set<Object*, typename Object::HashFunc, typename Object::EqualityFunc>;
+using ContentLessObjectCache = ConcurrentCache<Object>;
 
 struct DeviceBase::Caches {
     ~Caches() {
-        ASSERT(attachmentStates.empty());
-        ASSERT(bindGroupLayouts.empty());
-        ASSERT(computePipelines.empty());
-        ASSERT(pipelineLayouts.empty());
-        ASSERT(renderPipelines.empty());
-        ASSERT(samplers.empty());
-        ASSERT(shaderModules.empty());
+        ASSERT(attachmentStates.Empty());
+        ASSERT(bindGroupLayouts.Empty());
+        ASSERT(computePipelines.Empty());
+        ASSERT(pipelineLayouts.Empty());
+        ASSERT(renderPipelines.Empty());
+        ASSERT(samplers.Empty());
+        ASSERT(shaderModules.Empty());
     }
 
     ContentLessObjectCache<AttachmentStateBlueprint> attachmentStates;
@@ -92,6 +98,18 @@ struct DeviceBase::DeprecationWarnings {
 };
 
 namespace {
+// The maximum total size of the command blocks kept by the device for reuse.
+constexpr size_t kMaxCachedCommandBlockSize = 4 * 1024 * 1024;
+
+// Returns whether |maybeError| is an error, discarding the error.
+bool DiscardError(MaybeError maybeError) {
+    if (maybeError.IsError()) {
+        maybeError.AcquireError();
+        return true;
+    }
+    return false;
+}
+
 bool IsMutexLockedByCurrentThreadIfNeeded(const Ref<Mutex>& mutex) {
     return mutex == nullptr || mutex->IsLockedByCurrentThread();
 }
@@ -252,7 +270,16 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
     mCaches = std::make_unique<DeviceBase::Caches>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
-    mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
+    if (!IsToggleEnabled(Toggle::DisableCommandBlockPool)) {
+        mCommandBlockPool = std::make_unique<CommandBlockPool>(kMaxCachedCommandBlockSize);
+    }
+    if (IsToggleEnabled(Toggle::RecordShaderCompilationStatistics)) {
+        mShaderCompilationStatisticsRecorder =
+            std::make_unique<ShaderCompilationStatisticsRecorder>();
+    }
+    // Mock devices used in tests don't have an adapter.
+    mCallbackTaskManager = AcquireRef(new CallbackTaskManager(
+        mAdapter != nullptr ? mAdapter->GetInstance()->GetEventManager() : nullptr));
     mDeprecationWarnings = std::make_unique<DeprecationWarnings>();
     mInternalPipelineStore = std::make_unique<InternalPipelineStore>(this);
 
@@ -539,9 +566,10 @@ void DeviceBase::HandleError(std::unique_ptr<ErrorData> error,
         type = InternalErrorType::DeviceLost;
     }
 
-    // TODO(lokokung) Update call sites that take the c-string to take string_view.
-    const std::string messageStr = error->GetFormattedMessage();
     if (type == InternalErrorType::DeviceLost) {
+        // TODO(lokokung) Update call sites that take the c-string to take string_view.
+        const std::string messageStr = error->GetFormattedMessage();
+
         // The device was lost, schedule the application callback's executation.
         // Note: we don't invoke the callbacks directly here because it could cause re-entrances ->
         // possible deadlock.
@@ -560,13 +588,15 @@ void DeviceBase::HandleError(std::unique_ptr<ErrorData> error,
         mCallbackTaskManager->HandleDeviceLoss();
 
         // Still forward device loss errors to the error scopes so they all reject.
-        mErrorScopeStack->HandleError(ToWGPUErrorType(type), messageStr.c_str());
+        mErrorScopeStack->HandleError(ToWGPUErrorType(type), *error);
     } else {
         // Pass the error to the error scope stack and call the uncaptured error callback
         // if it isn't handled. DeviceLost is not handled here because it should be
-        // handled by the lost callback.
-        bool captured = mErrorScopeStack->HandleError(ToWGPUErrorType(type), messageStr.c_str());
+        // handled by the lost callback. The message is only formatted if it is used, which
+        // makes ignoring errors cheap.
+        bool captured = mErrorScopeStack->HandleError(ToWGPUErrorType(type), *error);
         if (!captured && mUncapturedErrorCallback != nullptr) {
+            const std::string messageStr = error->GetFormattedMessage();
             mCallbackTaskManager->AddCallbackTask([callback = mUncapturedErrorCallback, type,
                                                    messageStr,
                                                    userdata = mUncapturedErrorUserdata] {
@@ -673,6 +703,14 @@ BlobCache* DeviceBase::GetBlobCache() {
 #endif
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
+ShaderCompilationStatisticsRecorder* DeviceBase::GetShaderCompilationStatisticsRecorder() const {
+    return mShaderCompilationStatisticsRecorder.get();
+}
+
 Blob DeviceBase::LoadCachedBlob(const CacheKey& key) {
     return GetBlobCache()->Load(key);
 }
@@ -807,6 +845,17 @@ const Format& DeviceBase::GetValidInternalFormat(FormatIndex index) const {
     return mFormatTable[index];
 }
 
+// static
+template <typename Object, typename CachedType>
+Ref<Object> DeviceBase::AddOrGetCachedObject(ConcurrentCache<CachedType>* cache,
+                                             Ref<Object> object) {
+    auto [cachedObject, inserted] = cache->InsertAndReference(object.Get());
+    if (inserted) {
+        cachedObject->SetIsCachedReference();
+    }
+    return std::move(cachedObject);
+}
+
 ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
     const BindGroupLayoutDescriptor* descriptor,
     PipelineCompatibilityToken pipelineCompatibilityToken) {
@@ -816,15 +865,11 @@ ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<BindGroupLayoutBase> result;
-    auto iter = mCaches->bindGroupLayouts.find(&blueprint);
-    if (iter != mCaches->bindGroupLayouts.end()) {
-        result = *iter;
-    } else {
+    Ref<BindGroupLayoutBase> result = mCaches->bindGroupLayouts.FindAndReference(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreateBindGroupLayoutImpl(descriptor, pipelineCompatibilityToken));
-        result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->bindGroupLayouts.insert(result.Get());
+        result = AddOrGetCachedObject(&mCaches->bindGroupLayouts, std::move(result));
     }
 
     return std::move(result);
@@ -832,8 +877,8 @@ ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::GetOrCreateBindGroupLayout(
 
 void DeviceBase::UncacheBindGroupLayout(BindGroupLayoutBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->bindGroupLayouts.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->bindGroupLayouts.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 // Private function used at initialization
@@ -852,53 +897,30 @@ BindGroupLayoutBase* DeviceBase::GetEmptyBindGroupLayout() {
 
 Ref<ComputePipelineBase> DeviceBase::GetCachedComputePipeline(
     ComputePipelineBase* uninitializedComputePipeline) {
-    Ref<ComputePipelineBase> cachedPipeline;
-    auto iter = mCaches->computePipelines.find(uninitializedComputePipeline);
-    if (iter != mCaches->computePipelines.end()) {
-        cachedPipeline = *iter;
-    }
-
-    return cachedPipeline;
+    return mCaches->computePipelines.FindAndReference(uninitializedComputePipeline);
 }
 
 Ref<RenderPipelineBase> DeviceBase::GetCachedRenderPipeline(
     RenderPipelineBase* uninitializedRenderPipeline) {
-    Ref<RenderPipelineBase> cachedPipeline;
-    auto iter = mCaches->renderPipelines.find(uninitializedRenderPipeline);
-    if (iter != mCaches->renderPipelines.end()) {
-        cachedPipeline = *iter;
-    }
-    return cachedPipeline;
+    return mCaches->renderPipelines.FindAndReference(uninitializedRenderPipeline);
 }
 
 Ref<ComputePipelineBase> DeviceBase::AddOrGetCachedComputePipeline(
     Ref<ComputePipelineBase> computePipeline) {
     ASSERT(IsMutexLockedByCurrentThreadIfNeeded(mMutex));
-    auto [cachedPipeline, inserted] = mCaches->computePipelines.insert(computePipeline.Get());
-    if (inserted) {
-        computePipeline->SetIsCachedReference();
-        return computePipeline;
-    } else {
-        return *cachedPipeline;
-    }
+    return AddOrGetCachedObject(&mCaches->computePipelines, std::move(computePipeline));
 }
 
 Ref<RenderPipelineBase> DeviceBase::AddOrGetCachedRenderPipeline(
     Ref<RenderPipelineBase> renderPipeline) {
     ASSERT(IsMutexLockedByCurrentThreadIfNeeded(mMutex));
-    auto [cachedPipeline, inserted] = mCaches->renderPipelines.insert(renderPipeline.Get());
-    if (inserted) {
-        renderPipeline->SetIsCachedReference();
-        return renderPipeline;
-    } else {
-        return *cachedPipeline;
-    }
+    return AddOrGetCachedObject(&mCaches->renderPipelines, std::move(renderPipeline));
 }
 
 void DeviceBase::UncacheComputePipeline(ComputePipelineBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->computePipelines.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->computePipelines.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 ResultOrError<Ref<TextureViewBase>>
@@ -937,15 +959,11 @@ ResultOrError<Ref<PipelineLayoutBase>> DeviceBase::GetOrCreatePipelineLayout(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<PipelineLayoutBase> result;
-    auto iter = mCaches->pipelineLayouts.find(&blueprint);
-    if (iter != mCaches->pipelineLayouts.end()) {
-        result = *iter;
-    } else {
+    Ref<PipelineLayoutBase> result = mCaches->pipelineLayouts.FindAndReference(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreatePipelineLayoutImpl(descriptor));
-        result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->pipelineLayouts.insert(result.Get());
+        result = AddOrGetCachedObject(&mCaches->pipelineLayouts, std::move(result));
     }
 
     return std::move(result);
@@ -953,14 +971,14 @@ ResultOrError<Ref<PipelineLayoutBase>> DeviceBase::GetOrCreatePipelineLayout(
 
 void DeviceBase::UncachePipelineLayout(PipelineLayoutBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->pipelineLayouts.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->pipelineLayouts.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 void DeviceBase::UncacheRenderPipeline(RenderPipelineBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->renderPipelines.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->renderPipelines.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
@@ -970,15 +988,11 @@ ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<SamplerBase> result;
-    auto iter = mCaches->samplers.find(&blueprint);
-    if (iter != mCaches->samplers.end()) {
-        result = *iter;
-    } else {
+    Ref<SamplerBase> result = mCaches->samplers.FindAndReference(&blueprint);
+    if (result == nullptr) {
         DAWN_TRY_ASSIGN(result, CreateSamplerImpl(descriptor));
-        result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->samplers.insert(result.Get());
+        result = AddOrGetCachedObject(&mCaches->samplers, std::move(result));
     }
 
     return std::move(result);
@@ -986,8 +1000,8 @@ ResultOrError<Ref<SamplerBase>> DeviceBase::GetOrCreateSampler(
 
 void DeviceBase::UncacheSampler(SamplerBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->samplers.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->samplers.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
@@ -1001,11 +1015,8 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
     const size_t blueprintHash = blueprint.ComputeContentHash();
     blueprint.SetContentHash(blueprintHash);
 
-    Ref<ShaderModuleBase> result;
-    auto iter = mCaches->shaderModules.find(&blueprint);
-    if (iter != mCaches->shaderModules.end()) {
-        result = *iter;
-    } else {
+    Ref<ShaderModuleBase> result = mCaches->shaderModules.FindAndReference(&blueprint);
+    if (result == nullptr) {
         if (!parseResult->HasParsedShader()) {
             // We skip the parse on creation if validation isn't enabled which let's us quickly
             // lookup in the cache without validating and parsing. We need the parsed module
@@ -1016,9 +1027,8 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
         }
         DAWN_TRY_ASSIGN(result,
                         CreateShaderModuleImpl(descriptor, parseResult, compilationMessages));
-        result->SetIsCachedReference();
         result->SetContentHash(blueprintHash);
-        mCaches->shaderModules.insert(result.Get());
+        result = AddOrGetCachedObject(&mCaches->shaderModules, std::move(result));
     }
 
     return std::move(result);
@@ -1026,21 +1036,22 @@ ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
 
 void DeviceBase::UncacheShaderModule(ShaderModuleBase* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->shaderModules.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->shaderModules.Erase(obj);
+    ASSERT(removedCount <= 1);
 }
 
 Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(AttachmentStateBlueprint* blueprint) {
-    auto iter = mCaches->attachmentStates.find(blueprint);
-    if (iter != mCaches->attachmentStates.end()) {
-        return static_cast<AttachmentState*>(*iter);
+    // This is called while encoding render passes and bundles, which doesn't hold the device
+    // lock, so the cache must be used atomically.
+    Ref<AttachmentState> attachmentState =
+        mCaches->attachmentStates.FindAndReference<AttachmentState>(blueprint);
+    if (attachmentState != nullptr) {
+        return attachmentState;
     }
 
-    Ref<AttachmentState> attachmentState = AcquireRef(new AttachmentState(this, *blueprint));
-    attachmentState->SetIsCachedReference();
+    attachmentState = AcquireRef(new AttachmentState(this, *blueprint));
     attachmentState->SetContentHash(attachmentState->ComputeContentHash());
-    mCaches->attachmentStates.insert(attachmentState.Get());
-    return attachmentState;
+    return AddOrGetCachedObject(&mCaches->attachmentStates, std::move(attachmentState));
 }
 
 Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(
@@ -1063,8 +1074,81 @@ Ref<AttachmentState> DeviceBase::GetOrCreateAttachmentState(
 
 void DeviceBase::UncacheAttachmentState(AttachmentState* obj) {
     ASSERT(obj->IsCachedReference());
-    size_t removedCount = mCaches->attachmentStates.erase(obj);
-    ASSERT(removedCount == 1);
+    size_t removedCount = mCaches->attachmentStates.Erase(obj);
+    ASSERT(removedCount <= 1);
+}
+
+MaybeError DeviceBase::ValidateAndGetCachedBindGroupLayout(
+    const BindGroupLayoutDescriptor* descriptor,
+    Ref<BindGroupLayoutBase>* cached) {
+    if (IsValidationEnabled()) {
+        DAWN_TRY_CONTEXT(ValidateBindGroupLayoutDescriptor(this, descriptor), "validating %s",
+                         descriptor);
+    }
+    if (IsLost()) {
+        return {};
+    }
+
+    BindGroupLayoutBase blueprint(this, descriptor, PipelineCompatibilityToken(0),
+                                  ApiObjectBase::kUntrackedByDevice);
+    blueprint.SetContentHash(blueprint.ComputeContentHash());
+    *cached = mCaches->bindGroupLayouts.FindAndReference(&blueprint);
+    return {};
+}
+
+MaybeError DeviceBase::ValidateAndGetCachedPipelineLayout(
+    const PipelineLayoutDescriptor* descriptor,
+    Ref<PipelineLayoutBase>* cached) {
+    if (IsValidationEnabled()) {
+        DAWN_TRY(ValidatePipelineLayoutDescriptor(this, descriptor));
+    }
+    if (IsLost()) {
+        return {};
+    }
+
+    PipelineLayoutBase blueprint(this, descriptor, ApiObjectBase::kUntrackedByDevice);
+    blueprint.SetContentHash(blueprint.ComputeContentHash());
+    *cached = mCaches->pipelineLayouts.FindAndReference(&blueprint);
+    return {};
+}
+
+MaybeError DeviceBase::ValidateAndGetCachedSampler(const SamplerDescriptor* descriptor,
+                                                   Ref<SamplerBase>* cached) {
+    if (IsValidationEnabled()) {
+        DAWN_TRY_CONTEXT(ValidateSamplerDescriptor(this, descriptor), "validating %s", descriptor);
+    }
+    if (IsLost()) {
+        return {};
+    }
+
+    SamplerBase blueprint(this, descriptor, ApiObjectBase::kUntrackedByDevice);
+    blueprint.SetContentHash(blueprint.ComputeContentHash());
+    *cached = mCaches->samplers.FindAndReference(&blueprint);
+    return {};
+}
+
+ResultOrError<Ref<BindGroupLayoutBase>> DeviceBase::CreateBindGroupLayoutAfterLookup(
+    MaybeError validation,
+    const BindGroupLayoutDescriptor* descriptor) {
+    DAWN_TRY(ValidateIsAlive());
+    DAWN_TRY(std::move(validation));
+    return GetOrCreateBindGroupLayout(descriptor);
+}
+
+ResultOrError<Ref<PipelineLayoutBase>> DeviceBase::CreatePipelineLayoutAfterLookup(
+    MaybeError validation,
+    const PipelineLayoutDescriptor* descriptor) {
+    DAWN_TRY(ValidateIsAlive());
+    DAWN_TRY(std::move(validation));
+    return GetOrCreatePipelineLayout(descriptor);
+}
+
+ResultOrError<Ref<SamplerBase>> DeviceBase::CreateSamplerAfterLookup(
+    MaybeError validation,
+    const SamplerDescriptor* descriptor) {
+    DAWN_TRY(ValidateIsAlive());
+    DAWN_TRY(std::move(validation));
+    return GetOrCreateSampler(descriptor);
 }
 
 Ref<PipelineCacheBase> DeviceBase::GetOrCreatePipelineCache(const CacheKey& key) {
@@ -1083,8 +1167,16 @@ BindGroupBase* DeviceBase::APICreateBindGroup(const BindGroupDescriptor* descrip
 }
 BindGroupLayoutBase* DeviceBase::APICreateBindGroupLayout(
     const BindGroupLayoutDescriptor* descriptor) {
+    // This method isn't autolocked: objects found in the cache are returned without taking the
+    // device lock.
     Ref<BindGroupLayoutBase> result;
-    if (ConsumedError(CreateBindGroupLayout(descriptor), &result,
+    MaybeError validation = ValidateAndGetCachedBindGroupLayout(descriptor, &result);
+    if (result != nullptr) {
+        return result.Detach();
+    }
+
+    auto deviceLock(GetScopedLock());
+    if (ConsumedError(CreateBindGroupLayoutAfterLookup(std::move(validation), descriptor), &result,
                       "calling %s.CreateBindGroupLayout(%s).", this, descriptor)) {
         return BindGroupLayoutBase::MakeError(this);
     }
@@ -1143,8 +1235,16 @@ void DeviceBase::APICreateComputePipelineAsync(const ComputePipelineDescriptor*
 }
 PipelineLayoutBase* DeviceBase::APICreatePipelineLayout(
     const PipelineLayoutDescriptor* descriptor) {
+    // This method isn't autolocked: objects found in the cache are returned without taking the
+    // device lock.
     Ref<PipelineLayoutBase> result;
-    if (ConsumedError(CreatePipelineLayout(descriptor), &result,
+    MaybeError validation = ValidateAndGetCachedPipelineLayout(descriptor, &result);
+    if (result != nullptr) {
+        return result.Detach();
+    }
+
+    auto deviceLock(GetScopedLock());
+    if (ConsumedError(CreatePipelineLayoutAfterLookup(std::move(validation), descriptor), &result,
                       "calling %s.CreatePipelineLayout(%s).", this, descriptor)) {
         return PipelineLayoutBase::MakeError(this);
     }
@@ -1159,9 +1259,20 @@ QuerySetBase* DeviceBase::APICreateQuerySet(const QuerySetDescriptor* descriptor
     return result.Detach();
 }
 SamplerBase* DeviceBase::APICreateSampler(const SamplerDescriptor* descriptor) {
+    // This method isn't autolocked: objects found in the cache are returned without taking the
+    // device lock.
+    const SamplerDescriptor defaultDescriptor = {};
+    const SamplerDescriptor* samplerDescriptor =
+        descriptor != nullptr ? descriptor : &defaultDescriptor;
     Ref<SamplerBase> result;
-    if (ConsumedError(CreateSampler(descriptor), &result, "calling %s.CreateSampler(%s).", this,
-                      descriptor)) {
+    MaybeError validation = ValidateAndGetCachedSampler(samplerDescriptor, &result);
+    if (result != nullptr) {
+        return result.Detach();
+    }
+
+    auto deviceLock(GetScopedLock());
+    if (ConsumedError(CreateSamplerAfterLookup(std::move(validation), samplerDescriptor), &result,
+                      "calling %s.CreateSampler(%s).", this, descriptor)) {
         return SamplerBase::MakeError(this);
     }
     return result.Detach();
@@ -1982,6 +2093,19 @@ bool DeviceBase::HasScheduledCommands() const {
     return mLastSubmittedSerial > mCompletedSerial || HasPendingCommands();
 }
 
+bool DeviceBase::HasQueueSerialsInFlight() {
+    auto deviceLock(GetScopedLock());
+    return !IsLost() && mLastSubmittedSerial > mCompletedSerial;
+}
+
+bool DeviceBase::WaitForNextQueueSerial(std::chrono::nanoseconds timeout) {
+    auto deviceLock(GetScopedLock());
+    if (IsLost() || mLastSubmittedSerial <= mCompletedSerial) {
+        return false;
+    }
+    return !ConsumedError(WaitForQueueSerialImpl(mCompletedSerial + ExecutionSerial(1), timeout));
+}
+
 void DeviceBase::AssumeCommandsCompleteForTesting() {
     AssumeCommandsComplete();
 }
@@ -15,6 +15,8 @@
 #ifndef SRC_DAWN_NATIVE_DEVICE_H_
 #define SRC_DAWN_NATIVE_DEVICE_H_
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -39,6 +41,9 @@
 #include "dawn/native/DawnNative.h"
 #include "dawn/native/dawn_platform.h"
 
+template <typename T>
+class ConcurrentCache;
+
 namespace dawn::platform {
 class WorkerTaskPool;
 }  // namespace dawn::platform
@@ -50,9 +55,11 @@ class AttachmentStateBlueprint;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
 class DynamicUploader;
 class ErrorScopeStack;
 class OwnedCompilationMessages;
+class ShaderCompilationStatisticsRecorder;
 struct CallbackTask;
 struct InternalPipelineStore;
 struct ShaderModuleParseResult;
@@ -313,6 +320,14 @@ class DeviceBase : public RefCountedWithExternalCount {
     Blob LoadCachedBlob(const CacheKey& key);
     void StoreCachedBlob(const CacheKey& key, const Blob& blob);
 
+    // Returns the pool used by the command encoders of the device to allocate the blocks holding
+    // their commands, or nullptr if the blocks shouldn't be pooled.
+    CommandBlockPool* GetCommandBlockPool() const;
+
+    // Returns the recorder of the statistics of the shader compilations of the device, or nullptr
+    // if they aren't recorded.
+    ShaderCompilationStatisticsRecorder* GetShaderCompilationStatisticsRecorder() const;
+
     MaybeError CopyFromStagingToBuffer(BufferBase* source,
                                        uint64_t sourceOffset,
                                        BufferBase* destination,
@@ -417,6 +432,13 @@ class DeviceBase : public RefCountedWithExternalCount {
     // and backend knows "Pending" commands. "Scheduled" commands are either "Pending" or
     // "Executing".
     bool HasScheduledCommands() const;
+    // Whether commands were submitted to the GPU and didn't complete yet the last time the device
+    // checked for completed serials.
+    bool HasQueueSerialsInFlight();
+    // Blocks until the GPU completes the oldest serial in flight or |timeout| passes. Returns false
+    // if there is no serial in flight to wait for. The completed serials are only acknowledged on
+    // the next Tick.
+    bool WaitForNextQueueSerial(std::chrono::nanoseconds timeout);
     // The serial by which time all currently submitted or pending operations will be completed.
     ExecutionSerial GetScheduledWorkDoneSerial() const;
 
@@ -452,6 +474,34 @@ class DeviceBase : public RefCountedWithExternalCount {
   private:
     void WillDropLastExternalRef() override;
 
+    // Validate a descriptor and look up the cached object matching it without the device lock, so
+    // that the API entry points only take the lock to create new objects. |cached| is set to the
+    // cached object, if any, when the descriptor is valid. The validation result is returned so
+    // that the locked creation path below reports it instead of validating the descriptor again.
+    MaybeError ValidateAndGetCachedBindGroupLayout(const BindGroupLayoutDescriptor* descriptor,
+                                                   Ref<BindGroupLayoutBase>* cached);
+    MaybeError ValidateAndGetCachedPipelineLayout(const PipelineLayoutDescriptor* descriptor,
+                                                  Ref<PipelineLayoutBase>* cached);
+    MaybeError ValidateAndGetCachedSampler(const SamplerDescriptor* descriptor,
+                                           Ref<SamplerBase>* cached);
+    // Create the object for a descriptor that wasn't found in the cache, given the result of its
+    // validation. Must be called with the device lock held.
+    ResultOrError<Ref<BindGroupLayoutBase>> CreateBindGroupLayoutAfterLookup(
+        MaybeError validation,
+        const BindGroupLayoutDescriptor* descriptor);
+    ResultOrError<Ref<PipelineLayoutBase>> CreatePipelineLayoutAfterLookup(
+        MaybeError validation,
+        const PipelineLayoutDescriptor* descriptor);
+    ResultOrError<Ref<SamplerBase>> CreateSamplerAfterLookup(MaybeError validation,
+                                                             const SamplerDescriptor* descriptor);
+
+    // Adds |object| to |cache| and returns it, or returns the equal object that is already cached
+    // if there is one. Only the object that is actually cached is marked as a cached reference so
+    // that only it removes itself from the cache on destruction.
+    template <typename Object, typename CachedType>
+    static Ref<Object> AddOrGetCachedObject(ConcurrentCache<CachedType>* cache,
+                                            Ref<Object> object);
+
     virtual ResultOrError<Ref<BindGroupBase>> CreateBindGroupImpl(
         const BindGroupDescriptor* descriptor) = 0;
     virtual ResultOrError<Ref<BindGroupLayoutBase>> CreateBindGroupLayoutImpl(
@@ -516,6 +566,10 @@ class DeviceBase : public RefCountedWithExternalCount {
     // Each backend should implement to check their passed fences if there are any and return a
     // completed serial. Return 0 should indicate no fences to check.
     virtual ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() = 0;
+    // Each backend should implement to block until the GPU completes |serial| or |timeout| passes.
+    // |serial| is always submitted. Timing out isn't an error.
+    virtual MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                              std::chrono::nanoseconds timeout) = 0;
     // During shut down of device, some operations might have been started since the last submit
     // and waiting on a serial that doesn't have a corresponding fence enqueued. Fake serials to
     // make all commands look completed.
@@ -576,13 +630,16 @@ class DeviceBase : public RefCountedWithExternalCount {
     Ref<TextureViewBase> mExternalTexturePlaceholderView;
 
     std::unique_ptr<DynamicUploader> mDynamicUploader;
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
+    std::unique_ptr<ShaderCompilationStatisticsRecorder> mShaderCompilationStatisticsRecorder;
     std::unique_ptr<AsyncTaskManager> mAsyncTaskManager;
     Ref<QueueBase> mQueue;
 
     struct DeprecationWarnings;
     std::unique_ptr<DeprecationWarnings> mDeprecationWarnings;
 
-    State mState = State::BeingCreated;
+    // Atomic because IsLost() is called without the device lock by the cache lookups above.
+    std::atomic<State> mState{State::BeingCreated};
 
     PerObjectType<ApiObjectList> mObjectLists;
 
@@ -77,14 +77,22 @@ using ResultOrError = Result<T, ErrorData>;
 #define DAWN_MAKE_ERROR(TYPE, MESSAGE) \
     ::dawn::native::ErrorData::Create(TYPE, MESSAGE, __FILE__, __func__, __LINE__)
 
+// Error messages and contexts are only formatted when they are read, see LazyString. The
+// unevaluated absl::StrFormat keeps the compile-time checks of the format strings and arguments.
+#define DAWN_CHECK_ERROR_FORMAT(...) static_cast<void>(sizeof(absl::StrFormat(__VA_ARGS__)))
+
+#define DAWN_MAKE_FORMATTED_ERROR(TYPE, ...) \
+    (DAWN_CHECK_ERROR_FORMAT(__VA_ARGS__),   \
+     ::dawn::native::ErrorData::CreateFormatted(TYPE, __FILE__, __func__, __LINE__, __VA_ARGS__))
+
 #define DAWN_VALIDATION_ERROR(...) \
-    DAWN_MAKE_ERROR(InternalErrorType::Validation, absl::StrFormat(__VA_ARGS__))
+    DAWN_MAKE_FORMATTED_ERROR(InternalErrorType::Validation, __VA_ARGS__)
 
-#define DAWN_INVALID_IF(EXPR, ...)                                                           \
-    if (DAWN_UNLIKELY(EXPR)) {                                                               \
-        return DAWN_MAKE_ERROR(InternalErrorType::Validation, absl::StrFormat(__VA_ARGS__)); \
-    }                                                                                        \
-    for (;;)                                                                                 \
+#define DAWN_INVALID_IF(EXPR, ...)                 \
+    if (DAWN_UNLIKELY(EXPR)) {                     \
+        return DAWN_VALIDATION_ERROR(__VA_ARGS__); \
+    }                                              \
+    for (;;)                                       \
     break
 
 // DAWN_MAKE_DEPRECATION_ERROR is used at deprecation paths. It returns a MaybeError.
@@ -112,7 +120,7 @@ using ResultOrError = Result<T, ErrorData>;
 #define DAWN_INTERNAL_ERROR(MESSAGE) DAWN_MAKE_ERROR(InternalErrorType::Internal, MESSAGE)
 
 #define DAWN_FORMAT_INTERNAL_ERROR(...) \
-    DAWN_MAKE_ERROR(InternalErrorType::Internal, absl::StrFormat(__VA_ARGS__))
+    DAWN_MAKE_FORMATTED_ERROR(InternalErrorType::Internal, __VA_ARGS__)
 
 #define DAWN_UNIMPLEMENTED_ERROR(MESSAGE) \
     DAWN_MAKE_ERROR(InternalErrorType::Internal, std::string("Unimplemented: ") + MESSAGE)
@@ -131,8 +139,11 @@ using ResultOrError = Result<T, ErrorData>;
 // the current function.
 #define DAWN_TRY(EXPR) DAWN_TRY_WITH_CLEANUP(EXPR, {})
 
-#define DAWN_TRY_CONTEXT(EXPR, ...) \
-    DAWN_TRY_WITH_CLEANUP(EXPR, { error->AppendContext(absl::StrFormat(__VA_ARGS__)); })
+#define DAWN_TRY_CONTEXT(EXPR, ...)           \
+    DAWN_TRY_WITH_CLEANUP(EXPR, {             \
+        DAWN_CHECK_ERROR_FORMAT(__VA_ARGS__); \
+        error->AppendContext(__VA_ARGS__);    \
+    })
 
 #define DAWN_TRY_WITH_CLEANUP(EXPR, BODY)                                                     \
     {                                                                                         \
@@ -151,7 +162,10 @@ using ResultOrError = Result<T, ErrorData>;
 // any, to VAR.
 #define DAWN_TRY_ASSIGN(VAR, EXPR) DAWN_TRY_ASSIGN_WITH_CLEANUP(VAR, EXPR, {})
 #define DAWN_TRY_ASSIGN_CONTEXT(VAR, EXPR, ...) \
-    DAWN_TRY_ASSIGN_WITH_CLEANUP(VAR, EXPR, { error->AppendContext(absl::StrFormat(__VA_ARGS__)); })
+    DAWN_TRY_ASSIGN_WITH_CLEANUP(VAR, EXPR, {   \
+        DAWN_CHECK_ERROR_FORMAT(__VA_ARGS__);   \
+        error->AppendContext(__VA_ARGS__);      \
+    })
 
 // Argument helpers are used to determine which macro implementations should be called when
 // overloading with different number of variables.
@@ -17,22 +17,95 @@
 #include <utility>
 
 #include "dawn/native/Error.h"
+#include "dawn/native/Device.h"
 #include "dawn/native/ObjectBase.h"
+#include "dawn/native/ObjectType_autogen.h"
+#include "dawn/native/Texture.h"
 #include "dawn/native/dawn_platform.h"
 
 namespace dawn::native {
 
+CapturedObject CaptureObject(const ApiObjectBase* object) {
+    CapturedObject captured;
+    if (object == nullptr) {
+        return captured;
+    }
+    captured.typeName = ObjectTypeAsString(object->GetType());
+    captured.isError = object->IsError();
+    captured.label = object->GetLabel();
+    if (object->GetType() == ObjectType::TextureView) {
+        captured.textureLabel =
+            static_cast<const TextureViewBase*>(object)->GetTexture()->GetLabel();
+    }
+    return captured;
+}
+
+CapturedObject CaptureObject(const DeviceBase* device) {
+    CapturedObject captured;
+    if (device == nullptr) {
+        return captured;
+    }
+    captured.typeName = "Device";
+    captured.label = device->GetLabel();
+    return captured;
+}
+
+absl::FormatConvertResult<absl::FormatConversionCharSet::kString> AbslFormatConvert(
+    const CapturedObject& value,
+    const absl::FormatConversionSpec& spec,
+    absl::FormatSink* s) {
+    if (value.typeName == nullptr) {
+        s->Append("[null]");
+        return {true};
+    }
+    s->Append("[");
+    if (value.isError) {
+        s->Append("Invalid ");
+    }
+    s->Append(value.typeName);
+    if (!value.label.empty()) {
+        s->Append(absl::StrFormat(" \"%s\"", value.label));
+    }
+    if (!value.textureLabel.empty()) {
+        s->Append(absl::StrFormat(" of Texture \"%s\"", value.textureLabel));
+    }
+    s->Append("]");
+    return {true};
+}
+
+LazyString::LazyString(std::string value) : mValue(std::move(value)) {}
+
+LazyString::LazyString(const char* value) : mValue(value) {}
+
+LazyString::LazyString(std::unique_ptr<Formatter> formatter) : mFormatter(std::move(formatter)) {}
+
+LazyString::~LazyString() = default;
+
+LazyString::LazyString(LazyString&& other) = default;
+
+LazyString& LazyString::operator=(LazyString&& other) = default;
+
+const std::string& LazyString::Get() const {
+    if (mFormatter != nullptr) {
+        mValue = mFormatter->Format();
+        mFormatter = nullptr;
+    }
+    return mValue;
+}
+
+LazyString::Formatter::~Formatter() = default;
+
 std::unique_ptr<ErrorData> ErrorData::Create(InternalErrorType type,
-                                             std::string message,
+                                             LazyString message,
                                              const char* file,
                                              const char* function,
                                              int line) {
-    std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, message);
+    std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, std::move(message));
     error->AppendBacktrace(file, function, line);
     return error;
 }
 
-ErrorData::ErrorData(InternalErrorType type, std::string message)
+ErrorData::ErrorData(InternalErrorType type, LazyString message)
     : mType(type), mMessage(std::move(message)) {}
 
 ErrorData::~ErrorData() = default;
@@ -47,7 +120,7 @@ void ErrorData::AppendBacktrace(const char* file, const char* function, int line
 }
 
 void ErrorData::AppendContext(std::string context) {
-    mContexts.push_back(std::move(context));
+    mContexts.emplace_back(std::move(context));
 }
 
 void ErrorData::AppendDebugGroup(std::string label) {
@@ -63,15 +136,20 @@ InternalErrorType ErrorData::GetType() const {
 }
 
 const std::string& ErrorData::GetMessage() const {
-    return mMessage;
+    return mMessage.Get();
 }
 
 const std::vector<ErrorData::BacktraceRecord>& ErrorData::GetBacktrace() const {
     return mBacktrace;
 }
 
-const std::vector<std::string>& ErrorData::GetContexts() const {
-    return mContexts;
+std::vector<std::string> ErrorData::GetContexts() const {
+    std::vector<std::string> contexts;
+    contexts.reserve(mContexts.size());
+    for (const LazyString& context : mContexts) {
+        contexts.push_back(context.Get());
+    }
+    return contexts;
 }
 
 const std::vector<std::string>& ErrorData::GetDebugGroups() const {
@@ -84,11 +162,11 @@ const std::vector<std::string>& ErrorData::GetBackendMessages() const {
 
 std::string ErrorData::GetFormattedMessage() const {
     std::ostringstream ss;
-    ss << mMessage << "\n";
+    ss << mMessage.Get() << "\n";
 
     if (!mContexts.empty()) {
-        for (auto context : mContexts) {
-            ss << " - While " << context << "\n";
+        for (const LazyString& context : mContexts) {
+            ss << " - While " << context.Get() << "\n";
         }
     }
 
@@ -18,6 +18,9 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -34,15 +37,122 @@ using ErrorType = wgpu::ErrorType;
 
 namespace dawn::native {
 enum class InternalErrorType : uint32_t;
+class ApiObjectBase;
+class DeviceBase;
+
+// The parts of an object that are shown when it is formatted, see webgpu_absl_format.h. Objects are
+// captured this way by LazyString instead of being referenced, so that errors don't keep them
+// alive.
+struct CapturedObject {
+    // The type of the object, or nullptr if the object is null.
+    const char* typeName = nullptr;
+    bool isError = false;
+    std::string label;
+    // The label of the texture of a texture view.
+    std::string textureLabel;
+};
+CapturedObject CaptureObject(const ApiObjectBase* object);
+CapturedObject CaptureObject(const DeviceBase* device);
+
+absl::FormatConvertResult<absl::FormatConversionCharSet::kString> AbslFormatConvert(
+    const CapturedObject& value,
+    const absl::FormatConversionSpec& spec,
+    absl::FormatSink* s);
+
+// The label of a descriptor, which is the only part of it that is shown when it is formatted.
+template <typename Descriptor>
+struct CapturedDescriptor {
+    bool isNull = false;
+    bool hasLabel = false;
+    std::string label;
+};
+
+template <typename Descriptor>
+absl::FormatConvertResult<absl::FormatConversionCharSet::kString> AbslFormatConvert(
+    const CapturedDescriptor<Descriptor>& value,
+    const absl::FormatConversionSpec& spec,
+    absl::FormatSink* s) {
+    if (value.isNull) {
+        s->Append("[null]");
+        return {true};
+    }
+    // Format a descriptor with the same label so that the output matches the descriptor's.
+    Descriptor descriptor = {};
+    descriptor.label = value.hasLabel ? value.label.c_str() : nullptr;
+    return AbslFormatConvert(&descriptor, spec, s);
+}
+
+// A string that can be given as a format string and its arguments, and that is only formatted when
+// it is read. Most errors are dropped without their message being looked at (for example when an
+// error scope already captured an error) so this avoids formatting them. Since the string can be
+// read after the arguments went out of scope, they are copied: numbers and enums are kept as they
+// are, strings are copied, and objects and descriptors are reduced to their type and label. Other
+// arguments are formatted right away with "%s". The format string itself must outlive the
+// LazyString, which is the case for the string literals used in the error macros.
+class LazyString {
+  public:
+    LazyString(std::string value);  // NOLINT(runtime/explicit)
+    LazyString(const char* value);  // NOLINT(runtime/explicit)
+    ~LazyString();
+
+    LazyString(LazyString&& other);
+    LazyString& operator=(LazyString&& other);
+
+    template <typename... Args>
+    static LazyString Format(const char* formatStr, const Args&... args);
+
+    // Formats the string the first time it is called.
+    const std::string& Get() const;
+
+  private:
+    class Formatter {
+      public:
+        virtual ~Formatter();
+        virtual std::string Format() const = 0;
+    };
+
+    template <typename... CapturedArgs>
+    class FormatterImpl;
+
+    template <typename T, typename = void>
+    struct IsLabeledDescriptorPointer : std::false_type {};
+    template <typename T>
+    struct IsLabeledDescriptorPointer<
+        T,
+        std::enable_if_t<std::is_pointer_v<T> &&
+                         std::is_same_v<decltype(std::remove_pointer_t<T>::label), const char*>>>
+        : std::true_type {};
+
+    template <typename T>
+    static auto CaptureArg(const T& value, bool* success);
+
+    template <typename... Args>
+    static std::string FormatNow(const char* formatStr, const Args&... args);
+
+    explicit LazyString(std::unique_ptr<Formatter> formatter);
+
+    mutable std::string mValue;
+    mutable std::unique_ptr<Formatter> mFormatter;
+};
 
 class [[nodiscard]] ErrorData {
   public:
     [[nodiscard]] static std::unique_ptr<ErrorData> Create(InternalErrorType type,
-                                                           std::string message,
+                                                           LazyString message,
                                                            const char* file,
                                                            const char* function,
                                                            int line);
-    ErrorData(InternalErrorType type, std::string message);
+    // Creates an error whose message is formatted only when it is read.
+    template <typename... Args>
+    [[nodiscard]] static std::unique_ptr<ErrorData> CreateFormatted(InternalErrorType type,
+                                                                    const char* file,
+                                                                    const char* function,
+                                                                    int line,
+                                                                    const char* formatStr,
+                                                                    const Args&... args) {
+        return Create(type, LazyString::Format(formatStr, args...), file, function, line);
+    }
+    ErrorData(InternalErrorType type, LazyString message);
     ~ErrorData();
 
     struct BacktraceRecord {
@@ -52,15 +162,10 @@ class [[nodiscard]] ErrorData {
     };
     void AppendBacktrace(const char* file, const char* function, int line);
     void AppendContext(std::string context);
+    // The context is formatted only when it is read.
     template <typename... Args>
     void AppendContext(const char* formatStr, const Args&... args) {
-        std::string out;
-        absl::UntypedFormatSpec format(formatStr);
-        if (absl::FormatUntyped(&out, format, {absl::FormatArg(args)...})) {
-            AppendContext(std::move(out));
-        } else {
-            AppendContext(absl::StrFormat("[Failed to format error: \"%s\"]", formatStr));
-        }
+        mContexts.push_back(LazyString::Format(formatStr, args...));
     }
     void AppendDebugGroup(std::string label);
     void AppendBackendMessage(std::string message);
@@ -68,7 +173,7 @@ class [[nodiscard]] ErrorData {
     InternalErrorType GetType() const;
     const std::string& GetMessage() const;
     const std::vector<BacktraceRecord>& GetBacktrace() const;
-    const std::vector<std::string>& GetContexts() const;
+    std::vector<std::string> GetContexts() const;
     const std::vector<std::string>& GetDebugGroups() const;
     const std::vector<std::string>& GetBackendMessages() const;
 
@@ -76,13 +181,84 @@ class [[nodiscard]] ErrorData {
 
   private:
     InternalErrorType mType;
-    std::string mMessage;
+    LazyString mMessage;
     std::vector<BacktraceRecord> mBacktrace;
-    std::vector<std::string> mContexts;
+    std::vector<LazyString> mContexts;
     std::vector<std::string> mDebugGroups;
     std::vector<std::string> mBackendMessages;
 };
 
+template <typename... CapturedArgs>
+class LazyString::FormatterImpl final : public LazyString::Formatter {
+  public:
+    FormatterImpl(const char* formatStr, std::tuple<CapturedArgs...> args)
+        : mFormatStr(formatStr), mArgs(std::move(args)) {}
+
+    std::string Format() const override {
+        return std::apply(
+            [this](const CapturedArgs&... args) { return FormatNow(mFormatStr, args...); }, mArgs);
+    }
+
+  private:
+    const char* mFormatStr;
+    std::tuple<CapturedArgs...> mArgs;
+};
+
+template <typename T>
+auto LazyString::CaptureArg(const T& value, bool* success) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+        return value;
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        if constexpr (std::is_pointer_v<T>) {
+            if (value == nullptr) {
+                *success = false;
+                return std::string();
+            }
+        }
+        return std::string(std::string_view(value));
+    } else if constexpr (std::is_convertible_v<const T&, const ApiObjectBase*>) {
+        return CaptureObject(static_cast<const ApiObjectBase*>(value));
+    } else if constexpr (std::is_convertible_v<const T&, const DeviceBase*>) {
+        return CaptureObject(static_cast<const DeviceBase*>(value));
+    } else if constexpr (IsLabeledDescriptorPointer<T>::value) {
+        CapturedDescriptor<std::remove_cv_t<std::remove_pointer_t<T>>> descriptor;
+        descriptor.isNull = value == nullptr;
+        if (value != nullptr && value->label != nullptr) {
+            descriptor.hasLabel = true;
+            descriptor.label = value->label;
+        }
+        return descriptor;
+    } else {
+        std::string out;
+        if (!absl::FormatUntyped(&out, absl::UntypedFormatSpec("%s"), {absl::FormatArg(value)})) {
+            *success = false;
+        }
+        return out;
+    }
+}
+
+template <typename... Args>
+std::string LazyString::FormatNow(const char* formatStr, const Args&... args) {
+    std::string out;
+    absl::UntypedFormatSpec format(formatStr);
+    if (!absl::FormatUntyped(&out, format, {absl::FormatArg(args)...})) {
+        return absl::StrFormat("[Failed to format error: \"%s\"]", formatStr);
+    }
+    return out;
+}
+
+template <typename... Args>
+LazyString LazyString::Format(const char* formatStr, const Args&... args) {
+    bool success = true;
+    auto capturedArgs = std::make_tuple(CaptureArg(args, &success)...);
+    if (!success) {
+        // One of the arguments can't be captured, format the whole string right away instead.
+        return LazyString(FormatNow(formatStr, args...));
+    }
+    return LazyString(std::make_unique<FormatterImpl<decltype(CaptureArg(args, &success))...>>(
+        formatStr, std::move(capturedArgs)));
+}
+
 }  // namespace dawn::native
 
 #endif  // SRC_DAWN_NATIVE_ERRORDATA_H_
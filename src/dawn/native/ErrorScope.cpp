@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "dawn/common/Assert.h"
+#include "dawn/native/ErrorData.h"
 
 namespace dawn::native {
 
@@ -66,7 +67,7 @@ bool ErrorScopeStack::Empty() const {
     return mScopes.empty();
 }
 
-bool ErrorScopeStack::HandleError(wgpu::ErrorType type, const char* message) {
+bool ErrorScopeStack::HandleError(wgpu::ErrorType type, const ErrorData& error) {
     for (auto it = mScopes.rbegin(); it != mScopes.rend(); ++it) {
         if (it->mMatchedErrorType != type) {
             // Error filter does not match. Move on to the next scope.
@@ -77,14 +78,14 @@ bool ErrorScopeStack::HandleError(wgpu::ErrorType type, const char* message) {
         // Record the error if the scope doesn't have one yet.
         if (it->mCapturedError == wgpu::ErrorType::NoError) {
             it->mCapturedError = type;
-            it->mErrorMessage = message;
+            it->mErrorMessage = error.GetFormattedMessage();
         }
 
         if (type == wgpu::ErrorType::DeviceLost) {
             if (it->mCapturedError != wgpu::ErrorType::DeviceLost) {
                 // DeviceLost overrides any other error that is not a DeviceLost.
                 it->mCapturedError = type;
-                it->mErrorMessage = message;
+                it->mErrorMessage = error.GetFormattedMessage();
             }
         } else {
             // Errors that are not device lost are captured and stop propogating.
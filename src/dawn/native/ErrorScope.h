@@ -22,6 +22,8 @@
 
 namespace dawn::native {
 
+class ErrorData;
+
 class ErrorScope {
   public:
     wgpu::ErrorType GetErrorType() const;
@@ -48,8 +50,9 @@ class ErrorScopeStack {
 
     // Pass an error to the scopes in the stack. Returns true if one of the scopes
     // captured the error. Returns false if the error should be forwarded to the
-    // uncaptured error callback.
-    bool HandleError(wgpu::ErrorType type, const char* message);
+    // uncaptured error callback. The message of the error is only formatted if a
+    // scope records it.
+    bool HandleError(wgpu::ErrorType type, const ErrorData& error);
 
   private:
     std::vector<ErrorScope> mScopes;
@@ -0,0 +1,91 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/EventManager.h"
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+EventManager::EventManager() = default;
+
+EventManager::~EventManager() = default;
+
+FutureID EventManager::TrackFuture(FutureKind kind) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    FutureID future = mNextFutureID++;
+    mPendingFutures.emplace(future, kind);
+    return future;
+}
+
+void EventManager::CompleteFuture(FutureID future) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        size_t erased = mPendingFutures.erase(future);
+        ASSERT(erased == 1);
+        mGeneration++;
+    }
+    mCondition.notify_all();
+}
+
+bool EventManager::AreFuturesKnown(const FutureWaitInfo* futures, size_t count) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (size_t i = 0; i < count; ++i) {
+        if (futures[i].future == 0 || futures[i].future >= mNextFutureID) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EventManager::UpdateCompletedFutures(FutureWaitInfo* futures, size_t count) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    bool anyCompleted = false;
+    for (size_t i = 0; i < count; ++i) {
+        futures[i].completed = mPendingFutures.count(futures[i].future) == 0;
+        anyCompleted = anyCompleted || futures[i].completed;
+    }
+    return anyCompleted;
+}
+
+bool EventManager::ArePendingFuturesQueueSerial(const FutureWaitInfo* futures, size_t count) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (size_t i = 0; i < count; ++i) {
+        auto it = mPendingFutures.find(futures[i].future);
+        if (it != mPendingFutures.end() && it->second != FutureKind::QueueSerial) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EventManager::NotifyWaiters() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mGeneration++;
+    }
+    mCondition.notify_all();
+}
+
+uint64_t EventManager::GetNotificationGeneration() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mGeneration;
+}
+
+void EventManager::WaitForNotification(uint64_t generation, std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait_for(lock, timeout, [&] { return mGeneration != generation; });
+}
+
+}  // namespace dawn::native
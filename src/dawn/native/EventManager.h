@@ -0,0 +1,78 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_EVENTMANAGER_H_
+#define SRC_DAWN_NATIVE_EVENTMANAGER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "dawn/common/RefCounted.h"
+#include "dawn/native/DawnNative.h"
+
+namespace dawn::native {
+
+using FutureID = uint64_t;
+
+// Tracks the futures of an instance and lets threads sleep until something happens that may
+// complete one of them: a future completing, or a callback becoming ready to be called by
+// ProcessEvents, for example when a worker thread finishes an asynchronous pipeline creation.
+class EventManager : public RefCounted {
+  public:
+    EventManager();
+    ~EventManager() override;
+
+    // How a future gets completed, which decides what a thread waiting on it can block on.
+    enum class FutureKind {
+        // Completed once the GPU finishes the work submitted to a queue, like MapAsync.
+        QueueSerial,
+        // Completed by a callback that other threads make ready, like CreatePipelineAsync.
+        CallbackTask,
+    };
+
+    FutureID TrackFuture(FutureKind kind);
+    void CompleteFuture(FutureID future);
+
+    // Returns whether all the futures were returned by TrackFuture.
+    bool AreFuturesKnown(const FutureWaitInfo* futures, size_t count);
+    // Sets |completed| for each of the completed futures and returns whether any of them are.
+    bool UpdateCompletedFutures(FutureWaitInfo* futures, size_t count);
+    // Returns whether all the pending futures in |futures| are QueueSerial futures, in which case
+    // waiting for the GPU is what lets them complete.
+    bool ArePendingFuturesQueueSerial(const FutureWaitInfo* futures, size_t count);
+
+    // Wakes up the threads waiting in WaitForNotification.
+    void NotifyWaiters();
+    // The notification generation changes each time waiters are notified. Reading it before
+    // checking for events and passing it to WaitForNotification ensures that notifications in
+    // between aren't missed.
+    uint64_t GetNotificationGeneration();
+    void WaitForNotification(uint64_t generation, std::chrono::nanoseconds timeout);
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint64_t mGeneration = 0;
+    FutureID mNextFutureID = 1;
+    // Futures that were returned by TrackFuture and haven't completed yet. Completed futures
+    // aren't stored so that futures that are never waited on don't accumulate.
+    std::unordered_map<FutureID, FutureKind> mPendingFutures;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_EVENTMANAGER_H_
@@ -136,7 +136,15 @@ IndirectDrawMetadata::GetIndexedIndirectBufferValidationInfo() {
     return &mIndexedIndirectBufferValidationInfo;
 }
 
+bool IndirectDrawMetadata::IsEmpty() const {
+    return mIndexedIndirectBufferValidationInfo.empty();
+}
+
 void IndirectDrawMetadata::AddBundle(RenderBundleBase* bundle) {
+    if (bundle->GetIndirectDrawMetadata().IsEmpty()) {
+        return;
+    }
+
     auto [_, inserted] = mAddedBundles.insert(bundle);
     if (!inserted) {
         return;
@@ -117,6 +117,12 @@ class IndirectDrawMetadata : public NonCopyable {
 
     IndexedIndirectBufferValidationInfoMap* GetIndexedIndirectBufferValidationInfo();
 
+    // Whether no indirect draws were added, which is the case for most render bundles.
+    bool IsEmpty() const;
+
+    // Adds the indirect draws of |bundle|. Bundles without indirect draws are skipped without
+    // any allocation. Other bundles are added only once, but they still allocate in the
+    // de-duplication set and in the per-config map of validation info.
     void AddBundle(RenderBundleBase* bundle);
     void AddIndexedIndirectDraw(wgpu::IndexFormat indexFormat,
                                 uint64_t indexBufferSize,
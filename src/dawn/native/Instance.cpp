@@ -14,6 +14,9 @@
 
 #include "dawn/native/Instance.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <utility>
 
 #include "dawn/common/Assert.h"
@@ -24,6 +27,7 @@
 #include "dawn/native/ChainUtils_autogen.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/ErrorData.h"
+#include "dawn/native/EventManager.h"
 #include "dawn/native/Surface.h"
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
@@ -111,6 +115,13 @@ dawn::platform::CachingInterface* GetCachingInterface(dawn::platform::Platform*
     return nullptr;
 }
 
+size_t GetCachingMemoryBudget(dawn::platform::Platform* platform) {
+    if (platform != nullptr) {
+        return platform->GetCachingMemoryBudget();
+    }
+    return 0;
+}
+
 }  // anonymous namespace
 
 InstanceBase* APICreateInstance(const InstanceDescriptor* descriptor) {
@@ -181,7 +192,8 @@ MaybeError InstanceBase::Initialize(const InstanceDescriptor* descriptor) {
     }
     mRuntimeSearchPaths.push_back("");
 
-    mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
+    mEventManager = AcquireRef(new EventManager());
+    mCallbackTaskManager = AcquireRef(new CallbackTaskManager(mEventManager));
 
     // Initialize the platform to the default for now.
     mDefaultPlatform = std::make_unique<dawn::platform::Platform>();
@@ -503,7 +515,8 @@ void InstanceBase::SetPlatform(dawn::platform::Platform* platform) {
     } else {
         mPlatform = platform;
     }
-    mBlobCache = std::make_unique<BlobCache>(GetCachingInterface(platform));
+    mBlobCache = std::make_unique<BlobCache>(GetCachingInterface(platform),
+                                             GetCachingMemoryBudget(platform));
 }
 
 void InstanceBase::SetPlatformForTesting(dawn::platform::Platform* platform) {
@@ -521,6 +534,10 @@ BlobCache* InstanceBase::GetBlobCache(bool enabled) {
     return &mPassthroughBlobCache;
 }
 
+BlobCacheStats InstanceBase::GetBlobCacheStats() {
+    return mBlobCache->GetStats();
+}
+
 uint64_t InstanceBase::GetDeviceCountForTesting() const {
     std::lock_guard<std::mutex> lg(mDevicesListMutex);
     return mDevicesList.size();
@@ -563,6 +580,79 @@ const Ref<CallbackTaskManager>& InstanceBase::GetCallbackTaskManager() const {
     return mCallbackTaskManager;
 }
 
+const Ref<EventManager>& InstanceBase::GetEventManager() const {
+    return mEventManager;
+}
+
+std::vector<Ref<DeviceBase>> InstanceBase::GetDevicesWithQueueSerialsInFlight() {
+    std::vector<Ref<DeviceBase>> devices;
+    {
+        std::lock_guard<std::mutex> lg(mDevicesListMutex);
+        for (auto device : mDevicesList) {
+            devices.push_back(device);
+        }
+    }
+
+    std::vector<Ref<DeviceBase>> busyDevices;
+    for (auto& device : devices) {
+        if (device->HasQueueSerialsInFlight()) {
+            busyDevices.push_back(std::move(device));
+        }
+    }
+    return busyDevices;
+}
+
+WaitStatus InstanceBase::WaitAny(size_t count, FutureWaitInfo* futures, uint64_t timeoutNS) {
+    using Clock = std::chrono::steady_clock;
+
+    // Callbacks made ready by other threads, like the worker threads creating pipelines, wake the
+    // waiter through the event manager. The GPU finishing work doesn't, so when only the GPU of a
+    // single device can complete the futures the waiter blocks on the fence of that device instead.
+    // The device lock is held during that wait, so it is bounded to let other threads use the
+    // device.
+    constexpr std::chrono::nanoseconds kMaxQueueSerialWait = std::chrono::milliseconds(10);
+    // When the futures can also be completed by callbacks, or several devices have work in flight,
+    // the waiter can't block on a single fence. The wait is then split in slices after which the
+    // devices are ticked again.
+    constexpr std::chrono::nanoseconds kGPUPollingInterval = std::chrono::milliseconds(1);
+    // Clamp the timeout so that the deadline doesn't overflow. This is still hundreds of years.
+    constexpr uint64_t kMaxTimeoutNS = uint64_t(std::numeric_limits<int64_t>::max()) / 2;
+
+    if (!mEventManager->AreFuturesKnown(futures, count)) {
+        return WaitStatus::UnknownFuture;
+    }
+
+    const Clock::time_point deadline =
+        Clock::now() + std::chrono::nanoseconds(std::min(timeoutNS, kMaxTimeoutNS));
+    while (true) {
+        uint64_t generation = mEventManager->GetNotificationGeneration();
+        bool hasMoreEvents = APIProcessEvents();
+        if (count == 0 || mEventManager->UpdateCompletedFutures(futures, count)) {
+            return WaitStatus::Success;
+        }
+
+        Clock::time_point now = Clock::now();
+        if (now >= deadline) {
+            return WaitStatus::TimedOut;
+        }
+
+        std::chrono::nanoseconds timeout = deadline - now;
+        if (hasMoreEvents) {
+            std::vector<Ref<DeviceBase>> busyDevices = GetDevicesWithQueueSerialsInFlight();
+            if (busyDevices.size() == 1 &&
+                mEventManager->ArePendingFuturesQueueSerial(futures, count) &&
+                mEventManager->GetNotificationGeneration() == generation &&
+                busyDevices[0]->WaitForNextQueueSerial(std::min(timeout, kMaxQueueSerialWait))) {
+                continue;
+            }
+            if (!busyDevices.empty()) {
+                timeout = std::min(timeout, kGPUPollingInterval);
+            }
+        }
+        mEventManager->WaitForNotification(generation, timeout);
+    }
+}
+
 void InstanceBase::ConsumeError(std::unique_ptr<ErrorData> error) {
     ASSERT(error != nullptr);
     dawn::ErrorLog() << error->GetFormattedMessage();
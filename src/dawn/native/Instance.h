@@ -40,6 +40,7 @@ class Platform;
 namespace dawn::native {
 
 class CallbackTaskManager;
+class EventManager;
 class DeviceBase;
 class Surface;
 class XlibXcbFunctions;
@@ -105,6 +106,7 @@ class InstanceBase final : public RefCountedWithExternalCount {
     void SetPlatformForTesting(dawn::platform::Platform* platform);
     dawn::platform::Platform* GetPlatform();
     BlobCache* GetBlobCache(bool enabled = true);
+    BlobCacheStats GetBlobCacheStats();
 
     uint64_t GetDeviceCountForTesting() const;
     void AddDevice(DeviceBase* device);
@@ -113,6 +115,11 @@ class InstanceBase final : public RefCountedWithExternalCount {
     const std::vector<std::string>& GetRuntimeSearchPaths() const;
 
     const Ref<CallbackTaskManager>& GetCallbackTaskManager() const;
+    const Ref<EventManager>& GetEventManager() const;
+
+    // Processes events until one of |futures| completes or the timeout passes, sleeping while
+    // there is nothing to process.
+    WaitStatus WaitAny(size_t count, FutureWaitInfo* futures, uint64_t timeoutNS);
 
     // Get backend-independent libraries that need to be loaded dynamically.
     const XlibXcbFunctions* GetOrCreateXlibXcbFunctions();
@@ -141,6 +148,9 @@ class InstanceBase final : public RefCountedWithExternalCount {
 
     void ConsumeError(std::unique_ptr<ErrorData> error);
 
+    // Returns the devices that have work in flight on the GPU.
+    std::vector<Ref<DeviceBase>> GetDevicesWithQueueSerialsInFlight();
+
     std::vector<std::string> mRuntimeSearchPaths;
 
     BackendsBitset mBackendsConnected;
@@ -168,6 +178,7 @@ class InstanceBase final : public RefCountedWithExternalCount {
     std::unique_ptr<XlibXcbFunctions> mXlibXcbFunctions;
 #endif  // defined(DAWN_USE_X11)
 
+    Ref<EventManager> mEventManager;
     Ref<CallbackTaskManager> mCallbackTaskManager;
 
     std::set<DeviceBase*> mDevicesList;
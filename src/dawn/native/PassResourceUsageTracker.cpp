@@ -35,23 +35,30 @@ SyncScopeUsageTracker::~SyncScopeUsageTracker() = default;
 SyncScopeUsageTracker& SyncScopeUsageTracker::operator=(SyncScopeUsageTracker&&) = default;
 
 void SyncScopeUsageTracker::BufferUsedAs(BufferBase* buffer, wgpu::BufferUsage usage) {
-    // std::map's operator[] will create the key and return 0 if the key didn't exist
-    // before.
-    mBufferUsages[buffer] |= usage;
+    auto [it, inserted] = mBufferSlots.emplace(buffer, static_cast<uint32_t>(mBuffers.size()));
+    if (inserted) {
+        mBuffers.push_back(buffer);
+        mBufferUsages.push_back(wgpu::BufferUsage::None);
+    }
+    mBufferUsages[it->second] |= usage;
+}
+
+TextureSubresourceUsage& SyncScopeUsageTracker::GetOrCreateTextureUsage(TextureBase* texture) {
+    auto [it, inserted] = mTextureSlots.emplace(texture, static_cast<uint32_t>(mTextures.size()));
+    if (inserted) {
+        // New usages are initially filled with wgpu::TextureUsage::None.
+        mTextures.push_back(texture);
+        mTextureUsages.emplace_back(texture->GetFormat().aspects, texture->GetArrayLayers(),
+                                    texture->GetNumMipLevels(), wgpu::TextureUsage::None);
+    }
+    return mTextureUsages[it->second];
 }
 
 void SyncScopeUsageTracker::TextureViewUsedAs(TextureViewBase* view, wgpu::TextureUsage usage) {
     TextureBase* texture = view->GetTexture();
     const SubresourceRange& range = view->GetSubresourceRange();
 
-    // Get or create a new TextureSubresourceUsage for that texture (initially filled with
-    // wgpu::TextureUsage::None)
-    auto it = mTextureUsages.emplace(
-        std::piecewise_construct, std::forward_as_tuple(texture),
-        std::forward_as_tuple(texture->GetFormat().aspects, texture->GetArrayLayers(),
-                              texture->GetNumMipLevels(), wgpu::TextureUsage::None));
-    TextureSubresourceUsage& textureUsage = it.first->second;
-
+    TextureSubresourceUsage& textureUsage = GetOrCreateTextureUsage(texture);
     textureUsage.Update(range, [usage](const SubresourceRange&, wgpu::TextureUsage* storedUsage) {
         // TODO(crbug.com/dawn/1001): Consider optimizing to have fewer
         // branches.
@@ -67,26 +74,37 @@ void SyncScopeUsageTracker::TextureViewUsedAs(TextureViewBase* view, wgpu::Textu
     });
 }
 
-void SyncScopeUsageTracker::AddRenderBundleTextureUsage(
-    TextureBase* texture,
-    const TextureSubresourceUsage& textureUsage) {
-    // Get or create a new TextureSubresourceUsage for that texture (initially filled with
-    // wgpu::TextureUsage::None)
-    auto it = mTextureUsages.emplace(
-        std::piecewise_construct, std::forward_as_tuple(texture),
-        std::forward_as_tuple(texture->GetFormat().aspects, texture->GetArrayLayers(),
-                              texture->GetNumMipLevels(), wgpu::TextureUsage::None));
-    TextureSubresourceUsage* passTextureUsage = &it.first->second;
-
-    passTextureUsage->Merge(textureUsage,
-                            [](const SubresourceRange&, wgpu::TextureUsage* storedUsage,
-                               const wgpu::TextureUsage& addedUsage) {
-                                ASSERT((addedUsage & wgpu::TextureUsage::RenderAttachment) == 0);
-                                *storedUsage |= addedUsage;
-                            });
+void SyncScopeUsageTracker::AddRenderBundleUsage(const SyncScopeResourceUsage& bundleUsage) {
+    // Make room for all the resources of the bundle at once so that replaying many bundles
+    // doesn't rehash the slot maps repeatedly.
+    mBufferSlots.reserve(mBuffers.size() + bundleUsage.buffers.size());
+    mTextureSlots.reserve(mTextures.size() + bundleUsage.textures.size());
+
+    for (size_t i = 0; i < bundleUsage.buffers.size(); ++i) {
+        BufferUsedAs(bundleUsage.buffers[i], bundleUsage.bufferUsages[i]);
+    }
+
+    for (size_t i = 0; i < bundleUsage.textures.size(); ++i) {
+        TextureSubresourceUsage& passTextureUsage =
+            GetOrCreateTextureUsage(bundleUsage.textures[i]);
+        passTextureUsage.Merge(bundleUsage.textureUsages[i],
+                               [](const SubresourceRange&, wgpu::TextureUsage* storedUsage,
+                                  const wgpu::TextureUsage& addedUsage) {
+                                   ASSERT((addedUsage & wgpu::TextureUsage::RenderAttachment) ==
+                                          0);
+                                   *storedUsage |= addedUsage;
+                               });
+    }
 }
 
 void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
+    // Bind groups only add usages that can be combined with themselves, so adding the same bind
+    // group again doesn't change the usages of the scope. This is common when a bind group is
+    // set for many draws or dispatches.
+    if (!mAddedBindGroups.insert(group).second) {
+        return;
+    }
+
     for (BindingIndex bindingIndex{0}; bindingIndex < group->GetLayout()->GetBindingCount();
          ++bindingIndex) {
         const BindingInfo& bindingInfo = group->GetLayout()->GetBindingInfo(bindingIndex);
@@ -141,34 +159,29 @@ void SyncScopeUsageTracker::AddBindGroup(BindGroupBase* group) {
     }
 
     for (const Ref<ExternalTextureBase>& externalTexture : group->GetBoundExternalTextures()) {
-        mExternalTextureUsages.insert(externalTexture.Get());
+        if (mExternalTextureSet.insert(externalTexture.Get()).second) {
+            mExternalTextures.push_back(externalTexture.Get());
+        }
     }
 }
 
 SyncScopeResourceUsage SyncScopeUsageTracker::AcquireSyncScopeUsage() {
     SyncScopeResourceUsage result;
-    result.buffers.reserve(mBufferUsages.size());
-    result.bufferUsages.reserve(mBufferUsages.size());
-    result.textures.reserve(mTextureUsages.size());
-    result.textureUsages.reserve(mTextureUsages.size());
-
-    for (auto& [buffer, usage] : mBufferUsages) {
-        result.buffers.push_back(buffer);
-        result.bufferUsages.push_back(usage);
-    }
-
-    for (auto& [texture, usage] : mTextureUsages) {
-        result.textures.push_back(texture);
-        result.textureUsages.push_back(std::move(usage));
-    }
-
-    for (auto* const it : mExternalTextureUsages) {
-        result.externalTextures.push_back(it);
-    }
-
+    result.buffers = std::move(mBuffers);
+    result.bufferUsages = std::move(mBufferUsages);
+    result.textures = std::move(mTextures);
+    result.textureUsages = std::move(mTextureUsages);
+    result.externalTextures = std::move(mExternalTextures);
+
+    mBufferSlots.clear();
+    mBuffers.clear();
     mBufferUsages.clear();
+    mTextureSlots.clear();
+    mTextures.clear();
     mTextureUsages.clear();
-    mExternalTextureUsages.clear();
+    mExternalTextureSet.clear();
+    mExternalTextures.clear();
+    mAddedBindGroups.clear();
 
     return result;
 }
@@ -16,7 +16,8 @@
 #define SRC_DAWN_NATIVE_PASSRESOURCEUSAGETRACKER_H_
 
 #include <map>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "dawn/native/PassResourceUsage.h"
@@ -44,19 +45,40 @@ class SyncScopeUsageTracker {
 
     void BufferUsedAs(BufferBase* buffer, wgpu::BufferUsage usage);
     void TextureViewUsedAs(TextureViewBase* texture, wgpu::TextureUsage usage);
-    void AddRenderBundleTextureUsage(TextureBase* texture,
-                                     const TextureSubresourceUsage& textureUsage);
 
-    // Walks the bind groups and tracks all its resources.
+    // Merges the usages of a render bundle, which were summarized when the bundle was finished.
+    // This only does work for each resource of the bundle, not for each of its commands. Resources
+    // that weren't used in the scope yet still allocate an entry in the slot maps.
+    void AddRenderBundleUsage(const SyncScopeResourceUsage& bundleUsage);
+
+    // Walks the bind groups and tracks all its resources. Adding a bind group that was already
+    // added to this scope is a no-op since it would add the exact same usages again.
     void AddBindGroup(BindGroupBase* group);
 
     // Returns the per-pass usage for use by backends for APIs with explicit barriers.
     SyncScopeResourceUsage AcquireSyncScopeUsage();
 
   private:
-    std::map<BufferBase*, wgpu::BufferUsage> mBufferUsages;
-    std::map<TextureBase*, TextureSubresourceUsage> mTextureUsages;
-    std::set<ExternalTextureBase*> mExternalTextureUsages;
+    // Returns the usage of |texture| in the scope, creating it if the texture wasn't used yet.
+    TextureSubresourceUsage& GetOrCreateTextureUsage(TextureBase* texture);
+
+    // Each resource is given a dense slot the first time it is used in the scope, and its usage
+    // is accumulated at that slot in the flat arrays below. These arrays have the same layout as
+    // SyncScopeResourceUsage so they are moved into it without any repacking. The slot maps are
+    // node based, so each resource new to the scope costs one allocation there.
+    std::unordered_map<BufferBase*, uint32_t> mBufferSlots;
+    std::vector<BufferBase*> mBuffers;
+    std::vector<wgpu::BufferUsage> mBufferUsages;
+
+    std::unordered_map<TextureBase*, uint32_t> mTextureSlots;
+    std::vector<TextureBase*> mTextures;
+    std::vector<TextureSubresourceUsage> mTextureUsages;
+
+    std::unordered_set<ExternalTextureBase*> mExternalTextureSet;
+    std::vector<ExternalTextureBase*> mExternalTextures;
+
+    // The bind groups whose resources were already added to the scope.
+    std::unordered_set<BindGroupBase*> mAddedBindGroups;
 };
 
 // Helper class to build ComputePassResourceUsages
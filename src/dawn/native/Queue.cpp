@@ -25,6 +25,7 @@
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CommandValidation.h"
 #include "dawn/native/Commands.h"
+#include "dawn/native/CopyTextureData.h"
 #include "dawn/native/CopyTextureForBrowserHelper.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/DynamicUploader.h"
@@ -41,40 +42,6 @@ namespace dawn::native {
 
 namespace {
 
-void CopyTextureData(uint8_t* dstPointer,
-                     const uint8_t* srcPointer,
-                     uint32_t depth,
-                     uint32_t rowsPerImage,
-                     uint64_t imageAdditionalStride,
-                     uint32_t actualBytesPerRow,
-                     uint32_t dstBytesPerRow,
-                     uint32_t srcBytesPerRow) {
-    bool copyWholeLayer = actualBytesPerRow == dstBytesPerRow && dstBytesPerRow == srcBytesPerRow;
-    bool copyWholeData = copyWholeLayer && imageAdditionalStride == 0;
-
-    if (!copyWholeLayer) {  // copy row by row
-        for (uint32_t d = 0; d < depth; ++d) {
-            for (uint32_t h = 0; h < rowsPerImage; ++h) {
-                memcpy(dstPointer, srcPointer, actualBytesPerRow);
-                dstPointer += dstBytesPerRow;
-                srcPointer += srcBytesPerRow;
-            }
-            srcPointer += imageAdditionalStride;
-        }
-    } else {
-        uint64_t layerSize = uint64_t(rowsPerImage) * actualBytesPerRow;
-        if (!copyWholeData) {  // copy layer by layer
-            for (uint32_t d = 0; d < depth; ++d) {
-                memcpy(dstPointer, srcPointer, layerSize);
-                dstPointer += layerSize;
-                srcPointer += layerSize + imageAdditionalStride;
-            }
-        } else {  // do a single copy
-            memcpy(dstPointer, srcPointer, layerSize * depth);
-        }
-    }
-}
-
 ResultOrError<UploadHandle> UploadTextureDataAligningBytesPerRowAndOffset(
     DeviceBase* device,
     const void* data,
@@ -123,9 +90,15 @@ ResultOrError<UploadHandle> UploadTextureDataAligningBytesPerRowAndOffset(
     uint64_t imageAdditionalStride =
         dataLayout.bytesPerRow * (dataRowsPerImage - alignedRowsPerImage);
 
+    // The data is only written to the staging memory, which is read by the GPU afterwards.
+    CopyTextureDataOptions copyOptions;
+    copyOptions.writeOnlyDestination = true;
+    if (!device->IsToggleEnabled(Toggle::DisableParallelTextureDataUpload)) {
+        copyOptions.workerTaskPool = device->GetWorkerTaskPool();
+    }
     CopyTextureData(dstPointer, srcPointer, writeSizePixel.depthOrArrayLayers, alignedRowsPerImage,
                     imageAdditionalStride, alignedBytesPerRow, optimallyAlignedBytesPerRow,
-                    dataLayout.bytesPerRow);
+                    dataLayout.bytesPerRow, copyOptions);
 
     return uploadHandle;
 }
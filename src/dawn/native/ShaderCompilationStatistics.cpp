@@ -0,0 +1,238 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/ShaderCompilationStatistics.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/ShaderModule.h"
+
+namespace dawn::native {
+
+namespace {
+
+void WriteJSONString(std::ostream& out, std::string_view value) {
+    out << '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec << std::setfill(' ');
+                } else {
+                    out << c;
+                }
+                break;
+        }
+    }
+    out << '"';
+}
+
+void WriteJSONDigest(std::ostream& out, const Sha256::Digest& digest) {
+    out << '"' << std::hex << std::setfill('0');
+    for (uint8_t byte : digest) {
+        out << std::setw(2) << static_cast<int>(byte);
+    }
+    out << std::dec << std::setfill(' ') << '"';
+}
+
+const char* ShaderStageName(SingleShaderStage stage) {
+    switch (stage) {
+        case SingleShaderStage::Vertex:
+            return "vertex";
+        case SingleShaderStage::Fragment:
+            return "fragment";
+        case SingleShaderStage::Compute:
+            return "compute";
+    }
+    UNREACHABLE();
+}
+
+const char* SourceName(ShaderCompilationStatistics::Source source) {
+    switch (source) {
+        case ShaderCompilationStatistics::Source::Compiled:
+            return "compiled";
+        case ShaderCompilationStatistics::Source::BlobCache:
+            return "blobCache";
+        case ShaderCompilationStatistics::Source::InMemoryCache:
+            return "inMemoryCache";
+    }
+    UNREACHABLE();
+}
+
+// Appends |value| to |entries|, dropping the oldest entry if there are already |maxEntries|.
+template <typename T>
+void AppendBounded(std::deque<T>* entries, T value, size_t maxEntries, uint64_t* dropped) {
+    if (maxEntries == 0) {
+        ++*dropped;
+        return;
+    }
+    if (entries->size() == maxEntries) {
+        entries->pop_front();
+        ++*dropped;
+    }
+    entries->push_back(std::move(value));
+}
+
+}  // anonymous namespace
+
+ShaderCompilationStatisticsRecorder::ShaderCompilationStatisticsRecorder(size_t maxEntries)
+    : mMaxEntries(maxEntries) {}
+
+ShaderCompilationStatisticsRecorder::~ShaderCompilationStatisticsRecorder() = default;
+
+void ShaderCompilationStatisticsRecorder::RecordShaderModule(ShaderModuleStatistics statistics) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    AppendBounded(&mShaderModules, std::move(statistics), mMaxEntries, &mDroppedShaderModules);
+}
+
+void ShaderCompilationStatisticsRecorder::RecordCompilation(
+    ShaderCompilationStatistics statistics) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    AppendBounded(&mCompilations, std::move(statistics), mMaxEntries, &mDroppedCompilations);
+}
+
+std::string ShaderCompilationStatisticsRecorder::ToJSON() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::ostringstream out;
+    out << "{\"shaderModules\":[";
+    for (size_t i = 0; i < mShaderModules.size(); ++i) {
+        const ShaderModuleStatistics& module = mShaderModules[i];
+        if (i != 0) {
+            out << ",";
+        }
+        out << "{\"label\":";
+        WriteJSONString(out, module.label);
+        out << ",\"sourceDigest\":";
+        WriteJSONDigest(out, module.sourceDigest);
+        out << ",\"parseNs\":" << module.parseDuration.count()
+            << ",\"resolveNs\":" << module.resolveDuration.count()
+            << ",\"astNodeCount\":" << module.astNodeCount
+            << ",\"semNodeCount\":" << module.semNodeCount << "}";
+    }
+
+    out << "],\"compilations\":[";
+    for (size_t i = 0; i < mCompilations.size(); ++i) {
+        const ShaderCompilationStatistics& compilation = mCompilations[i];
+        if (i != 0) {
+            out << ",";
+        }
+        out << "{\"shaderModuleLabel\":";
+        WriteJSONString(out, compilation.shaderModuleLabel);
+        out << ",\"sourceDigest\":";
+        WriteJSONDigest(out, compilation.sourceDigest);
+        out << ",\"entryPoint\":";
+        WriteJSONString(out, compilation.entryPoint);
+        out << ",\"stage\":\"" << ShaderStageName(compilation.stage) << "\""
+            << ",\"generator\":\"" << compilation.generator << "\""
+            << ",\"source\":\"" << SourceName(compilation.source) << "\""
+            << ",\"totalNs\":" << compilation.totalDuration.count()
+            << ",\"transformNs\":" << compilation.transformDuration.count()
+            << ",\"generateNs\":" << compilation.generateDuration.count() << ",\"transforms\":[";
+        for (size_t j = 0; j < compilation.transforms.size(); ++j) {
+            const ShaderCompilationStatistics::Transform& transform = compilation.transforms[j];
+            if (j != 0) {
+                out << ",";
+            }
+            out << "{\"name\":";
+            WriteJSONString(out, transform.name);
+            out << ",\"cloned\":" << (transform.cloned ? "true" : "false")
+                << ",\"durationNs\":" << transform.duration.count() << "}";
+        }
+        out << "]}";
+    }
+    out << "],\"droppedShaderModules\":" << mDroppedShaderModules
+        << ",\"droppedCompilations\":" << mDroppedCompilations << "}";
+
+    return out.str();
+}
+
+ShaderCompilationStatisticsScope::ShaderCompilationStatisticsScope(const ShaderModuleBase* module,
+                                                                   const std::string& entryPoint,
+                                                                   SingleShaderStage stage,
+                                                                   const char* generator)
+    : mRecorder(module->GetDevice()->GetShaderCompilationStatisticsRecorder()) {
+    if (mRecorder == nullptr) {
+        return;
+    }
+    mStatistics.shaderModuleLabel = module->GetLabel();
+    mStatistics.sourceDigest = module->GetTintProgramWithSourceDigest().sourceDigest;
+    mStatistics.entryPoint = entryPoint;
+    mStatistics.stage = stage;
+    mStatistics.generator = generator;
+    mStart = std::chrono::steady_clock::now();
+}
+
+ShaderCompilationStatisticsScope::~ShaderCompilationStatisticsScope() = default;
+
+ShaderCompilationStatistics* ShaderCompilationStatisticsScope::Get() {
+    return mRecorder != nullptr ? &mStatistics : nullptr;
+}
+
+void ShaderCompilationStatisticsScope::Record(bool blobCacheHit) {
+    RecordWithSource(blobCacheHit ? ShaderCompilationStatistics::Source::BlobCache
+                                  : ShaderCompilationStatistics::Source::Compiled);
+}
+
+void ShaderCompilationStatisticsScope::RecordInMemoryCacheHit() {
+    RecordWithSource(ShaderCompilationStatistics::Source::InMemoryCache);
+}
+
+void ShaderCompilationStatisticsScope::RecordWithSource(
+    ShaderCompilationStatistics::Source source) {
+    if (mRecorder == nullptr) {
+        return;
+    }
+    mStatistics.source = source;
+    mStatistics.totalDuration = std::chrono::steady_clock::now() - mStart;
+    mRecorder->RecordCompilation(std::move(mStatistics));
+    mRecorder = nullptr;
+}
+
+ScopedShaderCompilationTimer::ScopedShaderCompilationTimer(ShaderCompilationStatistics* statistics,
+                                                           Duration duration)
+    : mStatistics(statistics), mDuration(duration) {
+    if (mStatistics != nullptr) {
+        mStart = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedShaderCompilationTimer::~ScopedShaderCompilationTimer() {
+    if (mStatistics != nullptr) {
+        mStatistics->*mDuration += std::chrono::steady_clock::now() - mStart;
+    }
+}
+
+}  // namespace dawn::native
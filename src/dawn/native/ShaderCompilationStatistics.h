@@ -0,0 +1,143 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_NATIVE_SHADERCOMPILATIONSTATISTICS_H_
+#define SRC_DAWN_NATIVE_SHADERCOMPILATIONSTATISTICS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dawn/common/Sha256.h"
+#include "dawn/native/PerStage.h"
+
+namespace dawn::native {
+
+class ShaderModuleBase;
+
+// The statistics of the parsing of a shader module.
+struct ShaderModuleStatistics {
+    std::string label;
+    Sha256::Digest sourceDigest = {};
+    std::chrono::nanoseconds parseDuration{0};
+    std::chrono::nanoseconds resolveDuration{0};
+    size_t astNodeCount = 0;
+    size_t semNodeCount = 0;
+};
+
+// The statistics of the compilation of an entry point of a shader module for a pipeline.
+struct ShaderCompilationStatistics {
+    struct Transform {
+        std::string name;
+        // False if the transform was skipped because it had nothing to do.
+        bool cloned = false;
+        std::chrono::nanoseconds duration{0};
+    };
+
+    std::string shaderModuleLabel;
+    Sha256::Digest sourceDigest = {};
+    std::string entryPoint;
+    SingleShaderStage stage = SingleShaderStage::Vertex;
+    // The name of the Tint writer used by the backend.
+    const char* generator = "";
+    // Where the result came from. Only the total duration is known for cached results.
+    enum class Source {
+        Compiled,
+        BlobCache,
+        // The backend's in-memory cache of the compilations of the shader module.
+        InMemoryCache,
+    };
+    Source source = Source::Compiled;
+
+    std::vector<Transform> transforms;
+    std::chrono::nanoseconds transformDuration{0};
+    std::chrono::nanoseconds generateDuration{0};
+    std::chrono::nanoseconds totalDuration{0};
+};
+
+// Collects the shader statistics of a device. Only created when the
+// RecordShaderCompilationStatistics toggle is enabled. Thread-safe.
+// Only the last |maxEntries| shader modules and compilations are kept, so that long-running
+// applications don't grow the recorder without bound. The dropped entries are counted.
+class ShaderCompilationStatisticsRecorder {
+  public:
+    static constexpr size_t kDefaultMaxEntries = 4096;
+
+    explicit ShaderCompilationStatisticsRecorder(size_t maxEntries = kDefaultMaxEntries);
+    ~ShaderCompilationStatisticsRecorder();
+
+    void RecordShaderModule(ShaderModuleStatistics statistics);
+    void RecordCompilation(ShaderCompilationStatistics statistics);
+
+    // Returns the statistics recorded so far as a JSON object with a "shaderModules" and a
+    // "compilations" array, and the number of entries dropped from each.
+    std::string ToJSON() const;
+
+  private:
+    const size_t mMaxEntries;
+
+    mutable std::mutex mMutex;
+    std::deque<ShaderModuleStatistics> mShaderModules;
+    std::deque<ShaderCompilationStatistics> mCompilations;
+    uint64_t mDroppedShaderModules = 0;
+    uint64_t mDroppedCompilations = 0;
+};
+
+// Gathers the statistics of one compilation, and records them in the recorder of the device of
+// the shader module when Record() is called. Does nothing if the device doesn't record statistics.
+class ShaderCompilationStatisticsScope {
+  public:
+    ShaderCompilationStatisticsScope(const ShaderModuleBase* module,
+                                     const std::string& entryPoint,
+                                     SingleShaderStage stage,
+                                     const char* generator);
+    ~ShaderCompilationStatisticsScope();
+
+    // Returns the statistics to fill during the compilation, or nullptr if they aren't recorded.
+    ShaderCompilationStatistics* Get();
+
+    // Records the statistics along with the time elapsed since the creation of the scope.
+    // |blobCacheHit| is true if the result was loaded from the blob cache.
+    void Record(bool blobCacheHit);
+    // Same as Record(), for a result found in the backend's in-memory cache.
+    void RecordInMemoryCacheHit();
+
+  private:
+    void RecordWithSource(ShaderCompilationStatistics::Source source);
+
+    ShaderCompilationStatisticsRecorder* mRecorder;
+    ShaderCompilationStatistics mStatistics;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// Adds the time spent until the end of its scope to a duration of |statistics|, if not null.
+class ScopedShaderCompilationTimer {
+  public:
+    using Duration = std::chrono::nanoseconds ShaderCompilationStatistics::*;
+
+    ScopedShaderCompilationTimer(ShaderCompilationStatistics* statistics, Duration duration);
+    ~ScopedShaderCompilationTimer();
+
+  private:
+    ShaderCompilationStatistics* mStatistics;
+    Duration mDuration;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_SHADERCOMPILATIONSTATISTICS_H_
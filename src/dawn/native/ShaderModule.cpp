@@ -15,6 +15,8 @@
 #include "dawn/native/ShaderModule.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <sstream>
 
 #include "absl/strings/str_format.h"
@@ -24,10 +26,10 @@
 #include "dawn/native/ChainUtils_autogen.h"
 #include "dawn/native/CompilationMessages.h"
 #include "dawn/native/Device.h"
-#include "dawn/native/ObjectContentHasher.h"
 #include "dawn/native/Pipeline.h"
 #include "dawn/native/PipelineLayout.h"
 #include "dawn/native/RenderPipeline.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/TintUtils.h"
 
 #include "tint/tint.h"
@@ -299,9 +301,13 @@ EntryPointMetadata::Override::Type FromTintOverrideType(tint::inspector::Overrid
 }
 
 ResultOrError<tint::Program> ParseWGSL(const tint::Source::File* file,
-                                       OwnedCompilationMessages* outMessages) {
+                                       OwnedCompilationMessages* outMessages,
+                                       ShaderModuleParseResult* parseResult) {
 #if TINT_BUILD_WGSL_READER
-    tint::Program program = tint::reader::wgsl::Parse(file);
+    tint::reader::wgsl::ParseStatistics statistics;
+    tint::Program program = tint::reader::wgsl::Parse(file, &statistics);
+    parseResult->parseDuration = statistics.parse_duration;
+    parseResult->resolveDuration = statistics.resolve_duration;
     if (outMessages != nullptr) {
         DAWN_TRY(outMessages->AddMessages(program.Diagnostics()));
     }
@@ -971,7 +977,10 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
 
         std::vector<uint32_t> spirv(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
         tint::Program program;
+        // The SPIR-V reader doesn't separate the resolution of the program from its parsing.
+        auto parseStart = std::chrono::steady_clock::now();
         DAWN_TRY_ASSIGN(program, ParseSPIRV(spirv, outMessages, spirvOptions));
+        parseResult->parseDuration = std::chrono::steady_clock::now() - parseStart;
         parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
 
         return {};
@@ -989,7 +998,7 @@ MaybeError ValidateAndParseShaderModule(DeviceBase* device,
     }
 
     tint::Program program;
-    DAWN_TRY_ASSIGN(program, ParseWGSL(&tintSource->file, outMessages));
+    DAWN_TRY_ASSIGN(program, ParseWGSL(&tintSource->file, outMessages, parseResult));
     parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
     parseResult->tintSource = std::move(tintSource);
 
@@ -1011,8 +1020,21 @@ ResultOrError<tint::Program> RunTransforms(tint::transform::Transform* transform
                                            const tint::Program* program,
                                            const tint::transform::DataMap& inputs,
                                            tint::transform::DataMap* outputs,
-                                           OwnedCompilationMessages* outMessages) {
-    tint::transform::Output output = transform->Run(program, inputs);
+                                           OwnedCompilationMessages* outMessages,
+                                           ShaderCompilationStatistics* statistics) {
+    tint::transform::Output output;
+    {
+        ScopedShaderCompilationTimer timer(statistics,
+                                           &ShaderCompilationStatistics::transformDuration);
+        output = transform->Run(program, inputs);
+    }
+    if (statistics != nullptr) {
+        if (auto* managerStatistics = output.data.Get<tint::transform::Manager::Statistics>()) {
+            for (const auto& entry : managerStatistics->transforms) {
+                statistics->transforms.push_back({entry.name, entry.cloned, entry.duration});
+            }
+        }
+    }
     if (outMessages != nullptr) {
         DAWN_TRY(outMessages->AddMessages(output.program.Diagnostics()));
     }
@@ -1103,6 +1125,18 @@ ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
         mType = Type::Wgsl;
         mWgsl = std::string(wgslDesc->source);
     }
+
+    const DawnShaderModuleSPIRVOptionsDescriptor* spirvOptions = nullptr;
+    FindInChain(descriptor->nextInChain, &spirvOptions);
+    mAllowNonUniformDerivatives =
+        spirvOptions != nullptr && spirvOptions->allowNonUniformDerivatives;
+
+    Sha256 sourceHasher;
+    sourceHasher.Update(&mType, sizeof(mType));
+    sourceHasher.Update(mOriginalSpirv.data(), mOriginalSpirv.size() * sizeof(uint32_t));
+    sourceHasher.Update(mWgsl.data(), mWgsl.size());
+    sourceHasher.Update(&mAllowNonUniformDerivatives, sizeof(mAllowNonUniformDerivatives));
+    mSourceDigest = sourceHasher.Finalize();
 }
 
 ShaderModuleBase::ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor)
@@ -1141,16 +1175,18 @@ const EntryPointMetadata& ShaderModuleBase::GetEntryPoint(const std::string& ent
 }
 
 size_t ShaderModuleBase::ComputeContentHash() {
-    ObjectContentHasher recorder;
-    recorder.Record(mType);
-    recorder.Record(mOriginalSpirv);
-    recorder.Record(mWgsl);
-    return recorder.GetContentHash();
+    // The digest is already a strong hash of the type and content of the original data.
+    size_t hash;
+    static_assert(sizeof(hash) <= sizeof(mSourceDigest));
+    memcpy(&hash, mSourceDigest.data(), sizeof(hash));
+    return hash;
 }
 
 bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
                                                 const ShaderModuleBase* b) const {
-    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv && a->mWgsl == b->mWgsl;
+    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv &&
+           a->mWgsl == b->mWgsl &&
+           a->mAllowNonUniformDerivatives == b->mAllowNonUniformDerivatives;
 }
 
 const tint::Program* ShaderModuleBase::GetTintProgram() const {
@@ -1158,6 +1194,10 @@ const tint::Program* ShaderModuleBase::GetTintProgram() const {
     return mTintProgram.get();
 }
 
+ProgramWithSourceDigest ShaderModuleBase::GetTintProgramWithSourceDigest() const {
+    return {GetTintProgram(), mSourceDigest};
+}
+
 void ShaderModuleBase::APIGetCompilationInfo(wgpu::CompilationInfoCallback callback,
                                              void* userdata) {
     if (callback == nullptr) {
@@ -1209,6 +1249,18 @@ MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult
     mTintProgram = std::move(parseResult->tintProgram);
     mTintSource = std::move(parseResult->tintSource);
 
+    if (ShaderCompilationStatisticsRecorder* recorder =
+            GetDevice()->GetShaderCompilationStatisticsRecorder()) {
+        ShaderModuleStatistics statistics;
+        statistics.label = GetLabel();
+        statistics.sourceDigest = mSourceDigest;
+        statistics.parseDuration = parseResult->parseDuration;
+        statistics.resolveDuration = parseResult->resolveDuration;
+        statistics.astNodeCount = mTintProgram->ASTNodes().Count();
+        statistics.semNodeCount = mTintProgram->SemNodes().Count();
+        recorder->RecordShaderModule(std::move(statistics));
+    }
+
     DAWN_TRY(ReflectShaderUsingTint(GetDevice(), mTintProgram.get(), compilationMessages,
                                     &mEntryPoints, &mEnabledWGSLExtensions));
     return {};
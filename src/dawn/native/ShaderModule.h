@@ -16,6 +16,7 @@
 #define SRC_DAWN_NATIVE_SHADERMODULE_H_
 
 #include <bitset>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -25,6 +26,7 @@
 #include <vector>
 
 #include "dawn/common/Constants.h"
+#include "dawn/common/Sha256.h"
 #include "dawn/common/ityp_array.h"
 #include "dawn/native/BindingInfo.h"
 #include "dawn/native/CachedObject.h"
@@ -57,6 +59,15 @@ namespace dawn::native {
 
 using WGSLExtensionSet = std::unordered_set<std::string>;
 struct EntryPointMetadata;
+struct ShaderCompilationStatistics;
+
+// The tint::Program of a shader module, used as the input of the backend compilations. It is
+// streamed into CacheKeys as the SHA-256 digest of the shader module source the program was parsed
+// from, so building a key doesn't require printing the whole program back to WGSL.
+struct ProgramWithSourceDigest {
+    const tint::Program* program = nullptr;
+    Sha256::Digest sourceDigest = {};
+};
 
 // Base component type of an inter-stage variable
 enum class InterStageComponentType {
@@ -99,6 +110,10 @@ struct ShaderModuleParseResult {
 
     std::unique_ptr<tint::Program> tintProgram;
     std::unique_ptr<TintSource> tintSource;
+
+    // The time spent parsing the program and resolving it, for the shader compilation statistics.
+    std::chrono::nanoseconds parseDuration{0};
+    std::chrono::nanoseconds resolveDuration{0};
 };
 
 MaybeError ValidateAndParseShaderModule(DeviceBase* device,
@@ -122,7 +137,8 @@ ResultOrError<tint::Program> RunTransforms(tint::transform::Transform* transform
                                            const tint::Program* program,
                                            const tint::transform::DataMap& inputs,
                                            tint::transform::DataMap* outputs,
-                                           OwnedCompilationMessages* messages);
+                                           OwnedCompilationMessages* messages,
+                                           ShaderCompilationStatistics* statistics = nullptr);
 
 // Mirrors wgpu::SamplerBindingLayout but instead stores a single boolean
 // for isComparison instead of a wgpu::SamplerBindingType enum.
@@ -278,6 +294,9 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
 
     // This returns tint program before running transforms.
     const tint::Program* GetTintProgram() const;
+    // Same as GetTintProgram, along with the digest of the source the program was parsed from,
+    // for use in compilation requests.
+    ProgramWithSourceDigest GetTintProgramWithSourceDigest() const;
 
     void APIGetCompilationInfo(wgpu::CompilationInfoCallback callback, void* userdata);
 
@@ -299,6 +318,10 @@ class ShaderModuleBase : public ApiObjectBase, public CachedObject {
     Type mType;
     std::vector<uint32_t> mOriginalSpirv;
     std::string mWgsl;
+    bool mAllowNonUniformDerivatives = false;
+    // Digest of the type and content of the original data, along with the descriptors that
+    // affect how it is parsed. Computed once at creation since it can be large.
+    Sha256::Digest mSourceDigest = {};
 
     EntryPointMetadataTable mEntryPoints;
     WGSLExtensionSet mEnabledWGSLExtensions;
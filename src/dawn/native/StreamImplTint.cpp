@@ -14,6 +14,7 @@
 
 #include "dawn/native/stream/Stream.h"
 
+#include "dawn/native/ShaderModule.h"
 #include "dawn/native/TintUtils.h"
 #include "tint/tint.h"
 
@@ -30,16 +31,11 @@ void StreamInTintObject(const OBJECT& object, stream::Sink* sink) {
 
 // static
 template <>
-void stream::Stream<tint::Program>::Write(stream::Sink* sink, const tint::Program& p) {
-#if TINT_BUILD_WGSL_WRITER
-    tint::writer::wgsl::Options options{};
-    StreamIn(sink, tint::writer::wgsl::Generate(&p, options).wgsl);
-#else
-    // TODO(crbug.com/dawn/1481): We shouldn't need to write back to WGSL if we have a CacheKey
-    // built from the initial shader module input. Then, we would never need to parse the program
-    // and write back out to WGSL.
-    UNREACHABLE();
-#endif
+void stream::Stream<ProgramWithSourceDigest>::Write(stream::Sink* sink,
+                                                    const ProgramWithSourceDigest& p) {
+    // The program is fully determined by the shader module source and by the device, which is
+    // already part of the CacheKey, so the digest of that source identifies it.
+    StreamIn(sink, p.sourceDigest);
 }
 
 // static
@@ -206,6 +206,12 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Dump shaders for debugging purposes. Dumped shaders will be log via EmitLog, thus printed "
       "in Chrome console or consumed by user-defined callback function.",
       "https://crbug.com/dawn/792", ToggleStage::Device}},
+    {Toggle::RecordShaderCompilationStatistics,
+     {"record_shader_compilation_statistics",
+      "Record the time spent in each phase of the shader compilations, along with the sizes of the "
+      "shader programs and whether the compilations hit a cache. The statistics can be retrieved "
+      "as JSON with dawn::native::GetShaderCompilationStatisticsJSON.",
+      "https://crbug.com/dawn/792", ToggleStage::Device}},
     {Toggle::ForceWGSLStep,
      {"force_wgsl_step",
       "When ingesting SPIR-V shaders, force a first conversion to WGSL. This allows testing Tint's "
@@ -403,6 +409,16 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Clears some R8-like textures to full 0 bits as soon as they are created. This Toggle is "
       "enabled on Intel Gen12 GPUs due to a mesa driver issue.",
       "https://crbug.com/chromium/1361662", ToggleStage::Device}},
+    {Toggle::DisableCommandBlockPool,
+     {"disable_command_block_pool",
+      "Disables the reuse of the memory blocks holding encoded commands across the command "
+      "encoders of a device. The blocks are then allocated and freed for each command buffer.",
+      "https://crbug.com/dawn/835", ToggleStage::Device}},
+    {Toggle::DisableParallelTextureDataUpload,
+     {"disable_parallel_texture_data_upload",
+      "Disables splitting the copy of large texture data to the staging memory of WriteTexture "
+      "in bands of rows copied in parallel on the worker threads of the device.",
+      "https://crbug.com/dawn/1422", ToggleStage::Device}},
     {Toggle::NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
      {"no_workaround_sample_mask_becomes_zero_for_all_but_last_color_target",
       "MacOS 12.0+ Intel has a bug where the sample mask is only applied for the last color "
@@ -62,6 +62,7 @@ enum class Toggle {
     EmitHLSLDebugSymbols,
     DisallowSpirv,
     DumpShaders,
+    RecordShaderCompilationStatistics,
     ForceWGSLStep,
     DisableWorkgroupInit,
     DisableSymbolRenaming,
@@ -95,6 +96,8 @@ enum class Toggle {
     AllowDeprecatedAPIs,
     D3D12PolyfillReflectVec2F32,
     VulkanClearGen12TextureWithCCSAmbiguateOnCreation,
+    DisableCommandBlockPool,
+    DisableParallelTextureDataUpload,
 
     // Unresolved issues.
     NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
@@ -21,6 +21,7 @@
 
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
+#include "dawn/native/ShaderModule.h"
 #include "dawn/native/d3d/d3d_platform.h"
 
 #include "tint/tint.h"
@@ -43,7 +44,7 @@ namespace dawn::native::d3d {
 enum class Compiler { FXC, DXC };
 
 #define HLSL_COMPILATION_REQUEST_MEMBERS(X)                                                 \
-    X(const tint::Program*, inputProgram)                                                   \
+    X(ProgramWithSourceDigest, inputProgram)                                                \
     X(std::string_view, entryPointName)                                                     \
     X(SingleShaderStage, stage)                                                             \
     X(uint32_t, shaderModel)                                                                \
@@ -91,10 +92,11 @@ DAWN_SERIALIZABLE(struct,
                   D3D_BYTECODE_COMPILATION_REQUEST_MEMBERS){};
 #undef D3D_BYTECODE_COMPILATION_REQUEST_MEMBERS
 
-#define D3D_COMPILATION_REQUEST_MEMBERS(X)     \
-    X(HlslCompilationRequest, hlsl)            \
-    X(D3DBytecodeCompilationRequest, bytecode) \
-    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform)
+#define D3D_COMPILATION_REQUEST_MEMBERS(X)                                    \
+    X(HlslCompilationRequest, hlsl)                                           \
+    X(D3DBytecodeCompilationRequest, bytecode)                                \
+    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform) \
+    X(CacheKey::UnsafeUnkeyedValue<ShaderCompilationStatistics*>, statistics)
 
 DAWN_MAKE_CACHE_REQUEST(D3DCompilationRequest, D3D_COMPILATION_REQUEST_MEMBERS);
 #undef D3D_COMPILATION_REQUEST_MEMBERS
@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/d3d/BlobD3D.h"
 #include "dawn/native/d3d/D3DCompilationRequest.h"
 #include "dawn/native/d3d/D3DError.h"
@@ -138,6 +139,7 @@ ResultOrError<ComPtr<ID3DBlob>> CompileShaderFXC(const d3d::D3DBytecodeCompilati
 ResultOrError<std::string> TranslateToHLSL(
     d3d::HlslCompilationRequest r,
     CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*> tracePlatform,
+    ShaderCompilationStatistics* statistics,
     std::string* remappedEntryPointName,
     bool* usesVertexOrInstanceIndex) {
     std::ostringstream errorStream;
@@ -177,8 +179,8 @@ ResultOrError<std::string> TranslateToHLSL(
     {
         TRACE_EVENT0(tracePlatform.UnsafeGetValue(), General, "RunTransforms");
         DAWN_TRY_ASSIGN(transformedProgram,
-                        RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                      &transformOutputs, nullptr));
+                        RunTransforms(&transformManager, r.inputProgram.program, transformInputs,
+                                      &transformOutputs, nullptr, statistics));
     }
 
     if (auto* data = transformOutputs.Get<tint::transform::Renamer::Data>()) {
@@ -237,6 +239,8 @@ ResultOrError<std::string> TranslateToHLSL(
     options.polyfill_reflect_vec2_f32 = r.polyfillReflectVec2F32;
 
     TRACE_EVENT0(tracePlatform.UnsafeGetValue(), General, "tint::writer::hlsl::Generate");
+    ScopedShaderCompilationTimer generateTimer(statistics,
+                                               &ShaderCompilationStatistics::generateDuration);
     auto result = tint::writer::hlsl::Generate(&transformedProgram, options);
     DAWN_INVALID_IF(!result.success, "An error occured while generating HLSL: %s", result.error);
 
@@ -312,7 +316,8 @@ ResultOrError<CompiledShader> CompileShader(d3d::D3DCompilationRequest r) {
     // Compile the source shader to HLSL.
     std::string remappedEntryPoint;
     DAWN_TRY_ASSIGN(compiledShader.hlslSource,
-                    TranslateToHLSL(std::move(r.hlsl), r.tracePlatform, &remappedEntryPoint,
+                    TranslateToHLSL(std::move(r.hlsl), r.tracePlatform,
+                                    r.statistics.UnsafeGetValue(), &remappedEntryPoint,
                                     &compiledShader.usesVertexOrInstanceIndex));
 
     switch (r.bytecode.compiler) {
@@ -381,6 +381,19 @@ ResultOrError<ExecutionSerial> Device::CheckAndUpdateCompletedSerials() {
     return completedSerial;
 }
 
+MaybeError Device::WaitForQueueSerialImpl(ExecutionSerial serial,
+                                          std::chrono::nanoseconds timeout) {
+    // Round the timeout up so that waits shorter than a millisecond still block, and keep it
+    // below INFINITE.
+    uint64_t timeoutMS = (uint64_t(timeout.count()) + 999999) / 1000000;
+    DWORD waitMS = DWORD(std::min(timeoutMS, uint64_t(INFINITE - 1)));
+
+    DAWN_TRY(CheckHRESULT(mFence->SetEventOnCompletion(uint64_t(serial), mFenceEvent),
+                          "D3D12 set event on completion"));
+    WaitForSingleObject(mFenceEvent, waitMS);
+    return {};
+}
+
 void Device::ReferenceUntilUnused(ComPtr<IUnknown> object) {
     mUsedComObjectRefs.Enqueue(object, GetPendingCommandSerial());
 }
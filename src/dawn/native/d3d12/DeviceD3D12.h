@@ -220,6 +220,8 @@ class Device final : public d3d::Device {
     HANDLE mFenceEvent = nullptr;
     HANDLE mFenceHandle = nullptr;
     ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
+    MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                      std::chrono::nanoseconds timeout) override;
 
     ComPtr<ID3D12Device> mD3d12Device;  // Device is owned by adapter and will not be outlived.
     ComPtr<ID3D12CommandQueue> mCommandQueue;
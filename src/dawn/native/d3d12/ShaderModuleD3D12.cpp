@@ -21,6 +21,7 @@
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/Log.h"
 #include "dawn/native/Pipeline.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/d3d/D3DCompilationRequest.h"
 #include "dawn/native/d3d/D3DError.h"
@@ -73,6 +74,10 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
 
     d3d::D3DCompilationRequest req = {};
     req.tracePlatform = UnsafeUnkeyedValue(device->GetPlatform());
+
+    ShaderCompilationStatisticsScope statistics(this, programmableStage.entryPoint, stage, "hlsl");
+    req.statistics = UnsafeUnkeyedValue(statistics.Get());
+
     req.hlsl.shaderModel = device->GetDeviceInfo().shaderModel;
     req.hlsl.disableSymbolRenaming = device->IsToggleEnabled(Toggle::DisableSymbolRenaming);
     req.hlsl.isRobustnessEnabled = device->IsRobustnessEnabled();
@@ -188,7 +193,7 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
         substituteOverrideConfig = BuildSubstituteOverridesTransformConfig(programmableStage);
     }
 
-    req.hlsl.inputProgram = GetTintProgram();
+    req.hlsl.inputProgram = GetTintProgramWithSourceDigest();
     req.hlsl.entryPointName = programmableStage.entryPoint.c_str();
     req.hlsl.stage = stage;
     req.hlsl.firstIndexOffsetShaderRegister = layout->GetFirstIndexOffsetShaderRegister();
@@ -209,6 +214,7 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
     CacheResult<d3d::CompiledShader> compiledShader;
     DAWN_TRY_LOAD_OR_RUN(compiledShader, device, std::move(req), d3d::CompiledShader::FromBlob,
                          d3d::CompileShader);
+    statistics.Record(compiledShader.IsCached());
 
     if (device->IsToggleEnabled(Toggle::DumpShaders)) {
         d3d::DumpCompiledShader(device, *compiledShader, compileFlags);
@@ -16,6 +16,7 @@
 #define SRC_DAWN_NATIVE_METAL_DEVICEMTL_H_
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -134,6 +135,8 @@ class Device final : public DeviceBase {
     MaybeError WaitForIdleForDestruction() override;
     bool HasPendingCommands() const override;
     ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
+    MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                      std::chrono::nanoseconds timeout) override;
 
     NSPRef<id<MTLDevice>> mMtlDevice;
     NSPRef<id> mMtlSharedEvent = nil;  // MTLSharedEvent not available until macOS 10.14+.
@@ -144,6 +147,9 @@ class Device final : public DeviceBase {
     // The completed serial is updated in a Metal completion handler that can be fired on a
     // different thread, so it needs to be atomic.
     std::atomic<uint64_t> mCompletedSerial;
+    // Signaled by the completion handler so that WaitForQueueSerialImpl can block on it.
+    std::mutex mCompletedSerialMutex;
+    std::condition_variable mCompletedSerialCondition;
 
     // mLastSubmittedCommands will be accessed in a Metal schedule handler that can be fired on
     // a different thread so we guard access to it with a mutex.
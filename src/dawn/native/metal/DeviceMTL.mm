@@ -257,6 +257,14 @@ ResultOrError<ExecutionSerial> Device::CheckAndUpdateCompletedSerials() {
     return ExecutionSerial(mCompletedSerial.load());
 }
 
+MaybeError Device::WaitForQueueSerialImpl(ExecutionSerial serial,
+                                          std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mCompletedSerialMutex);
+    mCompletedSerialCondition.wait_for(
+        lock, timeout, [&] { return mCompletedSerial.load() >= uint64_t(serial); });
+    return {};
+}
+
 MaybeError Device::TickImpl() {
     if (mCommandContext.NeedsSubmit()) {
         DAWN_TRY(SubmitPendingCommandBuffer());
@@ -337,7 +345,11 @@ MaybeError Device::SubmitPendingCommandBuffer() {
         TRACE_EVENT_ASYNC_END0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
                                uint64_t(pendingSerial));
         ASSERT(uint64_t(pendingSerial) > mCompletedSerial.load());
-        this->mCompletedSerial = uint64_t(pendingSerial);
+        {
+            std::lock_guard<std::mutex> lock(this->mCompletedSerialMutex);
+            this->mCompletedSerial = uint64_t(pendingSerial);
+        }
+        this->mCompletedSerialCondition.notify_all();
     }];
 
     TRACE_EVENT_ASYNC_BEGIN0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
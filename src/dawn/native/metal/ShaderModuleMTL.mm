@@ -17,6 +17,7 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/metal/DeviceMTL.h"
 #include "dawn/native/metal/PipelineLayoutMTL.h"
@@ -37,7 +38,7 @@ using OptionalVertexPullingTransformConfig = std::optional<tint::transform::Vert
 
 #define MSL_COMPILATION_REQUEST_MEMBERS(X)                                                  \
     X(SingleShaderStage, stage)                                                             \
-    X(const tint::Program*, inputProgram)                                                   \
+    X(ProgramWithSourceDigest, inputProgram)                                                \
     X(tint::writer::ArrayLengthFromUniformOptions, arrayLengthFromUniform)                  \
     X(tint::writer::BindingRemapperOptions, bindingRemapper)                                \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                         \
@@ -50,7 +51,8 @@ using OptionalVertexPullingTransformConfig = std::optional<tint::transform::Vert
     X(bool, isRobustnessEnabled)                                                            \
     X(bool, disableSymbolRenaming)                                                          \
     X(bool, disableWorkgroupInit)                                                           \
-    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform)
+    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform)               \
+    X(CacheKey::UnsafeUnkeyedValue<ShaderCompilationStatistics*>, statistics)
 
 DAWN_MAKE_CACHE_REQUEST(MslCompilationRequest, MSL_COMPILATION_REQUEST_MEMBERS);
 #undef MSL_COMPILATION_REQUEST_MEMBERS
@@ -182,7 +184,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
 
     MslCompilationRequest req = {};
     req.stage = stage;
-    req.inputProgram = programmableStage.module->GetTintProgram();
+    req.inputProgram = programmableStage.module->GetTintProgramWithSourceDigest();
     req.bindingRemapper = std::move(bindingRemapper);
     req.externalTextureOptions = BuildExternalTextureTransformBindings(layout);
     req.vertexPullingTransformConfig = std::move(vertexPullingTransformConfig);
@@ -197,6 +199,10 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
     req.tracePlatform = UnsafeUnkeyedValue(device->GetPlatform());
     req.arrayLengthFromUniform = std::move(arrayLengthFromUniform);
 
+    ShaderCompilationStatisticsScope statistics(programmableStage.module.Get(),
+                                                programmableStage.entryPoint, stage, "msl");
+    req.statistics = UnsafeUnkeyedValue(statistics.Get());
+
     const CombinedLimits& limits = device->GetLimits();
     req.limits = LimitsForCompilationRequest::Create(limits.v1);
 
@@ -239,9 +245,9 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
             tint::transform::DataMap transformOutputs;
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
+                DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram.program,
+                                                       transformInputs, &transformOutputs, nullptr,
+                                                       r.statistics.UnsafeGetValue()));
             }
 
             std::string remappedEntryPointName;
@@ -277,6 +283,8 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
             options.external_texture_options = r.externalTextureOptions;
 
             TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "tint::writer::msl::Generate");
+            ScopedShaderCompilationTimer generateTimer(
+                r.statistics.UnsafeGetValue(), &ShaderCompilationStatistics::generateDuration);
             auto result = tint::writer::msl::Generate(&program, options);
             DAWN_INVALID_IF(!result.success, "An error occured while generating MSL: %s.",
                             result.error);
@@ -302,6 +310,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
                 localSize,
             }};
         });
+    statistics.Record(mslCompilation.IsCached());
 
     if (device->IsToggleEnabled(Toggle::DumpShaders)) {
         std::ostringstream dumpedMsg;
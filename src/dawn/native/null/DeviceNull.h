@@ -141,6 +141,12 @@ class Device final : public DeviceBase {
         const QuerySetDescriptor* descriptor) override;
     Ref<RenderPipelineBase> CreateUninitializedRenderPipelineImpl(
         const RenderPipelineDescriptor* descriptor) override;
+    void InitializeComputePipelineAsyncImpl(Ref<ComputePipelineBase> computePipeline,
+                                            WGPUCreateComputePipelineAsyncCallback callback,
+                                            void* userdata) override;
+    void InitializeRenderPipelineAsyncImpl(Ref<RenderPipelineBase> renderPipeline,
+                                           WGPUCreateRenderPipelineAsyncCallback callback,
+                                           void* userdata) override;
     ResultOrError<Ref<SamplerBase>> CreateSamplerImpl(const SamplerDescriptor* descriptor) override;
     ResultOrError<Ref<ShaderModuleBase>> CreateShaderModuleImpl(
         const ShaderModuleDescriptor* descriptor,
@@ -156,6 +162,8 @@ class Device final : public DeviceBase {
         const TextureViewDescriptor* descriptor) override;
 
     ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
+    MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                      std::chrono::nanoseconds timeout) override;
 
     void DestroyImpl() override;
     MaybeError WaitForIdleForDestruction() override;
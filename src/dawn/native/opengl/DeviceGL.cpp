@@ -360,6 +360,24 @@ ResultOrError<ExecutionSerial> Device::CheckAndUpdateCompletedSerials() {
     return fenceSerial;
 }
 
+MaybeError Device::WaitForQueueSerialImpl(ExecutionSerial serial,
+                                          std::chrono::nanoseconds timeout) {
+    // Fences are added in order so the first one is signaled for the oldest serial in flight.
+    if (mFencesInFlight.empty()) {
+        return {};
+    }
+    ASSERT(mFencesInFlight.front().second >= serial);
+    GLsync sync = mFencesInFlight.front().first;
+
+    const OpenGLFunctions& gl = GetGL();
+    // TODO(crbug.com/dawn/633): Remove this workaround after the deadlock issue is fixed.
+    if (IsToggleEnabled(Toggle::FlushBeforeClientWaitSync)) {
+        gl.Flush();
+    }
+    gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, uint64_t(timeout.count()));
+    return {};
+}
+
 MaybeError Device::CopyFromStagingToBufferImpl(BufferBase* source,
                                                uint64_t sourceOffset,
                                                BufferBase* destination,
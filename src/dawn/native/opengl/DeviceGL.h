@@ -127,6 +127,8 @@ class Device final : public DeviceBase {
 
     GLenum GetBGRAInternalFormat() const;
     ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
+    MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                      std::chrono::nanoseconds timeout) override;
     void DestroyImpl() override;
     MaybeError WaitForIdleForDestruction() override;
     bool HasPendingCommands() const override;
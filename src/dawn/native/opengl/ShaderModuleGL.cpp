@@ -20,6 +20,7 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Pipeline.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/opengl/DeviceGL.h"
 #include "dawn/native/opengl/PipelineLayoutGL.h"
@@ -58,7 +59,7 @@ tint::writer::glsl::Version::Standard ToTintGLStandard(opengl::OpenGLVersion::St
 using BindingMap = std::unordered_map<tint::writer::BindingPoint, tint::writer::BindingPoint>;
 
 #define GLSL_COMPILATION_REQUEST_MEMBERS(X)                                                 \
-    X(const tint::Program*, inputProgram)                                                   \
+    X(ProgramWithSourceDigest, inputProgram)                                                \
     X(std::string, entryPointName)                                                          \
     X(SingleShaderStage, stage)                                                             \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                         \
@@ -67,7 +68,8 @@ using BindingMap = std::unordered_map<tint::writer::BindingPoint, tint::writer::
     X(LimitsForCompilationRequest, limits)                                                  \
     X(opengl::OpenGLVersion::Standard, glVersionStandard)                                   \
     X(uint32_t, glVersionMajor)                                                             \
-    X(uint32_t, glVersionMinor)
+    X(uint32_t, glVersionMinor)                                                             \
+    X(CacheKey::UnsafeUnkeyedValue<ShaderCompilationStatistics*>, statistics)
 
 DAWN_MAKE_CACHE_REQUEST(GLSLCompilationRequest, GLSL_COMPILATION_REQUEST_MEMBERS);
 #undef GLSL_COMPILATION_REQUEST_MEMBERS
@@ -179,7 +181,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
     const CombinedLimits& limits = GetDevice()->GetLimits();
 
     GLSLCompilationRequest req = {};
-    req.inputProgram = GetTintProgram();
+    req.inputProgram = GetTintProgramWithSourceDigest();
     req.stage = stage;
     req.entryPointName = programmableStage.entryPoint;
     req.externalTextureOptions = BuildExternalTextureTransformBindings(layout);
@@ -190,6 +192,9 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
     req.glVersionMajor = version.GetMajor();
     req.glVersionMinor = version.GetMinor();
 
+    ShaderCompilationStatisticsScope statistics(this, programmableStage.entryPoint, stage, "glsl");
+    req.statistics = UnsafeUnkeyedValue(statistics.Get());
+
     CacheResult<GLSLCompilation> compilationResult;
     DAWN_TRY_LOAD_OR_RUN(
         compilationResult, GetDevice(), std::move(req), GLSLCompilation::FromBlob,
@@ -208,8 +213,9 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
             }
 
             tint::Program program;
-            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram,
-                                                   transformInputs, nullptr, nullptr));
+            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram.program,
+                                                   transformInputs, nullptr, nullptr,
+                                                   r.statistics.UnsafeGetValue()));
 
             if (r.stage == SingleShaderStage::Compute) {
                 // Validate workgroup size after program runs transforms.
@@ -263,6 +269,8 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
             tintOptions.binding_points = std::move(r.glBindings);
             tintOptions.allow_collisions = true;
 
+            ScopedShaderCompilationTimer generateTimer(
+                r.statistics.UnsafeGetValue(), &ShaderCompilationStatistics::generateDuration);
             auto result = tint::writer::glsl::Generate(&program, tintOptions, r.entryPointName);
             DAWN_INVALID_IF(!result.success, "An error occured while generating GLSL: %s.",
                             result.error);
@@ -270,6 +278,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(const OpenGLFunctions& gl,
             return GLSLCompilation{
                 {std::move(result.glsl), needsPlaceholderSampler, std::move(combinedSamplerInfo)}};
         });
+    statistics.Record(compilationResult.IsCached());
 
     if (GetDevice()->IsToggleEnabled(Toggle::DumpShaders)) {
         std::ostringstream dumpedMsg;
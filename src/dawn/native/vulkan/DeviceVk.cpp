@@ -666,6 +666,24 @@ ResultOrError<ExecutionSerial> Device::CheckAndUpdateCompletedSerials() {
     return fenceSerial;
 }
 
+MaybeError Device::WaitForQueueSerialImpl(ExecutionSerial serial,
+                                          std::chrono::nanoseconds timeout) {
+    // Fences are added in order so the first one is signaled for the oldest serial in flight.
+    if (mFencesInFlight.empty()) {
+        return {};
+    }
+    ASSERT(mFencesInFlight.front().second >= serial);
+    VkFence fence = mFencesInFlight.front().first;
+
+    VkResult result = VkResult::WrapUnsafe(
+        INJECT_ERROR_OR_RUN(fn.WaitForFences(mVkDevice, 1, &*fence, true, timeout.count()),
+                            VK_ERROR_DEVICE_LOST));
+    if (result == VK_TIMEOUT) {
+        return {};
+    }
+    return CheckVkSuccess(::VkResult(result), "WaitForFences");
+}
+
 MaybeError Device::PrepareRecordingContext() {
     ASSERT(!mRecordingContext.needsSubmit);
     ASSERT(mRecordingContext.commandBuffer == VK_NULL_HANDLE);
@@ -189,6 +189,8 @@ class Device final : public DeviceBase {
 
     ResultOrError<VkFence> GetUnusedFence();
     ResultOrError<ExecutionSerial> CheckAndUpdateCompletedSerials() override;
+    MaybeError WaitForQueueSerialImpl(ExecutionSerial serial,
+                                      std::chrono::nanoseconds timeout) override;
 
     // We track which operations are in flight on the GPU with an increasing serial.
     // This works only because we have a single queue. Each submit to a queue is associated
@@ -20,8 +20,10 @@
 #include <string>
 #include <vector>
 
+#include "dawn/common/SingleFlightCache.h"
 #include "dawn/native/CacheRequest.h"
 #include "dawn/native/Serializable.h"
+#include "dawn/native/ShaderCompilationStatistics.h"
 #include "dawn/native/SpirvValidation.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
@@ -66,47 +68,44 @@ size_t TransformedShaderModuleCacheKeyHashFunc::operator()(
     return hash;
 }
 
+// Concurrent requests for the same key are coalesced: only the first one compiles the SPIR-V and
+// creates the VkShaderModule while the others wait for its result.
 class ShaderModule::ConcurrentTransformedShaderModuleCache {
   public:
     explicit ConcurrentTransformedShaderModuleCache(Device* device) : mDevice(device) {}
 
     ~ConcurrentTransformedShaderModuleCache() {
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        for (const auto& [_, moduleAndSpirv] : mTransformedShaderModuleCache) {
-            mDevice->GetFencedDeleter()->DeleteWhenUnused(moduleAndSpirv.vkModule);
-        }
+        mCache.ForEachValue([this](const Entry& entry) {
+            mDevice->GetFencedDeleter()->DeleteWhenUnused(entry.vkModule);
+        });
     }
 
-    std::optional<ModuleAndSpirv> Find(const TransformedShaderModuleCacheKey& key) {
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        auto iter = mTransformedShaderModuleCache.find(key);
-        if (iter != mTransformedShaderModuleCache.end()) {
-            return iter->second.AsRefs();
+    // Returns the cached handle and SPIR-V for |key|, waiting for them if another thread is
+    // creating them. Returns std::nullopt if the caller must create them and then call either
+    // Add or AbandonCreation.
+    std::optional<ModuleAndSpirv> FindOrBeginCreation(const TransformedShaderModuleCacheKey& key) {
+        const Entry* entry = mCache.Acquire(key);
+        if (entry == nullptr) {
+            return {};
         }
-        return {};
+        return entry->AsRefs();
     }
-    ModuleAndSpirv AddOrGet(const TransformedShaderModuleCacheKey& key,
-                            VkShaderModule module,
-                            CompiledSpirv compilation) {
+
+    ModuleAndSpirv Add(const TransformedShaderModuleCacheKey& key,
+                       VkShaderModule module,
+                       CompiledSpirv compilation) {
         ASSERT(module != VK_NULL_HANDLE);
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        auto iter = mTransformedShaderModuleCache.find(key);
-        if (iter == mTransformedShaderModuleCache.end()) {
-            bool added = false;
-            std::tie(iter, added) = mTransformedShaderModuleCache.emplace(
-                key, Entry{module, std::move(compilation.spirv),
-                           std::move(compilation.remappedEntryPoint)});
-            ASSERT(added);
-        } else {
-            // No need to use FencedDeleter since this shader module was just created and does
-            // not need to wait for queue operations to complete.
-            // Also, use of fenced deleter here is not thread safe.
-            mDevice->fn.DestroyShaderModule(mDevice->GetVkDevice(), module, nullptr);
-        }
-        return iter->second.AsRefs();
+        const Entry* entry =
+            mCache.Complete(key, Entry{module, std::move(compilation.spirv),
+                                       std::move(compilation.remappedEntryPoint)});
+        return entry->AsRefs();
+    }
+
+    void AbandonCreation(const TransformedShaderModuleCacheKey& key) { mCache.Abandon(key); }
+
+    TransformedShaderModuleCacheStats GetStats() const {
+        auto stats = mCache.GetStats();
+        return {stats.hits, stats.misses, stats.coalescedWaits};
     }
 
   private:
@@ -126,11 +125,10 @@ class ShaderModule::ConcurrentTransformedShaderModuleCache {
     };
 
     Device* mDevice;
-    std::mutex mMutex;
-    std::unordered_map<TransformedShaderModuleCacheKey,
-                       Entry,
-                       TransformedShaderModuleCacheKeyHashFunc>
-        mTransformedShaderModuleCache;
+    SingleFlightCache<TransformedShaderModuleCacheKey,
+                      Entry,
+                      TransformedShaderModuleCacheKeyHashFunc>
+        mCache;
 };
 
 // static
@@ -163,9 +161,15 @@ void ShaderModule::DestroyImpl() {
 
 ShaderModule::~ShaderModule() = default;
 
+TransformedShaderModuleCacheStats ShaderModule::GetTransformedShaderModuleCacheStatsForTesting()
+    const {
+    ASSERT(mTransformedShaderModuleCache != nullptr);
+    return mTransformedShaderModuleCache->GetStats();
+}
+
 #define SPIRV_COMPILATION_REQUEST_MEMBERS(X)                                                \
     X(SingleShaderStage, stage)                                                             \
-    X(const tint::Program*, inputProgram)                                                   \
+    X(ProgramWithSourceDigest, inputProgram)                                                \
     X(tint::writer::BindingRemapperOptions, bindingRemapper)                                \
     X(tint::writer::ExternalTextureOptions, externalTextureOptions)                         \
     X(std::optional<tint::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
@@ -176,7 +180,8 @@ ShaderModule::~ShaderModule() = default;
     X(bool, disableSymbolRenaming)                                                          \
     X(bool, useZeroInitializeWorkgroupMemoryExtension)                                      \
     X(bool, clampFragDepth)                                                                 \
-    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform)
+    X(CacheKey::UnsafeUnkeyedValue<dawn::platform::Platform*>, tracePlatform)               \
+    X(CacheKey::UnsafeUnkeyedValue<ShaderCompilationStatistics*>, statistics)
 
 DAWN_MAKE_CACHE_REQUEST(SpirvCompilationRequest, SPIRV_COMPILATION_REQUEST_MEMBERS);
 #undef SPIRV_COMPILATION_REQUEST_MEMBERS
@@ -193,14 +198,34 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 
     ScopedTintICEHandler scopedICEHandler(GetDevice());
 
-    // Check to see if we have the handle and spirv cached already.
+    // Check to see if we have the handle and spirv cached already, or if another thread is
+    // already creating them.
     auto cacheKey = TransformedShaderModuleCacheKey{layout, programmableStage.entryPoint.c_str(),
                                                     programmableStage.constants};
-    auto handleAndSpirv = mTransformedShaderModuleCache->Find(cacheKey);
+    ShaderCompilationStatisticsScope statistics(this, programmableStage.entryPoint, stage, "spirv");
+    auto handleAndSpirv = mTransformedShaderModuleCache->FindOrBeginCreation(cacheKey);
     if (handleAndSpirv.has_value()) {
+        statistics.RecordInMemoryCacheHit();
         return std::move(*handleAndSpirv);
     }
 
+    // This thread is now responsible for creating the handle and spirv. Let the threads waiting
+    // for them try again if that fails.
+    ResultOrError<ModuleAndSpirv> result = CreateHandleAndSpirv(
+        cacheKey, stage, programmableStage, layout, clampFragDepth, &statistics);
+    if (result.IsError()) {
+        mTransformedShaderModuleCache->AbandonCreation(cacheKey);
+    }
+    return result;
+}
+
+ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::CreateHandleAndSpirv(
+    const TransformedShaderModuleCacheKey& cacheKey,
+    SingleShaderStage stage,
+    const ProgrammableStage& programmableStage,
+    const PipelineLayout* layout,
+    bool clampFragDepth,
+    ShaderCompilationStatisticsScope* statistics) {
     // Creation of module and spirv is deferred to this point when using tint generator
 
     // Remap BindingNumber to BindingIndex in WGSL shader
@@ -252,7 +277,7 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 #if TINT_BUILD_SPV_WRITER
     SpirvCompilationRequest req = {};
     req.stage = stage;
-    req.inputProgram = GetTintProgram();
+    req.inputProgram = GetTintProgramWithSourceDigest();
     req.bindingRemapper = std::move(bindingRemapper);
     req.externalTextureOptions = std::move(externalTextureOptions);
     req.entryPointName = programmableStage.entryPoint;
@@ -265,6 +290,8 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
     req.tracePlatform = UnsafeUnkeyedValue(GetDevice()->GetPlatform());
     req.substituteOverrideConfig = std::move(substituteOverrideConfig);
 
+    req.statistics = UnsafeUnkeyedValue(statistics->Get());
+
     const CombinedLimits& limits = GetDevice()->GetLimits();
     req.limits = LimitsForCompilationRequest::Create(limits.v1);
 
@@ -298,9 +325,9 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
             tint::transform::DataMap transformOutputs;
             {
                 TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
+                DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, r.inputProgram.program,
+                                                       transformInputs, &transformOutputs, nullptr,
+                                                       r.statistics.UnsafeGetValue()));
             }
 
             // Get the entry point name after the renamer pass.
@@ -336,6 +363,8 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 
             TRACE_EVENT0(r.tracePlatform.UnsafeGetValue(), General,
                          "tint::writer::spirv::Generate()");
+            ScopedShaderCompilationTimer generateTimer(
+                r.statistics.UnsafeGetValue(), &ShaderCompilationStatistics::generateDuration);
             auto tintResult = tint::writer::spirv::Generate(&program, options);
             DAWN_INVALID_IF(!tintResult.success, "An error occured while generating SPIR-V: %s.",
                             tintResult.error);
@@ -345,6 +374,7 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
             result.remappedEntryPoint = remappedEntryPoint;
             return result;
         });
+    statistics->Record(compilation.IsCached());
 
 #ifdef DAWN_ENABLE_SPIRV_VALIDATION
     DAWN_TRY(ValidateSpirv(GetDevice(), compilation->spirv.data(), compilation->spirv.size(),
@@ -368,18 +398,17 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
             "CreateShaderModule"));
     }
 
-    ModuleAndSpirv moduleAndSpirv;
-    if (newHandle != VK_NULL_HANDLE) {
-        device->GetBlobCache()->EnsureStored(compilation);
-
-        // Set the label on `newHandle` now, and not on `moduleAndSpirv.module` later
-        // since `moduleAndSpirv.module` may be in use by multiple threads.
-        SetDebugName(ToBackend(GetDevice()), newHandle, "Dawn_ShaderModule", GetLabel());
-        moduleAndSpirv =
-            mTransformedShaderModuleCache->AddOrGet(cacheKey, newHandle, compilation.Acquire());
+    if (newHandle == VK_NULL_HANDLE) {
+        mTransformedShaderModuleCache->AbandonCreation(cacheKey);
+        return ModuleAndSpirv{};
     }
 
-    return std::move(moduleAndSpirv);
+    device->GetBlobCache()->EnsureStored(compilation);
+
+    // Set the label on `newHandle` now, and not on `moduleAndSpirv.module` later
+    // since `moduleAndSpirv.module` may be in use by multiple threads.
+    SetDebugName(ToBackend(GetDevice()), newHandle, "Dawn_ShaderModule", GetLabel());
+    return mTransformedShaderModuleCache->Add(cacheKey, newHandle, compilation.Acquire());
 #else
     return DAWN_INTERNAL_ERROR("TINT_BUILD_SPV_WRITER is not defined.");
 #endif
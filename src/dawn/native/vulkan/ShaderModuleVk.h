@@ -15,6 +15,7 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_SHADERMODULEVK_H_
 #define SRC_DAWN_NATIVE_VULKAN_SHADERMODULEVK_H_
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -30,6 +31,7 @@
 namespace dawn::native {
 
 struct ProgrammableStage;
+class ShaderCompilationStatisticsScope;
 
 namespace vulkan {
 
@@ -45,6 +47,13 @@ struct TransformedShaderModuleCacheKeyHashFunc {
     size_t operator()(const TransformedShaderModuleCacheKey& key) const;
 };
 
+struct TransformedShaderModuleCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+    // Requests that waited for another thread to compile the same shader.
+    uint64_t coalescedWaits;
+};
+
 class Device;
 class PipelineLayout;
 
@@ -67,6 +76,8 @@ class ShaderModule final : public ShaderModuleBase {
                                                     const PipelineLayout* layout,
                                                     bool clampFragDepth);
 
+    TransformedShaderModuleCacheStats GetTransformedShaderModuleCacheStatsForTesting() const;
+
   private:
     ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
     ~ShaderModule() override;
@@ -74,6 +85,14 @@ class ShaderModule final : public ShaderModuleBase {
                           OwnedCompilationMessages* compilationMessages);
     void DestroyImpl() override;
 
+    ResultOrError<ModuleAndSpirv> CreateHandleAndSpirv(
+        const TransformedShaderModuleCacheKey& cacheKey,
+        SingleShaderStage stage,
+        const ProgrammableStage& programmableStage,
+        const PipelineLayout* layout,
+        bool clampFragDepth,
+        ShaderCompilationStatisticsScope* statistics);
+
     // New handles created by GetHandleAndSpirv at pipeline creation time.
     class ConcurrentTransformedShaderModuleCache;
     std::unique_ptr<ConcurrentTransformedShaderModuleCache> mTransformedShaderModuleCache;
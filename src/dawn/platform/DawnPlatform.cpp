@@ -57,6 +57,10 @@ dawn::platform::CachingInterface* Platform::GetCachingInterface() {
     return nullptr;
 }
 
+size_t Platform::GetCachingMemoryBudget() {
+    return 32 * 1024 * 1024;
+}
+
 std::unique_ptr<dawn::platform::WorkerTaskPool> Platform::CreateWorkerTaskPool() {
     return std::make_unique<AsyncWorkerThreadPool>();
 }
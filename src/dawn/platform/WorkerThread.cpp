@@ -14,18 +14,31 @@
 
 #include "dawn/platform/WorkerThread.h"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
-#include <functional>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn::platform {
 
 namespace {
 
-class AsyncWaitableEventImpl {
-  public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
+// Upper bound on the number of idle WaitableEventStates kept around for reuse.
+constexpr size_t kMaxFreeWaitableEventStates = 256;
 
+class WaitableEventStatePool;
+
+// The state is referenced by exactly two owners: the task, until it has run, and the WaitableEvent
+// returned to the caller. The last one to release it gives it back to its pool.
+class WaitableEventState {
+  public:
     void Wait() {
         std::unique_lock<std::mutex> lock(mMutex);
         mCondition.wait(lock, [this] { return mIsComplete; });
@@ -44,47 +57,308 @@ class AsyncWaitableEventImpl {
         mCondition.notify_all();
     }
 
+    void Release();
+
   private:
+    friend class WaitableEventStatePool;
+
     std::mutex mMutex;
     std::condition_variable mCondition;
-    bool mIsComplete;
+    bool mIsComplete = false;
+
+    std::atomic<uint32_t> mRefCount{0};
+    // Keeps the free list alive even if the AsyncWorkerThreadPool is destroyed before all the
+    // WaitableEvents it returned. Only set while the state is in use so that states in the free
+    // list don't keep their pool alive.
+    Ref<WaitableEventStatePool> mPool;
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+class WaitableEventStatePool : public RefCounted {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+    ~WaitableEventStatePool() override {
+        for (WaitableEventState* state : mFreeStates) {
+            delete state;
+        }
+    }
 
-    void Wait() override { mWaitableEventImpl->Wait(); }
+    WaitableEventState* Acquire() {
+        WaitableEventState* state = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mFreeStates.empty()) {
+                state = mFreeStates.back();
+                mFreeStates.pop_back();
+            }
+        }
+        if (state == nullptr) {
+            state = new WaitableEventState();
+        }
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
+        // No other thread references a state that is in the free list.
+        state->mIsComplete = false;
+        state->mRefCount.store(2, std::memory_order_relaxed);
+        state->mPool = this;
+        return state;
+    }
 
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
+    void Recycle(WaitableEventState* state) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mFreeStates.size() >= kMaxFreeWaitableEventStates) {
+            delete state;
+            return;
+        }
+        mFreeStates.push_back(state);
     }
 
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    std::mutex mMutex;
+    std::vector<WaitableEventState*> mFreeStates;
 };
 
+void WaitableEventState::Release() {
+    if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    // Move the reference to the pool on the stack first: it may be the last one, in which case
+    // the pool (and this state with it) is deleted at the end of this scope.
+    Ref<WaitableEventStatePool> pool = std::move(mPool);
+    pool->Recycle(this);
+}
+
 }  // anonymous namespace
 
-namespace dawn::platform {
+class AsyncWorkerThreadPool::Impl {
+  public:
+    explicit Impl(uint32_t threadCount);
+    ~Impl();
 
-std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
+    std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata);
+
+    uint32_t GetThreadCount() const;
+
+  private:
+    struct Task {
+        dawn::platform::PostWorkerTaskCallback callback = nullptr;
+        void* userdata = nullptr;
+        WaitableEventState* event = nullptr;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    class Event final : public dawn::platform::WaitableEvent {
+      public:
+        explicit Event(WaitableEventState* state) : mState(state) {}
+        ~Event() override { mState->Release(); }
+
+        void Wait() override;
+
+        bool IsComplete() override { return mState->IsComplete(); }
+
+      private:
+        WaitableEventState* mState;
+    };
+
+    void EnsureThreadsStarted();
+    void WorkerMain(uint32_t workerIndex);
+    bool PopOrStealTask(uint32_t workerIndex, Task* task);
+    static void RunTask(Task* task);
+    // Runs the queued tasks on the current worker until |state| is complete or there are no
+    // queued tasks left, in which case the task of |state| is already running on another worker.
+    void RunTasksUntilComplete(WaitableEventState* state);
+
+    const uint32_t mThreadCount;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::once_flag mStartThreadsFlag;
+    std::atomic<uint32_t> mNextWorker{0};
+
+    // Number of tasks that were posted and not yet taken by a worker. It is only incremented
+    // while holding mSleepMutex so that workers never miss a wakeup.
+    std::atomic<uint64_t> mQueuedTaskCount{0};
+    std::mutex mSleepMutex;
+    std::condition_variable mSleepCondition;
+    bool mIsShuttingDown = false;
+
+    Ref<WaitableEventStatePool> mEventStatePool;
+
+    // The pool that the current thread is a worker of, if any, and the index of that worker. Used
+    // to push tasks posted from a task onto the deque of the worker running it, and to run tasks
+    // while that worker waits on an event.
+    static thread_local Impl* sCurrentPool;
+    static thread_local uint32_t sCurrentWorkerIndex;
+};
+
+thread_local AsyncWorkerThreadPool::Impl* AsyncWorkerThreadPool::Impl::sCurrentPool = nullptr;
+thread_local uint32_t AsyncWorkerThreadPool::Impl::sCurrentWorkerIndex = 0;
+
+AsyncWorkerThreadPool::Impl::Impl(uint32_t threadCount)
+    : mThreadCount(threadCount != 0 ? threadCount
+                                    : std::max(1u, std::thread::hardware_concurrency())),
+      mEventStatePool(AcquireRef(new WaitableEventStatePool())) {
+    mWorkers.reserve(mThreadCount);
+    for (uint32_t i = 0; i < mThreadCount; ++i) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+}
+
+AsyncWorkerThreadPool::Impl::~Impl() {
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mIsShuttingDown = true;
+    }
+    mSleepCondition.notify_all();
+
+    for (std::unique_ptr<Worker>& worker : mWorkers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    ASSERT(mQueuedTaskCount.load() == 0);
+}
+
+uint32_t AsyncWorkerThreadPool::Impl::GetThreadCount() const {
+    return mThreadCount;
+}
+
+std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::Impl::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+    EnsureThreadsStarted();
 
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()]() {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    Task task;
+    task.callback = callback;
+    task.userdata = userdata;
+    task.event = mEventStatePool->Acquire();
+    auto waitableEvent = std::make_unique<Event>(task.event);
 
-    std::thread thread(doTask);
-    thread.detach();
+    // Tasks posted from one of our workers are likely to be related to the one it is running, so
+    // keep them local to that worker. Others are spread round-robin and balanced by stealing.
+    uint32_t workerIndex = sCurrentPool == this
+                               ? sCurrentWorkerIndex
+                               : mNextWorker.fetch_add(1, std::memory_order_relaxed) % mThreadCount;
+    {
+        // Count the task before making it visible so that the count never underflows. A worker
+        // woken up in between spins until the task is pushed.
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mQueuedTaskCount.fetch_add(1, std::memory_order_release);
+    }
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->tasks.push_back(std::move(task));
+    }
+    mSleepCondition.notify_one();
 
     return waitableEvent;
 }
 
+void AsyncWorkerThreadPool::Impl::EnsureThreadsStarted() {
+    std::call_once(mStartThreadsFlag, [this] {
+        for (uint32_t i = 0; i < mThreadCount; ++i) {
+            mWorkers[i]->thread = std::thread([this, i] { WorkerMain(i); });
+        }
+    });
+}
+
+void AsyncWorkerThreadPool::Impl::WorkerMain(uint32_t workerIndex) {
+    sCurrentPool = this;
+    sCurrentWorkerIndex = workerIndex;
+
+    while (true) {
+        Task task;
+        if (PopOrStealTask(workerIndex, &task)) {
+            RunTask(&task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mSleepCondition.wait(lock, [this] {
+            return mIsShuttingDown || mQueuedTaskCount.load(std::memory_order_acquire) != 0;
+        });
+        // Drain all the posted tasks before exiting so that their WaitableEvents complete.
+        if (mIsShuttingDown && mQueuedTaskCount.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+
+    sCurrentPool = nullptr;
+}
+
+bool AsyncWorkerThreadPool::Impl::PopOrStealTask(uint32_t workerIndex, Task* task) {
+    // Take the most recently pushed task from our own deque, it is the most likely to be hot in
+    // the cache.
+    {
+        Worker* worker = mWorkers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->tasks.empty()) {
+            *task = std::move(worker->tasks.back());
+            worker->tasks.pop_back();
+            mQueuedTaskCount.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    // Otherwise steal the oldest task of another worker.
+    for (uint32_t i = 1; i < mThreadCount; ++i) {
+        Worker* victim = mWorkers[(workerIndex + i) % mThreadCount].get();
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->tasks.empty()) {
+            *task = std::move(victim->tasks.front());
+            victim->tasks.pop_front();
+            mQueuedTaskCount.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// static
+void AsyncWorkerThreadPool::Impl::RunTask(Task* task) {
+    task->callback(task->userdata);
+    task->event->MarkAsComplete();
+    task->event->Release();
+}
+
+void AsyncWorkerThreadPool::Impl::RunTasksUntilComplete(WaitableEventState* state) {
+    ASSERT(sCurrentPool == this);
+    while (!state->IsComplete()) {
+        Task task;
+        if (!PopOrStealTask(sCurrentWorkerIndex, &task)) {
+            return;
+        }
+        RunTask(&task);
+    }
+}
+
+void AsyncWorkerThreadPool::Impl::Event::Wait() {
+    // A task waiting for the tasks it posted would block its worker while they sit in a deque,
+    // and deadlock the pool once all the workers are waiting. Instead the worker keeps running
+    // tasks, which eventually includes the ones it waits for.
+    if (sCurrentPool != nullptr) {
+        sCurrentPool->RunTasksUntilComplete(mState);
+    }
+    mState->Wait();
+}
+
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t threadCount)
+    : mImpl(std::make_unique<Impl>(threadCount)) {}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() = default;
+
+std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
+    dawn::platform::PostWorkerTaskCallback callback,
+    void* userdata) {
+    return mImpl->PostWorkerTask(callback, userdata);
+}
+
+uint32_t AsyncWorkerThreadPool::GetThreadCount() const {
+    return mImpl->GetThreadCount();
+}
+
 }  // namespace dawn::platform
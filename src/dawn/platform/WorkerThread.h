@@ -15,18 +15,40 @@
 #ifndef SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 #define SRC_DAWN_PLATFORM_WORKERTHREAD_H_
 
+#include <cstdint>
 #include <memory>
 
 #include "dawn/common/NonCopyable.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/dawn_platform_export.h"
 
 namespace dawn::platform {
 
-class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
+// A fixed-size pool of persistent worker threads. Each worker owns a deque of tasks: tasks posted
+// from a worker go to the back of its own deque, other tasks are distributed round-robin. A worker
+// runs tasks from the back of its own deque and steals from the front of the others' when it runs
+// out of work. The threads are started lazily on the first PostWorkerTask and are joined when the
+// pool is destroyed, after all the tasks that were posted have run. A task may wait on the events
+// of the tasks it posted: its worker runs queued tasks until the event completes instead of
+// blocking.
+class DAWN_PLATFORM_EXPORT AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool,
+                                                   public NonCopyable {
   public:
+    // A |threadCount| of 0 picks a number of threads based on the hardware concurrency.
+    explicit AsyncWorkerThreadPool(uint32_t threadCount = 0);
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+    uint32_t GetThreadCount() const;
+
+  private:
+    // The threads, queues and refcounted event states live behind a pointer so that they aren't
+    // part of the exported class.
+    class Impl;
+    std::unique_ptr<Impl> mImpl;
 };
 
 }  // namespace dawn::platform
@@ -0,0 +1,185 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays a wire capture written with utils::CaptureCommandSerializer through a WireServer on top
+// of the Null backend, as fast as possible, and reports the number of commands handled per second
+// along with the CPU time and the heap allocations of each type of command. Only the allocations
+// made by the replay thread are counted.
+//
+// Usage: dawn_wire_replay [--iterations=N] <capture file>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/WireCapture.h"
+#include "dawn/webgpu_cpp.h"
+#include "src/tint/utils/allocation_counter.h"
+
+namespace {
+
+struct CommandStats {
+    uint64_t count = 0;
+    uint64_t allocations = 0;
+    std::chrono::nanoseconds duration{0};
+};
+
+// Accumulates the statistics of each type of command. The allocations made between two commands,
+// including the ones of the observer itself, aren't attributed to any command.
+class StatsObserver : public utils::WireReplayObserver {
+  public:
+    void OnCommandBegin() override { mAllocationsAtBegin = mAllocationCounter.Count(); }
+
+    void OnCommandEnd(const char* name, std::chrono::nanoseconds duration) override {
+        uint64_t allocations = mAllocationCounter.Count() - mAllocationsAtBegin;
+
+        CommandStats& commandStats = mStats[name];
+        commandStats.count++;
+        commandStats.allocations += allocations;
+        commandStats.duration += duration;
+        mTotal.count++;
+        mTotal.allocations += allocations;
+        mTotal.duration += duration;
+    }
+
+    const std::unordered_map<const char*, CommandStats>& GetStats() const { return mStats; }
+    const CommandStats& GetTotal() const { return mTotal; }
+
+  private:
+    tint::utils::ScopedAllocationCounter mAllocationCounter;
+    uint64_t mAllocationsAtBegin = 0;
+    std::unordered_map<const char*, CommandStats> mStats;
+    CommandStats mTotal;
+};
+
+dawn::native::Adapter sNullAdapter;
+
+bool LoadCapture(const char* path, std::vector<utils::WireCaptureRecord>* records) {
+    std::unique_ptr<utils::WireCaptureReader> reader = utils::WireCaptureReader::Open(path);
+    if (reader == nullptr) {
+        fprintf(stderr, "Couldn't open wire capture %s.\n", path);
+        return false;
+    }
+
+    utils::WireCaptureRecord record;
+    while (reader->ReadRecord(&record.type, &record.data)) {
+        records->push_back(std::move(record));
+        record = {};
+    }
+    return true;
+}
+
+void PrintUsage(const char* program) {
+    fprintf(stderr, "Usage: %s [--iterations=N] <capture file>\n", program);
+}
+
+}  // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+    uint32_t iterations = 1;
+    const char* capturePath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        constexpr const char kIterationsArg[] = "--iterations=";
+        if (strncmp(argv[i], kIterationsArg, sizeof(kIterationsArg) - 1) == 0) {
+            iterations = static_cast<uint32_t>(strtoul(argv[i] + sizeof(kIterationsArg) - 1,
+                                                       nullptr, 0));
+        } else if (argv[i][0] != '-' && capturePath == nullptr) {
+            capturePath = argv[i];
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (capturePath == nullptr || iterations == 0) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<utils::WireCaptureRecord> records;
+    if (!LoadCapture(capturePath, &records)) {
+        return 1;
+    }
+
+    auto instance = std::make_unique<dawn::native::Instance>();
+    instance->DiscoverDefaultAdapters();
+    for (const dawn::native::Adapter& adapter : instance->GetAdapters()) {
+        wgpu::AdapterProperties properties;
+        adapter.GetProperties(&properties);
+        if (properties.backendType == wgpu::BackendType::Null) {
+            sNullAdapter = adapter;
+            break;
+        }
+    }
+    if (!sNullAdapter) {
+        fprintf(stderr, "The Null backend isn't available.\n");
+        return 1;
+    }
+
+    // Always return the Null adapter so that the replay doesn't depend on the adapters of the
+    // system where the capture was made.
+    DawnProcTable procs = dawn::native::GetProcs();
+    procs.instanceRequestAdapter = [](WGPUInstance, const WGPURequestAdapterOptions*,
+                                      WGPURequestAdapterCallback callback, void* userdata) {
+        WGPUAdapter adapter = sNullAdapter.Get();
+        dawn::native::GetProcs().adapterReference(adapter);
+        callback(WGPURequestAdapterStatus_Success, adapter, nullptr, userdata);
+    };
+
+    StatsObserver observer;
+    bool success = true;
+    for (uint32_t i = 0; i < iterations && success; ++i) {
+        success = utils::ReplayWireCapture(records, procs, instance->Get(),
+                                           [] { return sNullAdapter.CreateDevice(); }, &observer);
+    }
+
+    // Release the adapter before the instance.
+    sNullAdapter = {};
+    instance = nullptr;
+    if (!success) {
+        return 1;
+    }
+
+    const std::unordered_map<const char*, CommandStats>& stats = observer.GetStats();
+    std::vector<std::pair<const char*, CommandStats>> sortedStats(stats.begin(), stats.end());
+    std::sort(sortedStats.begin(), sortedStats.end(), [](const auto& a, const auto& b) {
+        return a.second.duration > b.second.duration;
+    });
+
+    const CommandStats& total = observer.GetTotal();
+    double seconds = std::chrono::duration<double>(total.duration).count();
+    printf("%llu commands in %.3f ms over %u iteration(s): %.0f commands/s, %.2f allocs/command\n",
+           static_cast<unsigned long long>(total.count), seconds * 1e3, iterations,
+           seconds > 0 ? total.count / seconds : 0.0,
+           total.count > 0 ? static_cast<double>(total.allocations) / total.count : 0.0);
+    printf("%-40s %12s %14s %12s %14s\n", "command", "count", "total (ns)", "mean (ns)",
+           "allocs/command");
+    for (const auto& [name, commandStats] : sortedStats) {
+        uint64_t totalNs = static_cast<uint64_t>(commandStats.duration.count());
+        printf("%-40s %12llu %14llu %12llu %14.2f\n", name,
+               static_cast<unsigned long long>(commandStats.count),
+               static_cast<unsigned long long>(totalNs),
+               static_cast<unsigned long long>(totalNs / commandStats.count),
+               static_cast<double>(commandStats.allocations) / commandStats.count);
+    }
+
+    return 0;
+}
@@ -201,6 +201,12 @@ void DawnTestEnvironment::ParseArgs(int argc, char** argv) {
             continue;
         }
 
+        if (strcmp("--use-wire-server-thread", argv[i]) == 0) {
+            mUseWire = true;
+            mWireTransport = utils::WireTransport::ServerThread;
+            continue;
+        }
+
         if (strcmp("-s", argv[i]) == 0 || strcmp("--enable-implicit-device-sync", argv[i]) == 0) {
             mEnableImplicitDeviceSync = true;
             continue;
@@ -332,6 +338,9 @@ void DawnTestEnvironment::ParseArgs(int argc, char** argv) {
                    "[--enable-backend-validation[=full,partial,disabled]]\n"
                    "    [--exclusive-device-type-preference=integrated,cpu,discrete]\n\n"
                    "  -w, --use-wire: Run the tests through the wire (defaults to no wire)\n"
+                   "  --use-wire-server-thread: Run the tests through the wire, with the wire "
+                   "server on its\n"
+                   "    own thread receiving the commands through a ring buffer\n"
                    "  -s, --enable-implicit-device-sync: Run the tests with implicit device "
                    "synchronization feature (defaults to false)\n"
                    "  -c, --begin-capture-on-startup: Begin debug capture on startup "
@@ -521,6 +530,9 @@ void DawnTestEnvironment::PrintTestConfigurationAndAdapterInfo(
            "---------------------\n"
            "UseWire: "
         << (mUseWire ? "true" : "false")
+        << "\n"
+           "Wire server thread: "
+        << (mWireTransport == utils::WireTransport::ServerThread ? "true" : "false")
         << "\n"
            "Implicit device synchronization: "
         << (mEnableImplicitDeviceSync ? "enabled" : "disabled")
@@ -609,6 +621,10 @@ bool DawnTestEnvironment::UsesWire() const {
     return mUseWire;
 }
 
+utils::WireTransport DawnTestEnvironment::GetWireTransport() const {
+    return mWireTransport;
+}
+
 bool DawnTestEnvironment::IsImplicitDeviceSyncEnabled() const {
     return mEnableImplicitDeviceSync;
 }
@@ -712,7 +728,8 @@ DawnTestBase::DawnTestBase(const AdapterTestParam& param) : mParam(param) {
         callback(WGPURequestDeviceStatus_Success, cDevice, nullptr, userdata);
     };
 
-    mWireHelper = utils::CreateWireHelper(procs, gTestEnv->UsesWire(), gTestEnv->GetWireTraceDir());
+    mWireHelper = utils::CreateWireHelper(procs, gTestEnv->UsesWire(), gTestEnv->GetWireTraceDir(),
+                                          gTestEnv->GetWireTransport());
 }
 
 DawnTestBase::~DawnTestBase() {
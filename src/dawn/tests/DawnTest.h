@@ -35,6 +35,7 @@
 #include "dawn/utils/ScopedAutoreleasePool.h"
 #include "dawn/utils/TestUtils.h"
 #include "dawn/utils/TextureUtils.h"
+#include "dawn/utils/WireHelper.h"
 #include "dawn/webgpu_cpp.h"
 #include "dawn/webgpu_cpp_print.h"
 #include "gmock/gmock.h"
@@ -128,7 +129,6 @@ struct GLFWwindow;
 namespace utils {
 class PlatformDebugLogger;
 class TerribleCommandBuffer;
-class WireHelper;
 }  // namespace utils
 
 namespace detail {
@@ -166,6 +166,7 @@ class DawnTestEnvironment : public testing::Environment {
     void TearDown() override;
 
     bool UsesWire() const;
+    utils::WireTransport GetWireTransport() const;
     bool IsImplicitDeviceSyncEnabled() const;
     dawn::native::BackendValidationLevel GetBackendValidationLevel() const;
     dawn::native::Instance* GetInstance() const;
@@ -194,6 +195,7 @@ class DawnTestEnvironment : public testing::Environment {
     bool ValidateToggles(dawn::native::Instance* instance) const;
 
     bool mUseWire = false;
+    utils::WireTransport mWireTransport = utils::WireTransport::Synchronous;
     bool mEnableImplicitDeviceSync = false;
     dawn::native::BackendValidationLevel mBackendValidationLevel =
         dawn::native::BackendValidationLevel::Disabled;
@@ -252,6 +254,7 @@ class DawnTestBase {
     bool IsAndroid() const;
 
     bool UsesWire() const;
+    utils::WireTransport GetWireTransport() const;
     bool IsImplicitDeviceSyncEnabled() const;
     bool IsBackendValidationEnabled() const;
     bool IsFullBackendValidationEnabled() const;
@@ -76,9 +76,14 @@ void CachingInterfaceMock::StoreDataDefault(const void* key,
     mCache.insert_or_assign(keyStr, entry);
 }
 
-DawnCachingMockPlatform::DawnCachingMockPlatform(dawn::platform::CachingInterface* cachingInterface)
-    : mCachingInterface(cachingInterface) {}
+DawnCachingMockPlatform::DawnCachingMockPlatform(dawn::platform::CachingInterface* cachingInterface,
+                                                 size_t cachingMemoryBudget)
+    : mCachingInterface(cachingInterface), mCachingMemoryBudget(cachingMemoryBudget) {}
 
 dawn::platform::CachingInterface* DawnCachingMockPlatform::GetCachingInterface() {
     return mCachingInterface;
 }
+
+size_t DawnCachingMockPlatform::GetCachingMemoryBudget() {
+    return mCachingMemoryBudget;
+}
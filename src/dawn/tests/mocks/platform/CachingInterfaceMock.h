@@ -81,15 +81,19 @@ class CachingInterfaceMock : public dawn::platform::CachingInterface {
     std::unordered_map<std::string, std::vector<uint8_t>> mCache;
 };
 
-// Dawn platform used for testing with a mock caching interface.
+// Dawn platform used for testing with a mock caching interface. Dawn's in-memory cache in front of
+// the caching interface is disabled by default so that all loads go through the mock.
 class DawnCachingMockPlatform : public dawn::platform::Platform {
   public:
-    explicit DawnCachingMockPlatform(dawn::platform::CachingInterface* cachingInterface);
+    explicit DawnCachingMockPlatform(dawn::platform::CachingInterface* cachingInterface,
+                                     size_t cachingMemoryBudget = 0);
 
     dawn::platform::CachingInterface* GetCachingInterface() override;
+    size_t GetCachingMemoryBudget() override;
 
   private:
     dawn::platform::CachingInterface* mCachingInterface = nullptr;
+    size_t mCachingMemoryBudget = 0;
 };
 
 #endif  // SRC_DAWN_TESTS_MOCKS_PLATFORM_CACHINGINTERFACEMOCK_H_
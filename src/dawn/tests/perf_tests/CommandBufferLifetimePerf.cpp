@@ -0,0 +1,95 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kNumCommandBuffers = 256;
+
+constexpr uint32_t kTextureSize = 16;
+
+struct CommandBufferLifetimeParams : AdapterTestParam {
+    CommandBufferLifetimeParams(const AdapterTestParam& param, uint32_t drawCountIn)
+        : AdapterTestParam(param), drawCount(drawCountIn) {}
+    uint32_t drawCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const CommandBufferLifetimeParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_draws_" << param.drawCount;
+    return ostream;
+}
+
+}  // namespace
+
+// Encodes, submits and drops kNumCommandBuffers single-pass command buffers per step. Each one
+// needs fresh command blocks, so the step is dominated by their allocation unless the device
+// recycles them. The disable_command_block_pool variant shows the cost without recycling.
+class CommandBufferLifetimePerf : public DawnPerfTestWithParams<CommandBufferLifetimeParams> {
+  public:
+    CommandBufferLifetimePerf() : DawnPerfTestWithParams(kNumCommandBuffers, 1) {}
+    ~CommandBufferLifetimePerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    utils::BasicRenderPass mRenderPass;
+    wgpu::RenderPipeline mPipeline;
+};
+
+void CommandBufferLifetimePerf::SetUp() {
+    DawnPerfTestWithParams<CommandBufferLifetimeParams>::SetUp();
+
+    mRenderPass = utils::CreateBasicRenderPass(device, kTextureSize, kTextureSize);
+
+    utils::ComboRenderPipelineDescriptor descriptor;
+    descriptor.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main(@builtin(vertex_index) i : u32) -> @builtin(position) vec4f {
+            const pos = array(vec2f(-1.0, -1.0), vec2f(3.0, -1.0), vec2f(-1.0, 3.0));
+            return vec4f(pos[i], 0.0, 1.0);
+        })");
+    descriptor.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    descriptor.cTargets[0].format = mRenderPass.colorFormat;
+    mPipeline = device.CreateRenderPipeline(&descriptor);
+}
+
+void CommandBufferLifetimePerf::Step() {
+    for (unsigned int i = 0; i < kNumCommandBuffers; ++i) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&mRenderPass.renderPassInfo);
+        pass.SetPipeline(mPipeline);
+        for (uint32_t j = 0; j < GetParam().drawCount; ++j) {
+            pass.Draw(3);
+        }
+        pass.End();
+        wgpu::CommandBuffer commandBuffer = encoder.Finish();
+        queue.Submit(1, &commandBuffer);
+    }
+}
+
+TEST_P(CommandBufferLifetimePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(CommandBufferLifetimePerf,
+                        {NullBackend(), NullBackend({"disable_command_block_pool"}, {})},
+                        {1, 16, 256});
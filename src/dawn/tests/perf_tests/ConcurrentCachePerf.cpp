@@ -0,0 +1,229 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/ConcurrentCache.h"
+#include "dawn/common/RefCounted.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace {
+
+constexpr unsigned int kLookupsPerThread = 4096;
+constexpr size_t kCachedObjectCount = 256;
+
+enum class CacheType {
+    // A single std::mutex guarding the whole set, which is how ConcurrentCache used to work.
+    SingleLock,
+    // ConcurrentCache, with shards guarded by reader-writer locks.
+    Sharded,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const CacheType& cacheType) {
+    switch (cacheType) {
+        case CacheType::SingleLock:
+            ostream << "SingleLock";
+            break;
+        case CacheType::Sharded:
+            ostream << "Sharded";
+            break;
+    }
+    return ostream;
+}
+
+struct ConcurrentCacheParams : AdapterTestParam {
+    ConcurrentCacheParams(const AdapterTestParam& param,
+                          CacheType cacheTypeIn,
+                          uint32_t threadCountIn)
+        : AdapterTestParam(param), cacheType(cacheTypeIn), threadCount(threadCountIn) {}
+    CacheType cacheType;
+    uint32_t threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ConcurrentCacheParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.cacheType << "_threads_" << param.threadCount;
+    return ostream;
+}
+
+class CachedValue : public RefCounted {
+  public:
+    explicit CachedValue(size_t value) : mValue(value) {}
+
+    struct EqualityFunc {
+        bool operator()(const CachedValue* a, const CachedValue* b) const {
+            return a->mValue == b->mValue;
+        }
+    };
+
+    struct HashFunc {
+        size_t operator()(const CachedValue* value) const { return value->mValue; }
+    };
+
+  private:
+    size_t mValue;
+};
+
+class SingleLockCache {
+  public:
+    Ref<CachedValue> FindAndReference(CachedValue* blueprint) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mCache.find(blueprint);
+        if (iter == mCache.end() || !(*iter)->TryReference()) {
+            return nullptr;
+        }
+        return AcquireRef(*iter);
+    }
+
+    void Insert(CachedValue* value) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCache.insert(value);
+    }
+
+  private:
+    std::mutex mMutex;
+    std::unordered_set<CachedValue*, CachedValue::HashFunc, CachedValue::EqualityFunc> mCache;
+};
+
+}  // namespace
+
+// Measures the throughput of looking up existing objects in the cache used by the device to
+// deduplicate objects, such as bind group layouts and samplers, when multiple threads create them
+// concurrently. The device isn't used. The threads are started once, and each step releases them
+// to do their lookups and waits for all of them to finish.
+class ConcurrentCachePerf : public DawnPerfTestWithParams<ConcurrentCacheParams> {
+  public:
+    ConcurrentCachePerf() : DawnPerfTestWithParams(kLookupsPerThread * GetParam().threadCount, 1) {}
+    ~ConcurrentCachePerf() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void Step() override;
+
+    void ThreadMain(uint32_t threadIndex);
+
+    template <typename Cache>
+    void LookupOnThread(Cache* cache, uint32_t threadIndex);
+
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mDoneCondition;
+    // Incremented by each step to release the threads.
+    uint64_t mStepIndex = 0;
+    uint32_t mRunningThreadCount = 0;
+    bool mStopping = false;
+
+    std::vector<Ref<CachedValue>> mValues;
+    SingleLockCache mSingleLockCache;
+    ConcurrentCache<CachedValue> mShardedCache;
+};
+
+ConcurrentCachePerf::~ConcurrentCachePerf() {
+    for (Ref<CachedValue>& value : mValues) {
+        mShardedCache.Erase(value.Get());
+    }
+}
+
+void ConcurrentCachePerf::SetUp() {
+    DawnPerfTestWithParams<ConcurrentCacheParams>::SetUp();
+
+    for (size_t i = 0; i < kCachedObjectCount; ++i) {
+        mValues.push_back(AcquireRef(new CachedValue(i)));
+        mSingleLockCache.Insert(mValues.back().Get());
+        mShardedCache.Insert(mValues.back().Get());
+    }
+
+    for (uint32_t i = 0; i < GetParam().threadCount; ++i) {
+        mThreads.emplace_back([this, i] { ThreadMain(i); });
+    }
+}
+
+void ConcurrentCachePerf::TearDown() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mStartCondition.notify_all();
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+    mThreads.clear();
+
+    DawnPerfTestWithParams<ConcurrentCacheParams>::TearDown();
+}
+
+void ConcurrentCachePerf::ThreadMain(uint32_t threadIndex) {
+    uint64_t lastStepIndex = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(lock, [&] { return mStopping || mStepIndex != lastStepIndex; });
+            if (mStopping) {
+                return;
+            }
+            lastStepIndex = mStepIndex;
+        }
+
+        switch (GetParam().cacheType) {
+            case CacheType::SingleLock:
+                LookupOnThread(&mSingleLockCache, threadIndex);
+                break;
+            case CacheType::Sharded:
+                LookupOnThread(&mShardedCache, threadIndex);
+                break;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (--mRunningThreadCount == 0) {
+            mDoneCondition.notify_one();
+        }
+    }
+}
+
+template <typename Cache>
+void ConcurrentCachePerf::LookupOnThread(Cache* cache, uint32_t threadIndex) {
+    // Each thread looks up all the objects in a different order.
+    size_t index = threadIndex;
+    for (unsigned int i = 0; i < kLookupsPerThread; ++i) {
+        CachedValue blueprint(index);
+        Ref<CachedValue> value = cache->FindAndReference(&blueprint);
+        ASSERT(value != nullptr);
+        index = (index + 2 * threadIndex + 1) % kCachedObjectCount;
+    }
+}
+
+void ConcurrentCachePerf::Step() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mRunningThreadCount = GetParam().threadCount;
+    ++mStepIndex;
+    mStartCondition.notify_all();
+    mDoneCondition.wait(lock, [this] { return mRunningThreadCount == 0; });
+}
+
+TEST_P(ConcurrentCachePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ConcurrentCachePerf,
+                        {NullBackend()},
+                        {CacheType::SingleLock, CacheType::Sharded},
+                        {1, 2, 4, 8, 16, 32});
@@ -183,6 +183,13 @@ DawnPerfTestBase::DawnPerfTestBase(DawnTestBase* test,
 
 DawnPerfTestBase::~DawnPerfTestBase() = default;
 
+DawnPerfTestBase::ScopedSectionTimer::ScopedSectionTimer(DawnPerfTestBase* test)
+    : mTest(test), mStart(test->mTimer->GetElapsedTime()) {}
+
+DawnPerfTestBase::ScopedSectionTimer::~ScopedSectionTimer() {
+    mTest->mSectionTime += mTest->mTimer->GetElapsedTime() - mStart;
+}
+
 void DawnPerfTestBase::AbortTest() {
     mRunning = false;
 }
@@ -235,6 +242,7 @@ void DawnPerfTestBase::DoRunLoop(double maxRunTime) {
 
     mNumStepsPerformed = 0;
     mCpuTime = 0;
+    mSectionTime = 0;
     mRunning = true;
 
     uint64_t finishedIterations = 0;
@@ -351,6 +359,11 @@ void DawnPerfTestBase::OutputResults() {
     PrintPerIterationResultFromSeconds("validation_time", totalValidationTime, true);
     PrintPerIterationResultFromSeconds("recording_time", totalRecordingTime, true);
 
+    if (mSectionTime > 0) {
+        OutputSectionResults(mSectionTime /
+                             static_cast<double>(mNumStepsPerformed * mIterationsPerStep));
+    }
+
     const char* traceFile = gTestEnv->GetTraceFile();
     if (traceFile != nullptr) {
         DumpTraceEventsToJSONFile(traceEventBuffer, traceFile);
@@ -74,6 +74,21 @@ class DawnPerfTestBase {
     virtual ~DawnPerfTestBase();
 
   protected:
+    // Measures the CPU time spent in a part of the steps, for results that leave out the rest of
+    // the steps. The time measured during each trial is passed to OutputSectionResults.
+    class ScopedSectionTimer {
+      public:
+        explicit ScopedSectionTimer(DawnPerfTestBase* test);
+        ~ScopedSectionTimer();
+
+        ScopedSectionTimer(const ScopedSectionTimer&) = delete;
+        ScopedSectionTimer& operator=(const ScopedSectionTimer&) = delete;
+
+      private:
+        DawnPerfTestBase* mTest;
+        double mStart;
+    };
+
     // Call if the test step was aborted and the test should stop running.
     void AbortTest();
 
@@ -100,6 +115,9 @@ class DawnPerfTestBase {
                          bool important) const;
 
     virtual void Step() = 0;
+    // Prints the results derived from the time measured with ScopedSectionTimer, given per
+    // iteration. Only called if the test measured sections.
+    virtual void OutputSectionResults(double sectionSecondsPerIteration) {}
 
     DawnTestBase* mTest;
     bool mRunning = false;
@@ -108,6 +126,7 @@ class DawnPerfTestBase {
     unsigned int mStepsToRun = 0;
     unsigned int mNumStepsPerformed = 0;
     double mCpuTime;
+    double mSectionTime = 0;
     std::unique_ptr<utils::Timer> mTimer;
 };
 
@@ -122,7 +141,10 @@ class DawnPerfTestWithParams : public DawnTestWithParams<Params>, public DawnPer
 
         wgpu::AdapterProperties properties;
         this->GetAdapter().GetProperties(&properties);
-        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU);
+        // Software adapters are skipped, except for the null backend which is used by tests that
+        // only measure the frontend.
+        DAWN_TEST_UNSUPPORTED_IF(properties.adapterType == wgpu::AdapterType::CPU &&
+                                 properties.backendType != wgpu::BackendType::Null);
     }
     ~DawnPerfTestWithParams() override = default;
 };
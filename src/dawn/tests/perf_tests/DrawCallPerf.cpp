@@ -211,6 +211,8 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
 //     precomputed in a render bundle.
 //   - Static/Dynamic data: Updating data for each draw is a common use case. It also tests
 //     the efficiency of resource transitions.
+// The difference of encoding_cpu_time_per_draw between the null backend with and without
+// skip_validation is the per-draw cost of the frontend validation.
 class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
   public:
     DrawCallPerf() : DawnPerfTestWithParams(kNumDraws, 3) {}
@@ -226,6 +228,7 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
 
   private:
     void Step() override;
+    void OutputSectionResults(double sectionSecondsPerIteration) override;
 
     // One large dynamic vertex buffer, or multiple separate vertex buffers.
     wgpu::Buffer mVertexBuffers[kNumDraws];
@@ -570,34 +573,52 @@ void DrawCallPerf::Step() {
         }
     }
 
-    wgpu::CommandEncoder commands = device.CreateCommandEncoder();
-    utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
-    wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+    wgpu::CommandBuffer commandBuffer;
+    {
+        ScopedSectionTimer encodingTimer(this);
 
-    switch (GetParam().withRenderBundle) {
-        case RenderBundle::No:
-            RecordRenderCommands(pass);
-            break;
-        case RenderBundle::Yes:
-            pass.ExecuteBundles(1, &mRenderBundle);
-            break;
-        default:
-            UNREACHABLE();
-            break;
+        wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+        utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
+        wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
+
+        switch (GetParam().withRenderBundle) {
+            case RenderBundle::No:
+                RecordRenderCommands(pass);
+                break;
+            case RenderBundle::Yes:
+                pass.ExecuteBundles(1, &mRenderBundle);
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        pass.End();
+        commandBuffer = commands.Finish();
+        if (UsesWire()) {
+            FlushWire();
+        }
     }
 
-    pass.End();
-    wgpu::CommandBuffer commandBuffer = commands.Finish();
     queue.Submit(1, &commandBuffer);
 }
 
+// The CPU time spent encoding and validating a draw, from the creation of the command encoder to
+// Finish(). Unlike cpu_time this doesn't include the uniform updates and the submit. When using the
+// wire, this includes the flush of the wire so that the commands are also deserialized and encoded
+// by the server.
+void DrawCallPerf::OutputSectionResults(double sectionSecondsPerIteration) {
+    PrintResult("encoding_cpu_time_per_draw", sectionSecondsPerIteration * 1e9, "ns", false);
+}
+
 TEST_P(DrawCallPerf, Run) {
     RunTest();
 }
 
 DAWN_INSTANTIATE_TEST_P(
     DrawCallPerf,
-    {D3D11Backend(), D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+    {D3D11Backend(), D3D12Backend(), MetalBackend(), NullBackend(),
+     NullBackend({"skip_validation"}), OpenGLBackend(), VulkanBackend(),
      VulkanBackend({"skip_validation"})},
     {
         // Baseline
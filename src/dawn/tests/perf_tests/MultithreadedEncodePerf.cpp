@@ -0,0 +1,140 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kEncodersPerThread = 16;
+constexpr unsigned int kPassesPerEncoder = 4;
+constexpr unsigned int kDrawsPerPass = 64;
+
+constexpr uint32_t kTextureSize = 16;
+
+struct MultithreadedEncodeParams : AdapterTestParam {
+    MultithreadedEncodeParams(const AdapterTestParam& param, uint32_t threadCountIn)
+        : AdapterTestParam(param), threadCount(threadCountIn) {}
+    uint32_t threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const MultithreadedEncodeParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_threads_" << param.threadCount;
+    return ostream;
+}
+
+}  // namespace
+
+// Measures the throughput of encoding command buffers from several threads on the same device.
+// Each thread records render passes into its own encoders and finishes them, while also creating
+// samplers that are found in the device's cache, so the test scales only if these paths don't
+// serialize on the device lock. The null backend is used so that only the frontend is measured.
+class MultithreadedEncodePerf : public DawnPerfTestWithParams<MultithreadedEncodeParams> {
+  public:
+    MultithreadedEncodePerf()
+        : DawnPerfTestWithParams(kEncodersPerThread * GetParam().threadCount, 1) {}
+    ~MultithreadedEncodePerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    std::vector<wgpu::FeatureName> GetRequiredFeatures() override {
+        std::vector<wgpu::FeatureName> requiredFeatures;
+        // The device must be thread-safe for the test to encode from multiple threads.
+        if (!IsImplicitDeviceSyncEnabled() &&
+            SupportsFeatures({wgpu::FeatureName::ImplicitDeviceSynchronization})) {
+            requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+        }
+        return requiredFeatures;
+    }
+
+  private:
+    void Step() override;
+    void EncodeOnThread(std::vector<wgpu::CommandBuffer>* commandBuffers);
+
+    utils::BasicRenderPass mRenderPass;
+    wgpu::RenderPipeline mPipeline;
+    std::vector<std::vector<wgpu::CommandBuffer>> mCommandBuffers;
+};
+
+void MultithreadedEncodePerf::SetUp() {
+    DawnPerfTestWithParams<MultithreadedEncodeParams>::SetUp();
+
+    // Objects of the wire client are not thread-safe.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+    DAWN_TEST_UNSUPPORTED_IF(
+        !IsImplicitDeviceSyncEnabled() &&
+        !SupportsFeatures({wgpu::FeatureName::ImplicitDeviceSynchronization}));
+
+    mRenderPass = utils::CreateBasicRenderPass(device, kTextureSize, kTextureSize);
+
+    utils::ComboRenderPipelineDescriptor descriptor;
+    descriptor.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main(@builtin(vertex_index) i : u32) -> @builtin(position) vec4f {
+            const pos = array(vec2f(-1.0, -1.0), vec2f(3.0, -1.0), vec2f(-1.0, 3.0));
+            return vec4f(pos[i], 0.0, 1.0);
+        })");
+    descriptor.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    descriptor.cTargets[0].format = mRenderPass.colorFormat;
+    mPipeline = device.CreateRenderPipeline(&descriptor);
+
+    mCommandBuffers.resize(GetParam().threadCount);
+}
+
+void MultithreadedEncodePerf::EncodeOnThread(std::vector<wgpu::CommandBuffer>* commandBuffers) {
+    for (unsigned int i = 0; i < kEncodersPerThread; ++i) {
+        wgpu::Sampler sampler = device.CreateSampler();
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        for (unsigned int j = 0; j < kPassesPerEncoder; ++j) {
+            wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&mRenderPass.renderPassInfo);
+            pass.SetPipeline(mPipeline);
+            for (unsigned int k = 0; k < kDrawsPerPass; ++k) {
+                pass.Draw(3);
+            }
+            pass.End();
+        }
+        commandBuffers->push_back(encoder.Finish());
+    }
+}
+
+void MultithreadedEncodePerf::Step() {
+    std::vector<std::thread> threads;
+    threads.reserve(GetParam().threadCount);
+    for (std::vector<wgpu::CommandBuffer>& commandBuffers : mCommandBuffers) {
+        threads.emplace_back([this, &commandBuffers] { EncodeOnThread(&commandBuffers); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (std::vector<wgpu::CommandBuffer>& commandBuffers : mCommandBuffers) {
+        queue.Submit(commandBuffers.size(), commandBuffers.data());
+        commandBuffers.clear();
+    }
+}
+
+TEST_P(MultithreadedEncodePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(MultithreadedEncodePerf, {NullBackend()}, {1, 2, 4, 8, 16});
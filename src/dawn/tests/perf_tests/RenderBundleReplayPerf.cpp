@@ -0,0 +1,176 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderBundleEncoderDescriptor.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr uint32_t kNumBundles = 200;
+constexpr uint32_t kDrawsPerBundle = 4;
+constexpr uint32_t kTextureSize = 64;
+constexpr wgpu::TextureFormat kColorFormat = wgpu::TextureFormat::RGBA8Unorm;
+
+constexpr char kShader[] = R"(
+        @group(0) @binding(0) var<uniform> color : vec4f;
+
+        @vertex fn vs_main(@location(0) pos : vec4f) -> @builtin(position) vec4f {
+            return pos;
+        }
+
+        @fragment fn fs_main() -> @location(0) vec4f {
+            return color;
+        })";
+
+enum class DrawType {
+    Direct,    // Bundles only contain direct draws.
+    Indirect,  // Bundles only contain indirect draws, which need to be validated on replay.
+};
+
+struct RenderBundleReplayParams : AdapterTestParam {
+    RenderBundleReplayParams(const AdapterTestParam& param, DrawType drawTypeIn)
+        : AdapterTestParam(param), drawType(drawTypeIn) {}
+    DrawType drawType;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const RenderBundleReplayParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    switch (param.drawType) {
+        case DrawType::Direct:
+            ostream << "_Direct";
+            break;
+        case DrawType::Indirect:
+            ostream << "_Indirect";
+            break;
+    }
+    return ostream;
+}
+
+}  // namespace
+
+// Encodes a frame executing the same render bundles each step, each bundle with its own vertex
+// buffer and bind group. The encoding time is spent merging the resource usages of the bundles
+// into the pass, plus their indirect draw metadata for the Indirect variant.
+class RenderBundleReplayPerf : public DawnPerfTestWithParams<RenderBundleReplayParams> {
+  public:
+    RenderBundleReplayPerf() : DawnPerfTestWithParams(1, 3) {}
+    ~RenderBundleReplayPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+    void OutputSectionResults(double sectionSecondsPerIteration) override;
+
+    wgpu::TextureView mColorAttachment;
+    std::vector<wgpu::RenderBundle> mBundles;
+};
+
+void RenderBundleReplayPerf::SetUp() {
+    DawnPerfTestWithParams<RenderBundleReplayParams>::SetUp();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.size = {kTextureSize, kTextureSize};
+    textureDesc.format = kColorFormat;
+    textureDesc.usage = wgpu::TextureUsage::RenderAttachment;
+    mColorAttachment = device.CreateTexture(&textureDesc).CreateView();
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kShader);
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs_main";
+    pipelineDesc.cFragment.module = module;
+    pipelineDesc.cFragment.entryPoint = "fs_main";
+    pipelineDesc.vertex.bufferCount = 1;
+    pipelineDesc.cBuffers[0].arrayStride = 4 * sizeof(float);
+    pipelineDesc.cBuffers[0].attributeCount = 1;
+    pipelineDesc.cAttributes[0].format = wgpu::VertexFormat::Float32x4;
+    pipelineDesc.cTargets[0].format = kColorFormat;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    std::vector<uint32_t> indirectData(kDrawsPerBundle * 4);
+    for (uint32_t i = 0; i < kDrawsPerBundle; ++i) {
+        indirectData[i * 4] = 3;
+        indirectData[i * 4 + 1] = 1;
+    }
+    wgpu::Buffer indirectBuffer =
+        utils::CreateBufferFromData(device, indirectData.data(),
+                                    indirectData.size() * sizeof(uint32_t),
+                                    wgpu::BufferUsage::Indirect);
+
+    utils::ComboRenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatsCount = 1;
+    bundleDesc.cColorFormats[0] = kColorFormat;
+
+    mBundles.reserve(kNumBundles);
+    for (uint32_t i = 0; i < kNumBundles; ++i) {
+        wgpu::Buffer vertexBuffer =
+            utils::CreateBufferFromData(device, wgpu::BufferUsage::Vertex,
+                                        {0.0f, 0.5f, 0.0f, 1.0f, -0.5f, -0.5f, 0.0f, 1.0f, 0.5f,
+                                         -0.5f, 0.0f, 1.0f});
+        wgpu::Buffer uniformBuffer = utils::CreateBufferFromData(
+            device, wgpu::BufferUsage::Uniform, {float(i) / kNumBundles, 0.0f, 0.0f, 1.0f});
+        wgpu::BindGroup bindGroup =
+            utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0), {{0, uniformBuffer}});
+
+        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encoder.SetPipeline(pipeline);
+        encoder.SetVertexBuffer(0, vertexBuffer);
+        encoder.SetBindGroup(0, bindGroup);
+        for (uint32_t j = 0; j < kDrawsPerBundle; ++j) {
+            switch (GetParam().drawType) {
+                case DrawType::Direct:
+                    encoder.Draw(3);
+                    break;
+                case DrawType::Indirect:
+                    encoder.DrawIndirect(indirectBuffer, j * 4 * sizeof(uint32_t));
+                    break;
+            }
+        }
+        mBundles.push_back(encoder.Finish());
+    }
+}
+
+void RenderBundleReplayPerf::Step() {
+    wgpu::CommandBuffer commands;
+    {
+        ScopedSectionTimer encodingTimer(this);
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.ExecuteBundles(mBundles.size(), mBundles.data());
+        pass.End();
+        commands = encoder.Finish();
+    }
+
+    queue.Submit(1, &commands);
+}
+
+// The CPU time spent encoding a frame, from the creation of the command encoder to Finish().
+void RenderBundleReplayPerf::OutputSectionResults(double sectionSecondsPerIteration) {
+    PrintResult("encoding_cpu_time_per_frame", sectionSecondsPerIteration * 1e6, "us", false);
+}
+
+TEST_P(RenderBundleReplayPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(RenderBundleReplayPerf,
+                        {NullBackend(), NullBackend({"skip_validation"})},
+                        {DrawType::Direct, DrawType::Indirect});
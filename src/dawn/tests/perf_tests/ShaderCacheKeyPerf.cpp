@@ -0,0 +1,158 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+#include <string>
+
+#include "dawn/native/CacheKey.h"
+#include "dawn/native/ShaderModule.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "tint/tint.h"
+
+namespace {
+
+constexpr unsigned int kNumKeysPerStep = 16;
+
+// How the shader module is streamed into the CacheKey.
+enum class KeySource {
+    // Printing the tint::Program back to WGSL, as was done before the source digest existed.
+    ReemitWGSL,
+    // Streaming the digest of the source computed at shader module creation.
+    SourceDigest,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const KeySource& keySource) {
+    switch (keySource) {
+        case KeySource::ReemitWGSL:
+            ostream << "ReemitWGSL";
+            break;
+        case KeySource::SourceDigest:
+            ostream << "SourceDigest";
+            break;
+    }
+    return ostream;
+}
+
+struct ShaderCacheKeyParams : AdapterTestParam {
+    ShaderCacheKeyParams(const AdapterTestParam& param,
+                         KeySource keySourceIn,
+                         uint32_t functionCountIn)
+        : AdapterTestParam(param), keySource(keySourceIn), functionCount(functionCountIn) {}
+
+    KeySource keySource;
+    uint32_t functionCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ShaderCacheKeyParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.keySource << "_functions_" << param.functionCount;
+    return ostream;
+}
+
+// Generates a compute shader calling a chain of |functionCount| functions so that the size of the
+// module scales with the parameter.
+std::string GenerateShader(uint32_t functionCount) {
+    std::ostringstream shader;
+    shader << R"(
+        struct Data {
+            values : array<f32, 64>,
+        }
+        @group(0) @binding(0) var<storage, read_write> data : Data;
+
+        fn f0(x : f32) -> f32 {
+            return x;
+        }
+    )";
+    for (uint32_t i = 1; i < functionCount; ++i) {
+        shader << "fn f" << i << "(x : f32) -> f32 {\n"
+               << "    var v = vec4f(x, f" << (i - 1) << "(x), " << i << ".0, 1.0);\n"
+               << "    return dot(v, vec4f(0.5)) + data.values[" << (i % 64) << "];\n"
+               << "}\n";
+    }
+    shader << "@compute @workgroup_size(64) fn main(@builtin(local_invocation_index) i : u32) {\n"
+           << "    data.values[i] = f" << (functionCount - 1) << "(data.values[i]);\n"
+           << "}\n";
+    return shader.str();
+}
+
+}  // namespace
+
+// Measures the cost of streaming a shader module into the CacheKey of a backend compilation
+// request. This used to require printing the tint::Program back to WGSL, which scales with the
+// size of the program, while the source digest is computed once at shader module creation.
+class ShaderCacheKeyPerf : public DawnPerfTestWithParams<ShaderCacheKeyParams> {
+  public:
+    ShaderCacheKeyPerf() : DawnPerfTestWithParams(kNumKeysPerStep, 1) {}
+    ~ShaderCacheKeyPerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    size_t GetKeySize() const { return mKeySize; }
+
+  private:
+    void Step() override;
+
+    wgpu::ShaderModule mShaderModule;
+    dawn::native::ShaderModuleBase* mShaderModuleBase = nullptr;
+    size_t mKeySize = 0;
+};
+
+void ShaderCacheKeyPerf::SetUp() {
+    DawnPerfTestWithParams<ShaderCacheKeyParams>::SetUp();
+
+    // The test inspects the dawn::native object backing the shader module.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+#if !TINT_BUILD_WGSL_WRITER
+    DAWN_TEST_UNSUPPORTED_IF(GetParam().keySource == KeySource::ReemitWGSL);
+#endif
+
+    std::string shader = GenerateShader(GetParam().functionCount);
+    mShaderModule = utils::CreateShaderModule(device, shader.c_str());
+    mShaderModuleBase = dawn::native::FromAPI(mShaderModule.Get());
+}
+
+void ShaderCacheKeyPerf::Step() {
+    for (unsigned int i = 0; i < kNumKeysPerStep; ++i) {
+        dawn::native::CacheKey key;
+        switch (GetParam().keySource) {
+            case KeySource::ReemitWGSL: {
+#if TINT_BUILD_WGSL_WRITER
+                tint::writer::wgsl::Options options{};
+                const tint::Program* program = mShaderModuleBase->GetTintProgram();
+                dawn::native::stream::StreamIn(&key,
+                                               tint::writer::wgsl::Generate(program, options).wgsl);
+#endif
+                break;
+            }
+            case KeySource::SourceDigest:
+                dawn::native::stream::StreamIn(&key,
+                                               mShaderModuleBase->GetTintProgramWithSourceDigest());
+                break;
+        }
+        mKeySize = key.size();
+    }
+}
+
+TEST_P(ShaderCacheKeyPerf, Run) {
+    RunTest();
+    PrintResult("shader_key_size", static_cast<double>(GetKeySize()), "bytes", false);
+}
+
+// Building the cache key only uses the CPU, so only the null backend is needed.
+DAWN_INSTANTIATE_TEST_P(ShaderCacheKeyPerf,
+                        {NullBackend()},
+                        {KeySource::ReemitWGSL, KeySource::SourceDigest},
+                        {16, 256, 1024});
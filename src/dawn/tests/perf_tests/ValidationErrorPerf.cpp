@@ -0,0 +1,156 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr unsigned int kNumErrorsPerStep = 256;
+
+// Which API calls produce the validation errors.
+enum class ErrorSource {
+    // Creating buffers with an invalid usage, which produces an error with contexts.
+    CreateBuffer,
+    // Encoding an invalid copy, which produces an error when the encoder is finished.
+    CommandEncoder,
+    // Creating bind groups with a buffer of the wrong usage, which produces an error whose message
+    // and contexts have labeled objects and descriptors as arguments.
+    CreateBindGroup,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ErrorSource& errorSource) {
+    switch (errorSource) {
+        case ErrorSource::CreateBuffer:
+            ostream << "CreateBuffer";
+            break;
+        case ErrorSource::CommandEncoder:
+            ostream << "CommandEncoder";
+            break;
+        case ErrorSource::CreateBindGroup:
+            ostream << "CreateBindGroup";
+            break;
+    }
+    return ostream;
+}
+
+struct ValidationErrorParams : AdapterTestParam {
+    ValidationErrorParams(const AdapterTestParam& param, ErrorSource errorSourceIn)
+        : AdapterTestParam(param), errorSource(errorSourceIn) {}
+    ErrorSource errorSource;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ValidationErrorParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.errorSource;
+    return ostream;
+}
+
+}  // namespace
+
+// Measures the cost of validation errors that are captured by an error scope and never looked at,
+// like content validation tools that trigger many errors and only check the first one. Only the
+// frontend is measured so the null backend is used.
+class ValidationErrorPerf : public DawnPerfTestWithParams<ValidationErrorParams> {
+  public:
+    ValidationErrorPerf() : DawnPerfTestWithParams(kNumErrorsPerStep, 1) {}
+    ~ValidationErrorPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::Buffer mBuffer;
+    wgpu::BindGroupLayout mUniformLayout;
+};
+
+void ValidationErrorPerf::SetUp() {
+    DawnPerfTestWithParams<ValidationErrorParams>::SetUp();
+
+    // PopErrorScope is asynchronous on the wire, and the wire doesn't change the cost of the
+    // errors on the server.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 16;
+    descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    descriptor.label = "copy buffer";
+    mBuffer = device.CreateBuffer(&descriptor);
+
+    mUniformLayout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform}});
+    mUniformLayout.SetLabel("uniform layout");
+}
+
+void ValidationErrorPerf::Step() {
+    device.PushErrorScope(wgpu::ErrorFilter::Validation);
+
+    switch (GetParam().errorSource) {
+        case ErrorSource::CreateBuffer: {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.size = 4;
+            descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::Storage;
+            for (unsigned int i = 0; i < kNumErrorsPerStep; ++i) {
+                wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+            }
+            break;
+        }
+
+        case ErrorSource::CommandEncoder: {
+            for (unsigned int i = 0; i < kNumErrorsPerStep; ++i) {
+                wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+                // The offset isn't a multiple of 4.
+                encoder.CopyBufferToBuffer(mBuffer, 1, mBuffer, 8, 4);
+                wgpu::CommandBuffer commandBuffer = encoder.Finish();
+            }
+            break;
+        }
+
+        case ErrorSource::CreateBindGroup: {
+            wgpu::BindGroupEntry entry = {};
+            entry.binding = 0;
+            entry.buffer = mBuffer;
+            entry.size = 16;
+
+            wgpu::BindGroupDescriptor descriptor;
+            descriptor.label = "uniform bind group";
+            descriptor.layout = mUniformLayout;
+            descriptor.entryCount = 1;
+            descriptor.entries = &entry;
+            for (unsigned int i = 0; i < kNumErrorsPerStep; ++i) {
+                // The buffer doesn't have the Uniform usage.
+                wgpu::BindGroup bindGroup = device.CreateBindGroup(&descriptor);
+            }
+            break;
+        }
+    }
+
+    bool gotError = false;
+    device.PopErrorScope(
+        [](WGPUErrorType type, const char*, void* userdata) {
+            *static_cast<bool*>(userdata) = type == WGPUErrorType_Validation;
+        },
+        &gotError);
+    ASSERT_TRUE(gotError);
+}
+
+TEST_P(ValidationErrorPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ValidationErrorPerf,
+                        {NullBackend()},
+                        {ErrorSource::CreateBuffer, ErrorSource::CommandEncoder,
+                         ErrorSource::CreateBindGroup});
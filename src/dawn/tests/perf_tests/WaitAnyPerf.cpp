@@ -0,0 +1,150 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <limits>
+#include <thread>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace {
+
+constexpr unsigned int kNumWaitsPerStep = 16;
+
+// How the test waits for the work submitted to the queue to be done.
+enum class WaitMode {
+    // Calls ProcessEvents in a loop, which uses a CPU core while waiting.
+    Spin,
+    // Calls ProcessEvents then sleeps for a millisecond, in a loop.
+    SleepPoll,
+    // Blocks in WaitAny.
+    WaitAny,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WaitMode& waitMode) {
+    switch (waitMode) {
+        case WaitMode::Spin:
+            ostream << "Spin";
+            break;
+        case WaitMode::SleepPoll:
+            ostream << "SleepPoll";
+            break;
+        case WaitMode::WaitAny:
+            ostream << "WaitAny";
+            break;
+    }
+    return ostream;
+}
+
+struct WaitAnyParams : AdapterTestParam {
+    WaitAnyParams(const AdapterTestParam& param, WaitMode waitModeIn)
+        : AdapterTestParam(param), waitMode(waitModeIn) {}
+    WaitMode waitMode;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WaitAnyParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.waitMode;
+    return ostream;
+}
+
+using Clock = std::chrono::steady_clock;
+
+}  // namespace
+
+// Measures the latency between the work submitted to the queue being done and the thread waiting
+// for it noticing, for the different ways of waiting. Each step submits and waits for the queue
+// |kNumWaitsPerStep| times.
+class WaitAnyPerf : public DawnPerfTestWithParams<WaitAnyParams> {
+  public:
+    WaitAnyPerf() : DawnPerfTestWithParams(kNumWaitsPerStep, 1) {}
+    ~WaitAnyPerf() override = default;
+
+    void SetUp() override;
+
+    double GetAverageLatencyNs() const {
+        if (mWaitCount == 0) {
+            return 0;
+        }
+        return static_cast<double>(mTotalLatency.count()) / static_cast<double>(mWaitCount);
+    }
+
+  private:
+    void Step() override;
+
+    std::chrono::nanoseconds mTotalLatency{0};
+    uint64_t mWaitCount = 0;
+};
+
+void WaitAnyPerf::SetUp() {
+    DawnPerfTestWithParams<WaitAnyParams>::SetUp();
+
+    // Futures are only available on the native instance.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+}
+
+void WaitAnyPerf::Step() {
+    WGPUInstance instance = GetInstance().Get();
+
+    for (unsigned int i = 0; i < kNumWaitsPerStep; ++i) {
+        wgpu::CommandBuffer commandBuffer = device.CreateCommandEncoder().Finish();
+        queue.Submit(1, &commandBuffer);
+
+        Clock::time_point start = Clock::now();
+        bool done = false;
+        dawn::native::FutureWaitInfo info;
+        info.future = dawn::native::QueueOnSubmittedWorkDoneF(
+            queue.Get(), 0,
+            [](WGPUQueueWorkDoneStatus, void* userdata) { *static_cast<bool*>(userdata) = true; },
+            &done);
+
+        switch (GetParam().waitMode) {
+            case WaitMode::Spin:
+                while (!done) {
+                    dawn::native::InstanceProcessEvents(instance);
+                }
+                break;
+
+            case WaitMode::SleepPoll:
+                while (!done) {
+                    dawn::native::InstanceProcessEvents(instance);
+                    if (!done) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+                break;
+
+            case WaitMode::WaitAny:
+                ASSERT_EQ(dawn::native::InstanceWaitAny(instance, 1, &info,
+                                                        std::numeric_limits<uint64_t>::max()),
+                          dawn::native::WaitStatus::Success);
+                ASSERT_TRUE(done);
+                break;
+        }
+
+        mTotalLatency += Clock::now() - start;
+        mWaitCount++;
+    }
+}
+
+TEST_P(WaitAnyPerf, Run) {
+    RunTest();
+    PrintResult("wait_latency", GetAverageLatencyNs(), "ns", false);
+}
+
+DAWN_INSTANTIATE_TEST_P(WaitAnyPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {WaitMode::Spin, WaitMode::SleepPoll, WaitMode::WaitAny});
@@ -0,0 +1,258 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <sys/socket.h>
+#endif
+
+namespace {
+
+enum class Transfer {
+    Inline,
+    SharedMemory,
+};
+
+enum class MapMode {
+    Read,
+    Write,
+};
+
+struct WireMemoryTransferParams : AdapterTestParam {
+    WireMemoryTransferParams(const AdapterTestParam& param,
+                             Transfer transferIn,
+                             MapMode mapModeIn,
+                             uint32_t bufferSizeIn)
+        : AdapterTestParam(param),
+          transfer(transferIn),
+          mapMode(mapModeIn),
+          bufferSize(bufferSizeIn) {}
+    Transfer transfer;
+    MapMode mapMode;
+    uint32_t bufferSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireMemoryTransferParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.transfer) {
+        case Transfer::Inline:
+            ostream << "_Inline";
+            break;
+        case Transfer::SharedMemory:
+            ostream << "_SharedMemory";
+            break;
+    }
+
+    switch (param.mapMode) {
+        case MapMode::Read:
+            ostream << "_MapRead";
+            break;
+        case MapMode::Write:
+            ostream << "_MapWrite";
+            break;
+    }
+
+    ostream << "_" << param.bufferSize;
+    return ostream;
+}
+
+void OnMapCallback(WGPUBufferMapAsyncStatus status, void* userdata) {
+    ASSERT(status == WGPUBufferMapAsyncStatus_Success);
+    *static_cast<bool*>(userdata) = true;
+}
+
+}  // namespace
+
+// Measures the throughput of mapping buffers through the wire, with the inline or the shared
+// memory MemoryTransferService. The wire uses an in-process transport on top of a separate device
+// of the test's adapter, so the results don't depend on the --use-wire option.
+class WireMemoryTransferPerf : public DawnPerfTestWithParams<WireMemoryTransferParams> {
+  public:
+    WireMemoryTransferPerf() : DawnPerfTestWithParams(1, 1), mTimer(utils::CreateTimer()) {}
+    ~WireMemoryTransferPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    double GetThroughputGBs() const {
+        if (mMapTime == 0) {
+            return 0;
+        }
+        return static_cast<double>(mTransferredBytes) / mMapTime * 1e-9;
+    }
+
+  private:
+    void Step() override;
+
+    void FlushWire();
+    void WaitForMap();
+
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuf;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuf;
+    std::unique_ptr<dawn::wire::client::MemoryTransferService> mClientMemoryTransferService;
+    std::unique_ptr<dawn::wire::server::MemoryTransferService> mServerMemoryTransferService;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    // The client procs are used directly since the global procs might not be the wire's.
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    WGPUDevice mWireDevice = nullptr;
+    WGPUBuffer mBuffer = nullptr;
+    WGPUDevice mWireBackendDevice = nullptr;
+
+    std::vector<uint8_t> mHostData;
+
+    std::unique_ptr<utils::Timer> mTimer;
+    double mMapTime = 0;
+    uint64_t mTransferredBytes = 0;
+};
+
+void WireMemoryTransferPerf::SetUp() {
+    DawnPerfTestWithParams<WireMemoryTransferParams>::SetUp();
+    const WireMemoryTransferParams& params = GetParam();
+
+    if (params.transfer == Transfer::SharedMemory) {
+        int sockets[2] = {-1, -1};
+#if DAWN_PLATFORM_IS(LINUX)
+        socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets);
+#endif
+        mClientMemoryTransferService =
+            dawn::wire::client::CreateSharedMemoryTransferService(sockets[0]);
+        mServerMemoryTransferService =
+            dawn::wire::server::CreateSharedMemoryTransferService(sockets[1]);
+        DAWN_TEST_UNSUPPORTED_IF(mClientMemoryTransferService == nullptr);
+    }
+
+    mC2sBuf = std::make_unique<utils::TerribleCommandBuffer>();
+    mS2cBuf = std::make_unique<utils::TerribleCommandBuffer>();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &backendProcs;
+    serverDesc.serializer = mS2cBuf.get();
+    serverDesc.memoryTransferService = mServerMemoryTransferService.get();
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+    mC2sBuf->SetHandler(mWireServer.get());
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = mC2sBuf.get();
+    clientDesc.memoryTransferService = mClientMemoryTransferService.get();
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+    mS2cBuf->SetHandler(mWireClient.get());
+
+    // Use a separate device so that the callbacks set by the wire server don't replace the ones
+    // of the test's device.
+    mWireBackendDevice = GetAdapter().CreateDevice();
+    auto reservation = mWireClient->ReserveDevice();
+    mWireServer->InjectDevice(mWireBackendDevice, reservation.id, reservation.generation);
+    mWireDevice = reservation.device;
+
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = params.bufferSize;
+    switch (params.mapMode) {
+        case MapMode::Read:
+            descriptor.usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst;
+            break;
+        case MapMode::Write:
+            descriptor.usage = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+            break;
+    }
+    mBuffer = mClientProcs.deviceCreateBuffer(mWireDevice, &descriptor);
+    FlushWire();
+
+    mHostData.resize(params.bufferSize);
+    for (size_t i = 0; i < mHostData.size(); ++i) {
+        mHostData[i] = static_cast<uint8_t>(i);
+    }
+}
+
+void WireMemoryTransferPerf::TearDown() {
+    if (mBuffer != nullptr) {
+        mClientProcs.bufferRelease(mBuffer);
+    }
+    if (mWireDevice != nullptr) {
+        mClientProcs.deviceRelease(mWireDevice);
+    }
+    if (mWireClient != nullptr) {
+        FlushWire();
+    }
+    mWireClient = nullptr;
+    mWireServer = nullptr;
+    if (mWireBackendDevice != nullptr) {
+        backendProcs.deviceRelease(mWireBackendDevice);
+    }
+
+    DawnPerfTestWithParams<WireMemoryTransferParams>::TearDown();
+}
+
+void WireMemoryTransferPerf::FlushWire() {
+    bool c2sFlushed = mC2sBuf->Flush();
+    bool s2cFlushed = mS2cBuf->Flush();
+    ASSERT(c2sFlushed && s2cFlushed);
+}
+
+void WireMemoryTransferPerf::WaitForMap() {
+    bool done = false;
+    WGPUMapModeFlags mode =
+        GetParam().mapMode == MapMode::Read ? WGPUMapMode_Read : WGPUMapMode_Write;
+    mClientProcs.bufferMapAsync(mBuffer, mode, 0, GetParam().bufferSize, OnMapCallback, &done);
+    while (!done) {
+        mC2sBuf->Flush();
+        backendProcs.deviceTick(mWireBackendDevice);
+        mS2cBuf->Flush();
+    }
+}
+
+void WireMemoryTransferPerf::Step() {
+    size_t size = GetParam().bufferSize;
+
+    double start = mTimer->GetAbsoluteTime();
+    WaitForMap();
+    switch (GetParam().mapMode) {
+        case MapMode::Read:
+            memcpy(mHostData.data(), mClientProcs.bufferGetConstMappedRange(mBuffer, 0, size),
+                   size);
+            break;
+        case MapMode::Write:
+            memcpy(mClientProcs.bufferGetMappedRange(mBuffer, 0, size), mHostData.data(), size);
+            break;
+    }
+    mClientProcs.bufferUnmap(mBuffer);
+    FlushWire();
+    mMapTime += mTimer->GetAbsoluteTime() - start;
+    mTransferredBytes += size;
+}
+
+TEST_P(WireMemoryTransferPerf, Run) {
+    RunTest();
+    PrintResult("map_throughput", GetThroughputGBs(), "GB/s", false);
+}
+
+DAWN_INSTANTIATE_TEST_P(WireMemoryTransferPerf,
+                        {NullBackend()},
+                        {Transfer::Inline, Transfer::SharedMemory},
+                        {MapMode::Read, MapMode::Write},
+                        {1024 * 1024, 64 * 1024 * 1024});
@@ -0,0 +1,163 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace {
+
+struct WireWriteBufferParams : AdapterTestParam {
+    WireWriteBufferParams(const AdapterTestParam& param, uint32_t dataSizeIn)
+        : AdapterTestParam(param), dataSize(dataSizeIn) {}
+    uint32_t dataSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WireWriteBufferParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.dataSize;
+    return ostream;
+}
+
+}  // namespace
+
+// Measures the throughput of WriteBuffer through the wire, including the serialization of the
+// data, its transport and deserialization. Payloads larger than the maximum allocation size of the
+// transport are chunked. The wire uses an in-process transport on top of a separate device of the
+// test's adapter, so the results don't depend on the --use-wire option.
+class WireWriteBufferPerf : public DawnPerfTestWithParams<WireWriteBufferParams> {
+  public:
+    WireWriteBufferPerf() : DawnPerfTestWithParams(1, 1) {}
+    ~WireWriteBufferPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void Step() override;
+    void OutputSectionResults(double sectionSecondsPerIteration) override;
+
+    void FlushWire();
+
+    std::unique_ptr<utils::TerribleCommandBuffer> mC2sBuf;
+    std::unique_ptr<utils::TerribleCommandBuffer> mS2cBuf;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+
+    // The client procs are used directly since the global procs might not be the wire's.
+    const DawnProcTable& mClientProcs = dawn::wire::client::GetProcs();
+    WGPUDevice mWireDevice = nullptr;
+    WGPUQueue mQueue = nullptr;
+    WGPUBuffer mBuffer = nullptr;
+    WGPUDevice mWireBackendDevice = nullptr;
+
+    std::vector<uint8_t> mData;
+};
+
+void WireWriteBufferPerf::SetUp() {
+    DawnPerfTestWithParams<WireWriteBufferParams>::SetUp();
+
+    mC2sBuf = std::make_unique<utils::TerribleCommandBuffer>();
+    mS2cBuf = std::make_unique<utils::TerribleCommandBuffer>();
+
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &backendProcs;
+    serverDesc.serializer = mS2cBuf.get();
+    mWireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+    mC2sBuf->SetHandler(mWireServer.get());
+
+    dawn::wire::WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = mC2sBuf.get();
+    mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+    mS2cBuf->SetHandler(mWireClient.get());
+
+    // Use a separate device so that the callbacks set by the wire server don't replace the ones
+    // of the test's device.
+    mWireBackendDevice = GetAdapter().CreateDevice();
+    auto reservation = mWireClient->ReserveDevice();
+    mWireServer->InjectDevice(mWireBackendDevice, reservation.id, reservation.generation);
+    mWireDevice = reservation.device;
+    mQueue = mClientProcs.deviceGetQueue(mWireDevice);
+
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = GetParam().dataSize;
+    descriptor.usage = WGPUBufferUsage_CopyDst;
+    mBuffer = mClientProcs.deviceCreateBuffer(mWireDevice, &descriptor);
+    FlushWire();
+
+    mData.resize(GetParam().dataSize);
+    for (size_t i = 0; i < mData.size(); ++i) {
+        mData[i] = static_cast<uint8_t>(i);
+    }
+}
+
+void WireWriteBufferPerf::TearDown() {
+    if (mBuffer != nullptr) {
+        mClientProcs.bufferRelease(mBuffer);
+    }
+    if (mQueue != nullptr) {
+        mClientProcs.queueRelease(mQueue);
+    }
+    if (mWireDevice != nullptr) {
+        mClientProcs.deviceRelease(mWireDevice);
+    }
+    if (mWireClient != nullptr) {
+        FlushWire();
+    }
+    mWireClient = nullptr;
+    mWireServer = nullptr;
+    if (mWireBackendDevice != nullptr) {
+        backendProcs.deviceRelease(mWireBackendDevice);
+    }
+
+    DawnPerfTestWithParams<WireWriteBufferParams>::TearDown();
+}
+
+void WireWriteBufferPerf::FlushWire() {
+    bool c2sFlushed = mC2sBuf->Flush();
+    bool s2cFlushed = mS2cBuf->Flush();
+    ASSERT(c2sFlushed && s2cFlushed);
+}
+
+void WireWriteBufferPerf::Step() {
+    {
+        ScopedSectionTimer writeTimer(this);
+        mClientProcs.queueWriteBuffer(mQueue, mBuffer, 0, mData.data(), mData.size());
+        FlushWire();
+    }
+
+    // Let the device reclaim the staging memory used by the writes.
+    backendProcs.deviceTick(mWireBackendDevice);
+}
+
+// The throughput of the data going through the wire, from the client call until the server wrote
+// it to the buffer. The tick of the device reclaiming the staging memory is left out.
+void WireWriteBufferPerf::OutputSectionResults(double sectionSecondsPerIteration) {
+    PrintResult("write_throughput", double(mData.size()) / sectionSecondsPerIteration * 1e-9,
+                "GB/s", false);
+}
+
+TEST_P(WireWriteBufferPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(WireWriteBufferPerf,
+                        {NullBackend()},
+                        {1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024, 256 * 1024 * 1024});
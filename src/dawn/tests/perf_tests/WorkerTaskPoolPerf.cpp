@@ -0,0 +1,102 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "dawn/platform/WorkerThread.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace {
+
+constexpr unsigned int kNumTasksPerStep = 256;
+
+struct WorkerTaskPoolParams : AdapterTestParam {
+    WorkerTaskPoolParams(const AdapterTestParam& param, uint32_t threadCountIn)
+        : AdapterTestParam(param), threadCount(threadCountIn) {}
+    uint32_t threadCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WorkerTaskPoolParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_threads_" << param.threadCount;
+    return ostream;
+}
+
+using Clock = std::chrono::steady_clock;
+
+struct TaskData {
+    Clock::time_point postTime;
+    std::atomic<uint64_t>* totalLatencyNs;
+};
+
+void RunTask(void* userdata) {
+    TaskData* data = static_cast<TaskData*>(userdata);
+    auto latency =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - data->postTime);
+    data->totalLatencyNs->fetch_add(static_cast<uint64_t>(latency.count()),
+                                    std::memory_order_relaxed);
+}
+
+}  // namespace
+
+// Measures the throughput of dawn::platform::AsyncWorkerThreadPool, which backs the
+// Create*PipelineAsync calls, as well as the latency between posting a task and it starting to run.
+// Each step posts |kNumTasksPerStep| trivial tasks and waits for all of them.
+class WorkerTaskPoolPerf : public DawnPerfTestWithParams<WorkerTaskPoolParams> {
+  public:
+    WorkerTaskPoolPerf()
+        : DawnPerfTestWithParams(kNumTasksPerStep, 1),
+          mPool(std::make_unique<dawn::platform::AsyncWorkerThreadPool>(GetParam().threadCount)),
+          mTaskData(kNumTasksPerStep),
+          mEvents(kNumTasksPerStep) {}
+    ~WorkerTaskPoolPerf() override = default;
+
+    double GetAverageLatencyNs() const {
+        if (mTaskCount == 0) {
+            return 0;
+        }
+        return static_cast<double>(mTotalLatencyNs.load()) / static_cast<double>(mTaskCount);
+    }
+
+  private:
+    void Step() override {
+        for (unsigned int i = 0; i < kNumTasksPerStep; ++i) {
+            mTaskData[i].totalLatencyNs = &mTotalLatencyNs;
+            mTaskData[i].postTime = Clock::now();
+            mEvents[i] = mPool->PostWorkerTask(RunTask, &mTaskData[i]);
+        }
+        for (std::unique_ptr<dawn::platform::WaitableEvent>& event : mEvents) {
+            event->Wait();
+            event = nullptr;
+        }
+        mTaskCount += kNumTasksPerStep;
+    }
+
+    std::unique_ptr<dawn::platform::AsyncWorkerThreadPool> mPool;
+    std::vector<TaskData> mTaskData;
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> mEvents;
+    std::atomic<uint64_t> mTotalLatencyNs{0};
+    uint64_t mTaskCount = 0;
+};
+
+TEST_P(WorkerTaskPoolPerf, Run) {
+    RunTest();
+    PrintResult("post_to_run_latency", GetAverageLatencyNs(), "ns", false);
+}
+
+// The pool doesn't touch the GPU, so only the null backend is needed.
+DAWN_INSTANTIATE_TEST_P(WorkerTaskPoolPerf, {NullBackend()}, {1, 2, 4, 8, 16});
@@ -0,0 +1,109 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace {
+
+constexpr uint32_t kBytesPerTexel = 4;
+
+// The rows of the source data are padded so that WriteTexture has to repack them to the layout of
+// the staging memory, like when uploading a sub-rectangle of a larger image.
+constexpr uint32_t kSourceRowPadding = 256;
+
+struct WriteTextureParams : AdapterTestParam {
+    WriteTextureParams(const AdapterTestParam& param, uint32_t textureSizeIn)
+        : AdapterTestParam(param), textureSize(textureSizeIn) {}
+    uint32_t textureSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const WriteTextureParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.textureSize << "x" << param.textureSize;
+    return ostream;
+}
+
+}  // namespace
+
+// Uploads a whole square RGBA8 texture with WriteTexture each step. Most of the time goes into
+// repacking the padded rows into the staging memory, which large uploads split across worker
+// threads unless disable_parallel_texture_data_upload is set.
+class WriteTexturePerf : public DawnPerfTestWithParams<WriteTextureParams> {
+  public:
+    WriteTexturePerf() : DawnPerfTestWithParams(1, 1) {}
+    ~WriteTexturePerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+    void OutputSectionResults(double sectionSecondsPerIteration) override;
+
+    wgpu::Texture mTexture;
+    std::vector<uint8_t> mData;
+    wgpu::TextureDataLayout mDataLayout;
+    wgpu::Extent3D mWriteSize;
+};
+
+void WriteTexturePerf::SetUp() {
+    DawnPerfTestWithParams<WriteTextureParams>::SetUp();
+
+    uint32_t size = GetParam().textureSize;
+    mWriteSize = {size, size, 1};
+
+    wgpu::TextureDescriptor descriptor;
+    descriptor.size = mWriteSize;
+    descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    descriptor.usage = wgpu::TextureUsage::CopyDst;
+    mTexture = device.CreateTexture(&descriptor);
+
+    mDataLayout.offset = 0;
+    mDataLayout.bytesPerRow = size * kBytesPerTexel + kSourceRowPadding;
+    mDataLayout.rowsPerImage = size;
+    mData.resize(uint64_t(mDataLayout.bytesPerRow) * size);
+    for (size_t i = 0; i < mData.size(); ++i) {
+        mData[i] = static_cast<uint8_t>(i);
+    }
+}
+
+void WriteTexturePerf::Step() {
+    wgpu::ImageCopyTexture destination = utils::CreateImageCopyTexture(mTexture);
+
+    {
+        ScopedSectionTimer uploadTimer(this);
+        queue.WriteTexture(&destination, mData.data(), mData.size(), &mDataLayout, &mWriteSize);
+    }
+
+    // Make sure the staging memory is recycled.
+    queue.Submit(0, nullptr);
+}
+
+// The throughput of the texel data, without the padding of the rows, copied by WriteTexture. The
+// submit recycling the staging memory is left out.
+void WriteTexturePerf::OutputSectionResults(double sectionSecondsPerIteration) {
+    double uploadedBytes = double(mWriteSize.width) * mWriteSize.height * kBytesPerTexel;
+    PrintResult("upload_throughput", uploadedBytes / sectionSecondsPerIteration * 1e-9, "GB/s",
+                false);
+}
+
+TEST_P(WriteTexturePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(WriteTexturePerf,
+                        {NullBackend(), NullBackend({"disable_parallel_texture_data_upload"}, {})},
+                        {1024, 2048, 4096, 8192});
@@ -16,6 +16,7 @@
 // AsyncTaskTests:
 //     Simple tests for dawn::native::AsyncTask and dawn::native::AsnycTaskManager.
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -25,6 +26,7 @@
 #include "dawn/common/NonCopyable.h"
 #include "dawn/native/AsyncTask.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/WorkerThread.h"
 #include "gtest/gtest.h"
 
 namespace {
@@ -61,6 +63,10 @@ void DoTask(ConcurrentTaskResultQueue* resultQueue, uint32_t id) {
     resultQueue->AddResult(std::move(result));
 }
 
+void IncrementCounter(void* userdata) {
+    static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1);
+}
+
 }  // anonymous namespace
 
 class AsyncTaskTest : public testing::Test {};
@@ -90,3 +96,80 @@ TEST_F(AsyncTaskTest, Basic) {
     }
     ASSERT_TRUE(idset.empty());
 }
+
+struct NestedTaskData {
+    dawn::platform::AsyncWorkerThreadPool* pool;
+    std::atomic<uint32_t>* counter;
+    std::unique_ptr<dawn::platform::WaitableEvent> nestedEvent;
+};
+
+// Test that tasks posted from a worker run, even with a single worker which must then pick up the
+// task from its own deque.
+TEST_F(AsyncTaskTest, PostFromWorkerTask) {
+    for (uint32_t threadCount : {1u, 4u}) {
+        dawn::platform::AsyncWorkerThreadPool pool(threadCount);
+        EXPECT_EQ(threadCount, pool.GetThreadCount());
+
+        std::atomic<uint32_t> counter{0};
+        NestedTaskData data = {&pool, &counter, nullptr};
+        std::unique_ptr<dawn::platform::WaitableEvent> event = pool.PostWorkerTask(
+            [](void* userdata) {
+                NestedTaskData* data = static_cast<NestedTaskData*>(userdata);
+                data->nestedEvent = data->pool->PostWorkerTask(IncrementCounter, data->counter);
+                data->counter->fetch_add(1);
+            },
+            &data);
+
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+        data.nestedEvent->Wait();
+        EXPECT_EQ(2u, counter.load());
+    }
+}
+
+// Test that a task can wait on the tasks it posted without deadlocking, even when all the workers
+// are running such tasks.
+TEST_F(AsyncTaskTest, WaitOnTaskPostedFromWorkerTask) {
+    for (uint32_t threadCount : {1u, 4u}) {
+        dawn::platform::AsyncWorkerThreadPool pool(threadCount);
+
+        std::atomic<uint32_t> counter{0};
+        std::vector<NestedTaskData> data(threadCount * 2);
+        std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+        for (NestedTaskData& taskData : data) {
+            taskData.pool = &pool;
+            taskData.counter = &counter;
+            events.push_back(pool.PostWorkerTask(
+                [](void* userdata) {
+                    NestedTaskData* data = static_cast<NestedTaskData*>(userdata);
+                    data->nestedEvent =
+                        data->pool->PostWorkerTask(IncrementCounter, data->counter);
+                    data->nestedEvent->Wait();
+                    EXPECT_TRUE(data->nestedEvent->IsComplete());
+                    data->counter->fetch_add(1);
+                },
+                &taskData));
+        }
+
+        for (std::unique_ptr<dawn::platform::WaitableEvent>& event : events) {
+            event->Wait();
+        }
+        EXPECT_EQ(threadCount * 4, counter.load());
+    }
+}
+
+// Test that destroying the pool runs all the tasks that were posted, including those whose
+// WaitableEvent was already dropped, and that events outlive the pool.
+TEST_F(AsyncTaskTest, PoolDestructionDrainsTasks) {
+    constexpr uint32_t kTaskCount = 100;
+    std::atomic<uint32_t> counter{0};
+    std::unique_ptr<dawn::platform::WaitableEvent> lastEvent;
+    {
+        dawn::platform::AsyncWorkerThreadPool pool(2);
+        for (uint32_t i = 0; i < kTaskCount; ++i) {
+            lastEvent = pool.PostWorkerTask(IncrementCounter, &counter);
+        }
+    }
+    EXPECT_EQ(kTaskCount, counter.load());
+    EXPECT_TRUE(lastEvent->IsComplete());
+}
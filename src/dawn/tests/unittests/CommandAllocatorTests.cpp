@@ -500,4 +500,81 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that the pool rounds block sizes up to its size classes.
+TEST(CommandBlockPool, GetBlockSize) {
+    EXPECT_EQ(CommandBlockPool::GetBlockSize(1), 4096u);
+    EXPECT_EQ(CommandBlockPool::GetBlockSize(4096), 4096u);
+    EXPECT_EQ(CommandBlockPool::GetBlockSize(4097), 8192u);
+    EXPECT_EQ(CommandBlockPool::GetBlockSize(16384), 16384u);
+    // Blocks larger than the largest size class aren't rounded.
+    EXPECT_EQ(CommandBlockPool::GetBlockSize(16385), 16385u);
+}
+
+// Test that the blocks of an allocator using a pool are returned to it when the commands are
+// destroyed, and reused by the next allocator.
+TEST(CommandBlockPool, BlocksAreReused) {
+    CommandBlockPool pool(1024 * 1024);
+
+    uint8_t* firstBlock;
+    {
+        CommandAllocator allocator(&pool);
+        CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+        firstBlock = reinterpret_cast<uint8_t*>(draw) - sizeof(uint32_t);
+        CommandIterator iterator(std::move(allocator));
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 4096u);
+
+    CommandAllocator allocator(&pool);
+    CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+    EXPECT_EQ(reinterpret_cast<uint8_t*>(draw) - sizeof(uint32_t), firstBlock);
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 0u);
+
+    allocator.Reset();
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 4096u);
+}
+
+// Test that the pool keeps the blocks of allocators moved out of, and of allocators flattened
+// into an iterator.
+TEST(CommandBlockPool, AcquireCommandBlocks) {
+    CommandBlockPool pool(1024 * 1024);
+
+    CommandAllocator pending(&pool);
+    std::vector<CommandAllocator> allocators;
+    for (size_t i = 0; i < 2; ++i) {
+        pending.Allocate<CommandDraw>(CommandType::Draw);
+        allocators.push_back(std::move(pending));
+    }
+
+    CommandIterator iterator;
+    iterator.AcquireCommandBlocks(std::move(allocators));
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 0u);
+    iterator.MakeEmptyAsDataWasDestroyed();
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 2 * 4096u);
+}
+
+// Test that the total size of the blocks kept by the pool is capped.
+TEST(CommandBlockPool, MaxCachedSize) {
+    CommandBlockPool pool(4096);
+
+    CommandAllocator allocatorA(&pool);
+    CommandAllocator allocatorB(&pool);
+    allocatorA.Allocate<CommandDraw>(CommandType::Draw);
+    allocatorB.Allocate<CommandDraw>(CommandType::Draw);
+
+    allocatorA.Reset();
+    allocatorB.Reset();
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 4096u);
+}
+
+// Test that blocks larger than the largest size class aren't kept by the pool.
+TEST(CommandBlockPool, LargeBlocksAreNotPooled) {
+    CommandBlockPool pool(1024 * 1024);
+
+    CommandAllocator allocator(&pool);
+    allocator.Allocate<CommandBig>(CommandType::Big);
+    allocator.Reset();
+    EXPECT_EQ(pool.GetCachedSizeForTesting(), 0u);
+}
+
 }  // namespace dawn::native
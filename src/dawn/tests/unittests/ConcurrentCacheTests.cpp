@@ -42,6 +42,32 @@ class SimpleCachedObject {
     size_t mValue;
 };
 
+// A RefCounted cached object that is not deleted when its last reference is released, so that
+// tests can look it up while it is being destroyed.
+class RefCountedCachedObject : public RefCounted {
+  public:
+    explicit RefCountedCachedObject(size_t value) : mValue(value) {}
+    ~RefCountedCachedObject() override = default;
+
+    bool IsDeleted() const { return mDeleted; }
+
+    struct EqualityFunc {
+        bool operator()(const RefCountedCachedObject* a, const RefCountedCachedObject* b) const {
+            return a->mValue == b->mValue;
+        }
+    };
+
+    struct HashFunc {
+        size_t operator()(const RefCountedCachedObject* obj) const { return obj->mValue; }
+    };
+
+  private:
+    void DeleteThis() override { mDeleted = true; }
+
+    size_t mValue;
+    bool mDeleted = false;
+};
+
 }  // anonymous namespace
 
 class ConcurrentCacheTest : public testing::Test {
@@ -108,3 +134,72 @@ TEST_F(ConcurrentCacheTest, EraseAfterInsertion) {
     ASSERT_TRUE(insertOutput.second);
     ASSERT_EQ(1u, erasedObjectCount);
 }
+
+// Test that erasing only removes the object itself and not other objects equal to it.
+TEST_F(ConcurrentCacheTest, EraseOnlyRemovesSameObject) {
+    SimpleCachedObject cachedObject(1);
+    SimpleCachedObject anotherCachedObject(1);
+
+    ASSERT_TRUE(mCache.Insert(&cachedObject).second);
+    ASSERT_EQ(0u, mCache.Erase(&anotherCachedObject));
+    ASSERT_EQ(&cachedObject, mCache.Find(&anotherCachedObject));
+    ASSERT_EQ(1u, mCache.Erase(&cachedObject));
+    ASSERT_TRUE(mCache.Empty());
+}
+
+// Test that FindAndReference returns a new reference to live objects only.
+TEST(ConcurrentCacheRefCountedTest, FindAndReference) {
+    ConcurrentCache<RefCountedCachedObject> cache;
+    RefCountedCachedObject* object = new RefCountedCachedObject(1);
+    RefCountedCachedObject blueprint(1);
+
+    ASSERT_TRUE(cache.InsertAndReference(object).second);
+    {
+        Ref<RefCountedCachedObject> found = cache.FindAndReference(&blueprint);
+        ASSERT_EQ(object, found.Get());
+        ASSERT_EQ(2u, object->GetRefCountForTesting());
+    }
+    ASSERT_EQ(1u, object->GetRefCountForTesting());
+
+    // Once the last reference is released, the object can no longer be found even though it is
+    // still in the cache.
+    object->Release();
+    ASSERT_TRUE(object->IsDeleted());
+    ASSERT_EQ(nullptr, cache.FindAndReference(&blueprint).Get());
+
+    ASSERT_EQ(1u, cache.Erase(object));
+    delete object;
+}
+
+// Test that InsertAndReference returns the equal cached object if it is alive, and replaces it
+// otherwise.
+TEST(ConcurrentCacheRefCountedTest, InsertAndReference) {
+    ConcurrentCache<RefCountedCachedObject> cache;
+    RefCountedCachedObject* object = new RefCountedCachedObject(1);
+    RefCountedCachedObject* anotherObject = new RefCountedCachedObject(1);
+
+    ASSERT_TRUE(cache.InsertAndReference(object).second);
+    {
+        std::pair<Ref<RefCountedCachedObject>, bool> result =
+            cache.InsertAndReference(anotherObject);
+        ASSERT_FALSE(result.second);
+        ASSERT_EQ(object, result.first.Get());
+    }
+
+    // The cached object is being destroyed, so the new object replaces it and erasing the
+    // destroyed object leaves the new one in the cache.
+    object->Release();
+    {
+        std::pair<Ref<RefCountedCachedObject>, bool> result =
+            cache.InsertAndReference(anotherObject);
+        ASSERT_TRUE(result.second);
+        ASSERT_EQ(anotherObject, result.first.Get());
+    }
+    ASSERT_EQ(0u, cache.Erase(object));
+    ASSERT_EQ(anotherObject, cache.FindAndReference(object).Get());
+
+    ASSERT_EQ(1u, cache.Erase(anotherObject));
+    ASSERT_TRUE(cache.Empty());
+    delete object;
+    delete anotherObject;
+}
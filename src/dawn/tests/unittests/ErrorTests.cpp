@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "dawn/native/Error.h"
 #include "dawn/native/ErrorData.h"
@@ -21,6 +23,37 @@
 namespace dawn::native {
 namespace {
 
+struct NamedThing {
+    std::string name;
+};
+
+absl::FormatConvertResult<absl::FormatConversionCharSet::kString>
+AbslFormatConvert(const NamedThing* value, const absl::FormatConversionSpec&, absl::FormatSink* s) {
+    s->Append(absl::StrFormat("[NamedThing \"%s\"]", value->name));
+    return {true};
+}
+
+struct LabeledDescriptor {
+    const char* label = nullptr;
+    uint32_t size = 0;
+};
+
+absl::FormatConvertResult<absl::FormatConversionCharSet::kString> AbslFormatConvert(
+    const LabeledDescriptor* value,
+    const absl::FormatConversionSpec&,
+    absl::FormatSink* s) {
+    if (value == nullptr) {
+        s->Append("[null]");
+        return {true};
+    }
+    s->Append("[LabeledDescriptor");
+    if (value->label != nullptr) {
+        s->Append(absl::StrFormat(" \"%s\"", value->label));
+    }
+    s->Append("]");
+    return {true};
+}
+
 int placeholderSuccess = 0xbeef;
 constexpr const char* placeholderErrorMessage = "I am an error message :3";
 
@@ -359,5 +392,75 @@ TEST(ErrorTests, TRY_ConversionToErrorOrResultNonPointer) {
     ASSERT_EQ(errorData->GetMessage(), placeholderErrorMessage);
 }
 
+// Check that the messages and contexts of errors are formatted with copies of their arguments,
+// since they are only formatted when they are read.
+TEST(ErrorTests, LazyFormatting_ArgumentsAreCopied) {
+    auto ReturnError = []() -> MaybeError {
+        std::string name = "buffer";
+        return DAWN_VALIDATION_ERROR("Invalid %s of size %u.", name, 42u);
+    };
+
+    auto Try = [ReturnError]() -> MaybeError {
+        std::string operation = "mapping";
+        DAWN_TRY_CONTEXT(ReturnError(), "%s at offset %d", operation, -4);
+        return {};
+    };
+
+    MaybeError result = Try();
+    ASSERT_TRUE(result.IsError());
+
+    std::unique_ptr<ErrorData> errorData = result.AcquireError();
+    ASSERT_EQ(errorData->GetMessage(), "Invalid buffer of size 42.");
+    std::vector<std::string> contexts = errorData->GetContexts();
+    ASSERT_EQ(contexts.size(), 1u);
+    ASSERT_EQ(contexts[0], "mapping at offset -4");
+}
+
+// Check that arguments that aren't numbers, enums or strings are formatted when the error is
+// created, so that the message doesn't depend on what they point to when it is read.
+TEST(ErrorTests, LazyFormatting_PointersFormattedEagerly) {
+    NamedThing thing = {"first"};
+    std::unique_ptr<ErrorData> errorData = DAWN_VALIDATION_ERROR("%s is invalid.", &thing);
+    errorData->AppendContext("using %s with %s", &thing, "a string");
+    thing.name = "second";
+
+    ASSERT_EQ(errorData->GetMessage(), "[NamedThing \"first\"] is invalid.");
+    std::vector<std::string> contexts = errorData->GetContexts();
+    ASSERT_EQ(contexts.size(), 1u);
+    ASSERT_EQ(contexts[0], "using [NamedThing \"first\"] with a string");
+}
+
+// Check that descriptors are captured by their label, so that they can be formatted after the
+// descriptor and its label went out of scope.
+TEST(ErrorTests, LazyFormatting_DescriptorsCapturedByLabel) {
+    std::unique_ptr<ErrorData> errorData;
+    {
+        std::string label = "first";
+        LabeledDescriptor descriptor = {label.c_str(), 4};
+        LabeledDescriptor unlabeledDescriptor = {};
+        const LabeledDescriptor* nullDescriptor = nullptr;
+        errorData = DAWN_VALIDATION_ERROR("%s is invalid.", &descriptor);
+        errorData->AppendContext("using %s, %s and %s", &descriptor, &unlabeledDescriptor,
+                                 nullDescriptor);
+        label = "second";
+    }
+
+    ASSERT_EQ(errorData->GetMessage(), "[LabeledDescriptor \"first\"] is invalid.");
+    std::vector<std::string> contexts = errorData->GetContexts();
+    ASSERT_EQ(contexts.size(), 1u);
+    ASSERT_EQ(contexts[0],
+              "using [LabeledDescriptor \"first\"], [LabeledDescriptor] and [null]");
+}
+
+// Check that a context that fails to format is replaced by a placeholder message.
+TEST(ErrorTests, LazyFormatting_FormatFailure) {
+    std::unique_ptr<ErrorData> errorData = DAWN_VALIDATION_ERROR(placeholderErrorMessage);
+    errorData->AppendContext("%d", "not a number");
+
+    std::vector<std::string> contexts = errorData->GetContexts();
+    ASSERT_EQ(contexts.size(), 1u);
+    ASSERT_EQ(contexts[0], "[Failed to format error: \"%d\"]");
+}
+
 }  // namespace
 }  // namespace dawn::native
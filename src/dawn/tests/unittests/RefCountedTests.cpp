@@ -97,6 +97,66 @@ TEST(RefCounted, RaceOnReferenceRelease) {
     EXPECT_TRUE(deleted);
 }
 
+// RCTest that isn't deleted when its last reference is removed, to test objects that are being
+// destroyed.
+class RCTestDeferredDelete : public RCTest {
+  public:
+    bool WasLastRefRemoved() const { return mLastRefRemoved; }
+
+  private:
+    void DeleteThis() override { mLastRefRemoved = true; }
+
+    bool mLastRefRemoved = false;
+};
+
+// Test that TryReference adds a reference while the object is alive.
+TEST(RefCounted, TryReferenceWhileAlive) {
+    bool deleted = false;
+    auto* test = new RCTest(&deleted);
+
+    EXPECT_TRUE(test->TryReference());
+    EXPECT_EQ(test->GetRefCountForTesting(), 2u);
+    test->Release();
+    EXPECT_FALSE(deleted);
+
+    test->Release();
+    EXPECT_TRUE(deleted);
+}
+
+// Test that TryReference fails once the last reference was removed.
+TEST(RefCounted, TryReferenceAfterLastRelease) {
+    auto* test = new RCTestDeferredDelete();
+
+    test->Release();
+    EXPECT_TRUE(test->WasLastRefRemoved());
+    EXPECT_FALSE(test->TryReference());
+    EXPECT_EQ(test->GetRefCountForTesting(), 0u);
+
+    delete test;
+}
+
+// Test that TryReference and Release atomically change the refcount.
+TEST(RefCounted, RaceOnTryReferenceRelease) {
+    auto* test = new RCTestDeferredDelete();
+
+    auto tryReferenceManyTimes = [test]() {
+        for (uint32_t i = 0; i < 100000; ++i) {
+            EXPECT_TRUE(test->TryReference());
+            test->Release();
+        }
+    };
+    std::thread t1(tryReferenceManyTimes);
+    std::thread t2(tryReferenceManyTimes);
+    t1.join();
+    t2.join();
+    EXPECT_EQ(test->GetRefCountForTesting(), 1u);
+    EXPECT_FALSE(test->WasLastRefRemoved());
+
+    test->Release();
+    EXPECT_TRUE(test->WasLastRefRemoved());
+    delete test;
+}
+
 // Test Ref remove reference when going out of scope
 TEST(Ref, EndOfScopeRemovesRef) {
     bool deleted = false;
@@ -0,0 +1,159 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "dawn/utils/RingBufferCommandSerializer.h"
+#include "gtest/gtest.h"
+
+namespace utils {
+namespace {
+
+// Records the commands it receives, and fails on commands containing kFailByte.
+class RecordingHandler : public dawn::wire::CommandHandler {
+  public:
+    static constexpr char kFailByte = 0x7F;
+
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        mBatchCount++;
+        for (size_t i = 0; i < size; ++i) {
+            char value = commands[i];
+            if (value == kFailByte) {
+                return nullptr;
+            }
+            mData.push_back(value);
+        }
+        return commands + size;
+    }
+
+    std::vector<char> mData;
+    size_t mBatchCount = 0;
+};
+
+void WriteCommand(RingBufferCommandSerializer* serializer, size_t size, char value) {
+    void* space = serializer->GetCmdSpace(size);
+    ASSERT_NE(space, nullptr);
+    memset(space, value, size);
+}
+
+// Test that the commands are only received once flushed, batched together.
+TEST(RingBufferCommandSerializerTests, Batching) {
+    RingBufferCommandSerializer serializer(1024);
+    RecordingHandler handler;
+
+    WriteCommand(&serializer, 16, 1);
+    WriteCommand(&serializer, 24, 2);
+    EXPECT_TRUE(serializer.ConsumeCommands(&handler));
+    EXPECT_TRUE(handler.mData.empty());
+    EXPECT_TRUE(serializer.IsDrained());
+
+    EXPECT_EQ(serializer.GetPublishedPosition(), 0u);
+    EXPECT_TRUE(serializer.Flush());
+    EXPECT_FALSE(serializer.IsDrained());
+    EXPECT_GT(serializer.GetPublishedPosition(), serializer.GetConsumedPosition());
+    EXPECT_TRUE(serializer.ConsumeCommands(&handler));
+    EXPECT_TRUE(serializer.IsDrained());
+    EXPECT_EQ(serializer.GetConsumedPosition(), serializer.GetPublishedPosition());
+
+    EXPECT_EQ(handler.mBatchCount, 1u);
+    std::vector<char> expected(16, 1);
+    expected.insert(expected.end(), 24, 2);
+    EXPECT_EQ(handler.mData, expected);
+}
+
+// Test that commands wrap around the end of the ring, and that a batch that doesn't fit before the
+// end of the ring is published early.
+TEST(RingBufferCommandSerializerTests, WrapAround) {
+    RingBufferCommandSerializer serializer(256);
+    RecordingHandler handler;
+    std::vector<char> expected;
+
+    // The batches are small enough to never fill the ring, otherwise the producer would wait for
+    // this thread to consume them.
+    for (char i = 0; i < 50; ++i) {
+        size_t size = 8 + (i % 5) * 8;
+        WriteCommand(&serializer, size, i);
+        expected.insert(expected.end(), size, i);
+        if (i % 2 == 1) {
+            EXPECT_TRUE(serializer.Flush());
+            EXPECT_TRUE(serializer.ConsumeCommands(&handler));
+        }
+    }
+    EXPECT_TRUE(serializer.Flush());
+    EXPECT_TRUE(serializer.ConsumeCommands(&handler));
+
+    EXPECT_EQ(handler.mData, expected);
+}
+
+// Test that allocations larger than the maximum allocation size fail.
+TEST(RingBufferCommandSerializerTests, MaximumAllocationSize) {
+    RingBufferCommandSerializer serializer(256);
+    ASSERT_LE(serializer.GetMaximumAllocationSize(), 256u);
+
+    EXPECT_EQ(serializer.GetCmdSpace(serializer.GetMaximumAllocationSize() + 1), nullptr);
+    EXPECT_NE(serializer.GetCmdSpace(serializer.GetMaximumAllocationSize()), nullptr);
+}
+
+// Test that a failure of the handler is reported and that the next batches are skipped.
+TEST(RingBufferCommandSerializerTests, HandlerFailure) {
+    RingBufferCommandSerializer serializer(1024);
+    RecordingHandler handler;
+
+    WriteCommand(&serializer, 8, RecordingHandler::kFailByte);
+    EXPECT_TRUE(serializer.Flush());
+    EXPECT_FALSE(serializer.ConsumeCommands(&handler));
+    EXPECT_TRUE(serializer.IsDrained());
+
+    EXPECT_FALSE(serializer.Flush());
+    EXPECT_EQ(serializer.GetCmdSpace(8), nullptr);
+    EXPECT_FALSE(serializer.ConsumeCommands(&handler));
+    EXPECT_EQ(handler.mBatchCount, 1u);
+}
+
+// Test sending commands to a consumer thread, with the producer waiting for space in the ring.
+TEST(RingBufferCommandSerializerTests, ConsumerThread) {
+    RingBufferCommandSerializer serializer(512);
+    RecordingHandler handler;
+
+    std::thread consumer([&]() {
+        while (serializer.WaitForCommands()) {
+            serializer.ConsumeCommands(&handler);
+        }
+    });
+
+    std::vector<char> expected;
+    for (int i = 0; i < 2000; ++i) {
+        size_t size = 8 * (1 + i % 13);
+        char value = static_cast<char>(i % 100);
+        WriteCommand(&serializer, size, value);
+        expected.insert(expected.end(), size, value);
+        if (i % 7 == 0) {
+            EXPECT_TRUE(serializer.Flush());
+        }
+    }
+    EXPECT_TRUE(serializer.Flush());
+
+    while (!serializer.IsDrained()) {
+        std::this_thread::yield();
+    }
+    serializer.Close();
+    consumer.join();
+
+    EXPECT_EQ(handler.mData, expected);
+}
+
+}  // anonymous namespace
+}  // namespace utils
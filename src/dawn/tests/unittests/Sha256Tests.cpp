@@ -0,0 +1,73 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+#include "dawn/common/Sha256.h"
+#include "gtest/gtest.h"
+
+namespace dawn {
+namespace {
+
+std::string ToHex(const Sha256::Digest& digest) {
+    std::string hex;
+    for (uint8_t byte : digest) {
+        char chars[3];
+        snprintf(chars, sizeof(chars), "%02x", byte);
+        hex += chars;
+    }
+    return hex;
+}
+
+std::string HashString(const std::string& data) {
+    return ToHex(Sha256::Hash(data.data(), data.size()));
+}
+
+// Test the FIPS 180-4 examples.
+TEST(Sha256Tests, KnownVectors) {
+    EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashString(""));
+    EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+              HashString("abc"));
+    EXPECT_EQ("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+              HashString("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+}
+
+// Test that the padding is correct around the block boundaries.
+TEST(Sha256Tests, BlockBoundaries) {
+    EXPECT_EQ("9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318",
+              HashString(std::string(55, 'a')));
+    EXPECT_EQ("ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb",
+              HashString(std::string(64, 'a')));
+}
+
+// Test that feeding the data in several Update calls gives the same digest as a single one.
+TEST(Sha256Tests, IncrementalUpdates) {
+    std::string data(1000, 'x');
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 7);
+    }
+
+    for (size_t chunkSize : {1u, 3u, 63u, 64u, 65u, 1000u}) {
+        Sha256 sha;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            sha.Update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(HashString(data), ToHex(sha.Finalize()));
+    }
+}
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -0,0 +1,113 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "dawn/common/SingleFlightCache.h"
+#include "dawn/native/AsyncTask.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/utils/SystemUtils.h"
+#include "gtest/gtest.h"
+
+class SingleFlightCacheTest : public testing::Test {
+  public:
+    SingleFlightCacheTest()
+        : mPool(mPlatform.CreateWorkerTaskPool()), mTaskManager(mPool.get()) {}
+
+  protected:
+    dawn::platform::Platform mPlatform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> mPool;
+    dawn::native::AsyncTaskManager mTaskManager;
+    SingleFlightCache<uint32_t, std::string> mCache;
+};
+
+// Test the basic miss then hit sequence.
+TEST_F(SingleFlightCacheTest, MissThenHit) {
+    EXPECT_EQ(nullptr, mCache.Acquire(1));
+    const std::string* value = mCache.Complete(1, "one");
+    EXPECT_EQ("one", *value);
+
+    EXPECT_EQ(value, mCache.Acquire(1));
+    EXPECT_EQ(nullptr, mCache.Acquire(2));
+    mCache.Complete(2, "two");
+
+    SingleFlightCache<uint32_t, std::string>::Stats stats = mCache.GetStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(2u, stats.misses);
+    EXPECT_EQ(0u, stats.coalescedWaits);
+}
+
+// Test that an abandoned key can be acquired again.
+TEST_F(SingleFlightCacheTest, AbandonThenAcquire) {
+    EXPECT_EQ(nullptr, mCache.Acquire(1));
+    mCache.Abandon(1);
+    EXPECT_EQ(nullptr, mCache.Acquire(1));
+    EXPECT_EQ("one", *mCache.Complete(1, "one"));
+    EXPECT_EQ(2u, mCache.GetStats().misses);
+}
+
+// Test that concurrent requests for a key in flight wait for its creation instead of creating it
+// again.
+TEST_F(SingleFlightCacheTest, ConcurrentRequestsAreCoalesced) {
+    constexpr uint32_t kWaiterCount = 4;
+
+    ASSERT_EQ(nullptr, mCache.Acquire(1));
+
+    std::atomic<uint32_t> matchingResults{0};
+    SingleFlightCache<uint32_t, std::string>* cachePtr = &mCache;
+    for (uint32_t i = 0; i < kWaiterCount; ++i) {
+        mTaskManager.PostTask([cachePtr, &matchingResults] {
+            const std::string* value = cachePtr->Acquire(1);
+            if (value != nullptr && *value == "one") {
+                matchingResults.fetch_add(1);
+            }
+        });
+    }
+
+    // Give the tasks a chance to start waiting before completing the value.
+    utils::USleep(1000);
+    mCache.Complete(1, "one");
+    mTaskManager.WaitAllPendingTasks();
+
+    EXPECT_EQ(kWaiterCount, matchingResults.load());
+    SingleFlightCache<uint32_t, std::string>::Stats stats = mCache.GetStats();
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(kWaiterCount, stats.hits + stats.coalescedWaits);
+}
+
+// Test that when the creation is abandoned, exactly one of the waiters takes over.
+TEST_F(SingleFlightCacheTest, AbandonWakesUpWaiter) {
+    ASSERT_EQ(nullptr, mCache.Acquire(1));
+
+    std::atomic<uint32_t> creatorCount{0};
+    SingleFlightCache<uint32_t, std::string>* cachePtr = &mCache;
+    for (uint32_t i = 0; i < 2; ++i) {
+        mTaskManager.PostTask([cachePtr, &creatorCount] {
+            if (cachePtr->Acquire(1) == nullptr) {
+                creatorCount.fetch_add(1);
+                cachePtr->Complete(1, "one");
+            }
+        });
+    }
+
+    utils::USleep(1000);
+    mCache.Abandon(1);
+    mTaskManager.WaitAllPendingTasks();
+
+    EXPECT_EQ(1u, creatorCount.load());
+    EXPECT_EQ("one", *mCache.Acquire(1));
+}
@@ -0,0 +1,221 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/utils/WireCapture.h"
+#include "dawn/webgpu_cpp.h"
+#include "dawn/wire/WireClient.h"
+#include "gtest/gtest.h"
+
+namespace utils {
+namespace {
+
+// Records the commands it receives.
+class RecordingHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        for (size_t i = 0; i < size; ++i) {
+            char value = commands[i];
+            mData.push_back(value);
+        }
+        return commands + size;
+    }
+
+    std::vector<char> mData;
+};
+
+void WriteCommand(dawn::wire::CommandSerializer* serializer, size_t size, char value) {
+    void* space = serializer->GetCmdSpace(size);
+    ASSERT_NE(space, nullptr);
+    memset(space, value, size);
+}
+
+std::unique_ptr<WireCaptureReader> ReadCapture(const std::string& capture) {
+    return WireCaptureReader::Create(std::make_unique<std::istringstream>(capture));
+}
+
+// Test that the commands are forwarded unchanged and captured in one record per flush.
+TEST(WireCaptureTests, CaptureCommands) {
+    auto stream = std::make_unique<std::ostringstream>();
+    std::ostringstream* captureStream = stream.get();
+    auto writer = std::make_unique<WireCaptureWriter>(std::move(stream));
+
+    RecordingHandler handler;
+    TerribleCommandBuffer target(&handler);
+    CaptureCommandSerializer serializer(&target, writer.get(),
+                                        WireCaptureRecordType::ClientCommands);
+    EXPECT_EQ(serializer.GetMaximumAllocationSize(), target.GetMaximumAllocationSize());
+
+    writer->WriteInjection(WireCaptureRecordType::InjectDevice, 2, 3);
+    WriteCommand(&serializer, 16, 1);
+    WriteCommand(&serializer, 8, 2);
+    EXPECT_TRUE(serializer.Flush());
+    WriteCommand(&serializer, 4, 3);
+    EXPECT_TRUE(serializer.Flush());
+    // Flushing without commands doesn't write a record.
+    EXPECT_TRUE(serializer.Flush());
+    std::string capture = captureStream->str();
+
+    std::vector<char> firstFlush(16, 1);
+    firstFlush.insert(firstFlush.end(), 8, 2);
+    std::vector<char> secondFlush(4, 3);
+    std::vector<char> expected = firstFlush;
+    expected.insert(expected.end(), secondFlush.begin(), secondFlush.end());
+    EXPECT_EQ(handler.mData, expected);
+
+    std::unique_ptr<WireCaptureReader> reader = ReadCapture(capture);
+    ASSERT_NE(reader, nullptr);
+
+    WireCaptureRecordType type;
+    std::vector<char> data;
+    ASSERT_TRUE(reader->ReadRecord(&type, &data));
+    EXPECT_EQ(type, WireCaptureRecordType::InjectDevice);
+    ASSERT_EQ(data.size(), sizeof(WireCaptureInjection));
+    WireCaptureInjection injection;
+    memcpy(&injection, data.data(), sizeof(injection));
+    EXPECT_EQ(injection.id, 2u);
+    EXPECT_EQ(injection.generation, 3u);
+
+    ASSERT_TRUE(reader->ReadRecord(&type, &data));
+    EXPECT_EQ(type, WireCaptureRecordType::ClientCommands);
+    EXPECT_EQ(data, firstFlush);
+
+    ASSERT_TRUE(reader->ReadRecord(&type, &data));
+    EXPECT_EQ(type, WireCaptureRecordType::ClientCommands);
+    EXPECT_EQ(data, secondFlush);
+
+    EXPECT_FALSE(reader->ReadRecord(&type, &data));
+}
+
+// Test that invalid or truncated captures are rejected.
+TEST(WireCaptureTests, InvalidCapture) {
+    EXPECT_EQ(ReadCapture(""), nullptr);
+    EXPECT_EQ(ReadCapture("NOTACAPTURE!"), nullptr);
+
+    auto stream = std::make_unique<std::ostringstream>();
+    std::ostringstream* captureStream = stream.get();
+    auto writer = std::make_unique<WireCaptureWriter>(std::move(stream));
+    std::vector<char> commands(32, 1);
+    writer->WriteRecord(WireCaptureRecordType::ServerCommands, commands.data(), commands.size());
+
+    std::string capture = captureStream->str();
+    capture.resize(capture.size() - 1);
+    std::unique_ptr<WireCaptureReader> reader = ReadCapture(capture);
+    ASSERT_NE(reader, nullptr);
+
+    WireCaptureRecordType type;
+    std::vector<char> data;
+    EXPECT_FALSE(reader->ReadRecord(&type, &data));
+}
+
+// Test that the commands of a WireClient can be captured and replayed on the Null backend.
+TEST(WireCaptureTests, CaptureAndReplayClientCommands) {
+    auto stream = std::make_unique<std::ostringstream>();
+    std::ostringstream* captureStream = stream.get();
+    auto writer = std::make_unique<WireCaptureWriter>(std::move(stream));
+
+    // Capture the commands of a client which isn't connected to a server.
+    {
+        RecordingHandler handler;
+        TerribleCommandBuffer target(&handler);
+        CaptureCommandSerializer serializer(&target, writer.get(),
+                                            WireCaptureRecordType::ClientCommands);
+        dawn::wire::WireClientDescriptor clientDesc = {};
+        clientDesc.serializer = &serializer;
+        dawn::wire::WireClient client(clientDesc);
+        const DawnProcTable& procs = dawn::wire::client::GetProcs();
+
+        dawn::wire::ReservedDevice reservation = client.ReserveDevice();
+        writer->WriteInjection(WireCaptureRecordType::InjectDevice, reservation.id,
+                               reservation.generation);
+        WGPUDevice device = reservation.device;
+
+        WGPUBufferDescriptor bufferDesc = {};
+        bufferDesc.size = 16;
+        bufferDesc.usage = WGPUBufferUsage_CopyDst;
+        WGPUBuffer buffer = procs.deviceCreateBuffer(device, &bufferDesc);
+        WGPUCommandEncoder encoder = procs.deviceCreateCommandEncoder(device, nullptr);
+        WGPUCommandBuffer commands = procs.commandEncoderFinish(encoder, nullptr);
+        WGPUQueue queue = procs.deviceGetQueue(device);
+        procs.queueSubmit(queue, 1, &commands);
+
+        procs.queueRelease(queue);
+        procs.commandBufferRelease(commands);
+        procs.commandEncoderRelease(encoder);
+        procs.bufferRelease(buffer);
+        procs.deviceRelease(device);
+        EXPECT_TRUE(serializer.Flush());
+    }
+    writer = nullptr;
+
+    std::unique_ptr<WireCaptureReader> reader = ReadCapture(captureStream->str());
+    ASSERT_NE(reader, nullptr);
+    std::vector<WireCaptureRecord> records;
+    WireCaptureRecord record;
+    while (reader->ReadRecord(&record.type, &record.data)) {
+        records.push_back(std::move(record));
+        record = {};
+    }
+
+    // Replay the capture on a device of the Null backend.
+    auto instance = std::make_unique<dawn::native::Instance>();
+    instance->DiscoverDefaultAdapters();
+    dawn::native::Adapter nullAdapter;
+    for (const dawn::native::Adapter& adapter : instance->GetAdapters()) {
+        wgpu::AdapterProperties properties;
+        adapter.GetProperties(&properties);
+        if (properties.backendType == wgpu::BackendType::Null) {
+            nullAdapter = adapter;
+            break;
+        }
+    }
+    ASSERT_TRUE(nullAdapter);
+
+    class RecordingObserver : public WireReplayObserver {
+      public:
+        void OnCommandEnd(const char* name, std::chrono::nanoseconds) override {
+            replayedCommands.push_back(name);
+        }
+        std::vector<std::string> replayedCommands;
+    };
+    RecordingObserver observer;
+    EXPECT_TRUE(ReplayWireCapture(records, dawn::native::GetProcs(), instance->Get(),
+                                  [&] { return nullAdapter.CreateDevice(); }, &observer));
+    const std::vector<std::string>& replayedCommands = observer.replayedCommands;
+
+    // The commands are replayed in order. The releases are replayed as other commands.
+    std::vector<std::string> expectedCommands = {"DeviceCreateBuffer", "DeviceCreateCommandEncoder",
+                                                 "CommandEncoderFinish", "QueueSubmit"};
+    auto it = replayedCommands.begin();
+    for (const std::string& expected : expectedCommands) {
+        it = std::find(it, replayedCommands.end(), expected);
+        EXPECT_NE(it, replayedCommands.end()) << expected << " wasn't replayed";
+    }
+
+    nullAdapter = {};
+    instance = nullptr;
+}
+
+}  // anonymous namespace
+}  // namespace utils
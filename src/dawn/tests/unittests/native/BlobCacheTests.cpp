@@ -0,0 +1,177 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/BlobCache.h"
+#include "dawn/native/CacheKey.h"
+#include "dawn/tests/mocks/platform/CachingInterfaceMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+
+namespace {
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+// Budget large enough for each stripe of the in-memory cache to hold a few test values.
+constexpr size_t kMemoryBudget = 16 * 1024;
+
+CacheKey MakeKey(const std::string& name) {
+    CacheKey key;
+    StreamIn(&key, kDawnVersion, name);
+    return key;
+}
+
+std::vector<uint8_t> MakeValue(size_t size, uint8_t seed) {
+    std::vector<uint8_t> value(size);
+    for (size_t i = 0; i < size; ++i) {
+        value[i] = static_cast<uint8_t>(seed + i);
+    }
+    return value;
+}
+
+bool BlobEquals(const Blob& blob, const std::vector<uint8_t>& value) {
+    return blob.Size() == value.size() && memcmp(blob.Data(), value.data(), value.size()) == 0;
+}
+
+class BlobCacheTests : public ::testing::Test {
+  protected:
+    NiceMock<CachingInterfaceMock> mMockCache;
+};
+
+// Test that stored values are loaded back from memory without calling the caching interface.
+TEST_F(BlobCacheTests, StoreThenLoadHitsMemory) {
+    BlobCache cache(&mMockCache, kMemoryBudget);
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> value = MakeValue(64, 1);
+
+    EXPECT_CALL(mMockCache, StoreData(_, key.size(), _, value.size())).Times(1);
+    cache.Store(key, value.size(), value.data());
+
+    EXPECT_CALL(mMockCache, LoadData).Times(0);
+    EXPECT_TRUE(BlobEquals(cache.Load(key), value));
+
+    BlobCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_EQ(stats.missCount, 0u);
+    EXPECT_EQ(stats.entryCount, 1u);
+    EXPECT_EQ(stats.memoryUsage, value.size());
+}
+
+// Test that values loaded from the caching interface are kept in memory for the next loads.
+TEST_F(BlobCacheTests, LoadMissIsKeptInMemory) {
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> value = MakeValue(64, 2);
+    mMockCache.StoreData(key.data(), key.size(), value.data(), value.size());
+
+    BlobCache cache(&mMockCache, kMemoryBudget);
+    EXPECT_TRUE(BlobEquals(cache.Load(key), value));
+    EXPECT_EQ(mMockCache.GetHitCount(), 1u);
+    EXPECT_TRUE(BlobEquals(cache.Load(key), value));
+    EXPECT_EQ(mMockCache.GetHitCount(), 1u);
+
+    BlobCacheStats stats = cache.GetStats();
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_EQ(stats.missCount, 1u);
+}
+
+// Test that loads from memory share the cached data instead of copying it, and that the data
+// stays valid after the entry is replaced.
+TEST_F(BlobCacheTests, LoadSharesData) {
+    BlobCache cache(&mMockCache, kMemoryBudget);
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> value = MakeValue(64, 3);
+    cache.Store(key, value.size(), value.data());
+
+    Blob a = cache.Load(key);
+    Blob b = cache.Load(key);
+    EXPECT_EQ(a.Data(), b.Data());
+
+    std::vector<uint8_t> otherValue = MakeValue(64, 4);
+    cache.Store(key, otherValue.size(), otherValue.data());
+    EXPECT_TRUE(BlobEquals(a, value));
+    EXPECT_TRUE(BlobEquals(cache.Load(key), otherValue));
+}
+
+// Test that the least recently used entries are evicted to stay within the budget.
+TEST_F(BlobCacheTests, EvictsLeastRecentlyUsed) {
+    // The budget is split between stripes, so store enough values to overflow all of them.
+    BlobCache cache(&mMockCache, kMemoryBudget);
+    constexpr size_t kValueSize = 256;
+    constexpr size_t kValueCount = 4 * kMemoryBudget / kValueSize;
+    for (size_t i = 0; i < kValueCount; ++i) {
+        std::vector<uint8_t> value = MakeValue(kValueSize, static_cast<uint8_t>(i));
+        cache.Store(MakeKey(std::to_string(i)), value.size(), value.data());
+    }
+
+    BlobCacheStats stats = cache.GetStats();
+    EXPECT_LE(stats.memoryUsage, kMemoryBudget);
+    EXPECT_EQ(stats.entryCount * kValueSize, stats.memoryUsage);
+    EXPECT_EQ(stats.entryCount + stats.evictionCount, kValueCount);
+
+    // The most recently stored value is still in memory.
+    EXPECT_CALL(mMockCache, LoadData).Times(0);
+    std::vector<uint8_t> lastValue = MakeValue(kValueSize, static_cast<uint8_t>(kValueCount - 1));
+    EXPECT_TRUE(BlobEquals(cache.Load(MakeKey(std::to_string(kValueCount - 1))), lastValue));
+}
+
+// Test that values larger than the budget go through the caching interface only, and replace the
+// previous in-memory value for the same key.
+TEST_F(BlobCacheTests, LargeValuesAreNotKeptInMemory) {
+    BlobCache cache(&mMockCache, kMemoryBudget);
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> smallValue = MakeValue(64, 5);
+    std::vector<uint8_t> largeValue = MakeValue(kMemoryBudget, 6);
+
+    cache.Store(key, smallValue.size(), smallValue.data());
+    cache.Store(key, largeValue.size(), largeValue.data());
+    EXPECT_EQ(cache.GetStats().entryCount, 0u);
+
+    EXPECT_TRUE(BlobEquals(cache.Load(key), largeValue));
+    EXPECT_EQ(mMockCache.GetHitCount(), 1u);
+}
+
+// Test that a zero budget disables the in-memory cache.
+TEST_F(BlobCacheTests, ZeroBudgetAlwaysLoadsFromInterface) {
+    BlobCache cache(&mMockCache, 0);
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> value = MakeValue(64, 7);
+
+    cache.Store(key, value.size(), value.data());
+    EXPECT_TRUE(BlobEquals(cache.Load(key), value));
+    EXPECT_TRUE(BlobEquals(cache.Load(key), value));
+    EXPECT_EQ(mMockCache.GetHitCount(), 2u);
+    EXPECT_EQ(cache.GetStats().entryCount, 0u);
+}
+
+// Test that nothing is cached without a caching interface.
+TEST_F(BlobCacheTests, NoCachingInterface) {
+    BlobCache cache(nullptr, kMemoryBudget);
+    CacheKey key = MakeKey("key");
+    std::vector<uint8_t> value = MakeValue(64, 8);
+
+    cache.Store(key, value.size(), value.data());
+    EXPECT_TRUE(cache.Load(key).Empty());
+    EXPECT_EQ(cache.GetStats().entryCount, 0u);
+}
+
+}  // namespace
+
+}  // namespace dawn::native
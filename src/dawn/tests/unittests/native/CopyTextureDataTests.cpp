@@ -0,0 +1,161 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dawn/native/CopyTextureData.h"
+#include "dawn/platform/WorkerThread.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+struct CopyLayout {
+    uint32_t depth;
+    uint32_t rowsPerImage;
+    uint64_t imageAdditionalStride;
+    uint32_t actualBytesPerRow;
+    uint32_t dstBytesPerRow;
+    uint32_t srcBytesPerRow;
+};
+
+class CopyTextureDataTests : public testing::Test {
+  protected:
+    // Copies with the options and checks that the destination matches a row by row copy, and that
+    // the padding between the destination rows is left untouched.
+    void DoTest(const CopyLayout& layout, const CopyTextureDataOptions& options) {
+        uint64_t srcSize =
+            uint64_t(layout.depth) * (uint64_t(layout.rowsPerImage) * layout.srcBytesPerRow +
+                                      layout.imageAdditionalStride);
+        // Offset the pointers so that non-temporal copies have to handle unaligned data.
+        std::vector<uint8_t> src(srcSize + 3);
+        for (size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<uint8_t>(i * 7 + i / 251);
+        }
+        uint64_t dstSize = uint64_t(layout.depth) * layout.rowsPerImage * layout.dstBytesPerRow;
+        std::vector<uint8_t> dst(dstSize + 5, 0xAB);
+        std::vector<uint8_t> expected(dst);
+
+        for (uint32_t d = 0; d < layout.depth; ++d) {
+            for (uint32_t h = 0; h < layout.rowsPerImage; ++h) {
+                uint64_t row = uint64_t(d) * layout.rowsPerImage + h;
+                uint64_t srcOffset =
+                    3 + d * (uint64_t(layout.rowsPerImage) * layout.srcBytesPerRow +
+                             layout.imageAdditionalStride) +
+                    uint64_t(h) * layout.srcBytesPerRow;
+                memcpy(&expected[5 + row * layout.dstBytesPerRow], &src[srcOffset],
+                       layout.actualBytesPerRow);
+            }
+        }
+
+        CopyTextureData(dst.data() + 5, src.data() + 3, layout.depth, layout.rowsPerImage,
+                        layout.imageAdditionalStride, layout.actualBytesPerRow,
+                        layout.dstBytesPerRow, layout.srcBytesPerRow, options);
+        EXPECT_TRUE(dst == expected);
+    }
+
+    void DoTestWithAllOptions(const CopyLayout& layout) {
+        for (bool parallel : {false, true}) {
+            for (bool writeOnlyDestination : {false, true}) {
+                CopyTextureDataOptions options;
+                options.workerTaskPool = parallel ? &mPool : nullptr;
+                options.writeOnlyDestination = writeOnlyDestination;
+                DoTest(layout, options);
+            }
+        }
+    }
+
+    dawn::platform::AsyncWorkerThreadPool mPool{4};
+};
+
+// Test copies small enough to be done on the calling thread.
+TEST_F(CopyTextureDataTests, Small) {
+    DoTestWithAllOptions({1, 4, 0, 16, 16, 16});
+    DoTestWithAllOptions({3, 4, 0, 16, 16, 16});
+    DoTestWithAllOptions({3, 4, 32, 16, 16, 16});
+    DoTestWithAllOptions({3, 5, 12, 12, 256, 20});
+}
+
+// Test copies of rows that are repacked, large enough to be split in bands and use non-temporal
+// stores.
+TEST_F(CopyTextureDataTests, LargeRowByRow) {
+    DoTestWithAllOptions({1, 1023, 0, 4100, 4352, 4104});
+    DoTestWithAllOptions({3, 517, 4100, 4100, 4352, 4104});
+}
+
+// Test large copies of whole layers and of the whole data.
+TEST_F(CopyTextureDataTests, LargeWholeLayers) {
+    DoTestWithAllOptions({1, 1025, 0, 4100, 4100, 4100});
+    DoTestWithAllOptions({5, 333, 0, 4100, 4100, 4100});
+    DoTestWithAllOptions({5, 333, 100, 4100, 4100, 4100});
+}
+
+// Test a large copy with fewer rows than the maximum number of bands.
+TEST_F(CopyTextureDataTests, LargeRows) {
+    DoTestWithAllOptions({1, 3, 0, 3 * 1024 * 1024 + 7, 3 * 1024 * 1024 + 256,
+                          3 * 1024 * 1024 + 7});
+}
+
+// A WorkerTaskPool that only runs the posted tasks when RunTasks is called, like a pool busy with
+// other work.
+class DeferredWorkerTaskPool : public dawn::platform::WorkerTaskPool {
+  public:
+    class Event : public dawn::platform::WaitableEvent {
+      public:
+        void Wait() override {}
+        bool IsComplete() override { return true; }
+    };
+
+    std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata) override {
+        mTasks.emplace_back(callback, userdata);
+        return std::make_unique<Event>();
+    }
+
+    void RunTasks() {
+        for (auto& [callback, userdata] : mTasks) {
+            callback(userdata);
+        }
+        mTasks.clear();
+    }
+
+  private:
+    std::vector<std::pair<dawn::platform::PostWorkerTaskCallback, void*>> mTasks;
+};
+
+// Test that a parallel copy completes on the calling thread without waiting for the tasks that
+// didn't start, and that these tasks do nothing when they run after the copy.
+TEST_F(CopyTextureDataTests, TasksStartingAfterTheCopy) {
+    DeferredWorkerTaskPool pool;
+    CopyTextureDataOptions options;
+    options.workerTaskPool = &pool;
+
+    CopyLayout layout = {1, 1025, 0, 4100, 4100, 4100};
+    std::vector<uint8_t> src(uint64_t(layout.rowsPerImage) * layout.srcBytesPerRow, 0x42);
+    auto dst = std::make_unique<std::vector<uint8_t>>(src.size(), 0);
+    CopyTextureData(dst->data(), src.data(), layout.depth, layout.rowsPerImage,
+                    layout.imageAdditionalStride, layout.actualBytesPerRow, layout.dstBytesPerRow,
+                    layout.srcBytesPerRow, options);
+    EXPECT_TRUE(*dst == src);
+
+    // The tasks must not touch the destination anymore. There are none on single core machines.
+    dst = nullptr;
+    pool.RunTasks();
+}
+
+}  // namespace
+}  // namespace dawn::native
@@ -0,0 +1,278 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "dawn/webgpu_cpp.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+// Long enough to never be hit when the futures complete.
+constexpr uint64_t kTimeoutNS = 10'000'000'000;
+
+// A platform whose worker threads only run their tasks once the gate is opened, so that the futures
+// depending on them stay pending for as long as the test needs.
+class GatedWorkerPlatform : public dawn::platform::Platform {
+  public:
+    void OpenGate() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mGateOpen = true;
+        }
+        mCondition.notify_all();
+    }
+
+    std::unique_ptr<dawn::platform::WorkerTaskPool> CreateWorkerTaskPool() override {
+        return std::make_unique<Pool>(this);
+    }
+
+  private:
+    struct TaskState {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool complete = false;
+    };
+
+    class Event : public dawn::platform::WaitableEvent {
+      public:
+        explicit Event(std::shared_ptr<TaskState> state) : mState(std::move(state)) {}
+
+        void Wait() override {
+            std::unique_lock<std::mutex> lock(mState->mutex);
+            mState->condition.wait(lock, [&] { return mState->complete; });
+        }
+        bool IsComplete() override {
+            std::lock_guard<std::mutex> lock(mState->mutex);
+            return mState->complete;
+        }
+
+      private:
+        std::shared_ptr<TaskState> mState;
+    };
+
+    class Pool : public dawn::platform::WorkerTaskPool {
+      public:
+        explicit Pool(GatedWorkerPlatform* platform) : mPlatform(platform) {}
+        ~Pool() override {
+            for (std::thread& thread : mThreads) {
+                thread.join();
+            }
+        }
+
+        std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
+            dawn::platform::PostWorkerTaskCallback callback,
+            void* userdata) override {
+            auto state = std::make_shared<TaskState>();
+            mThreads.emplace_back([platform = mPlatform, state, callback, userdata] {
+                platform->WaitForGate();
+                callback(userdata);
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->complete = true;
+                }
+                state->condition.notify_all();
+            });
+            return std::make_unique<Event>(std::move(state));
+        }
+
+      private:
+        GatedWorkerPlatform* mPlatform;
+        std::vector<std::thread> mThreads;
+    };
+
+    void WaitForGate() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [&] { return mGateOpen; });
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mGateOpen = false;
+};
+
+class FutureTests : public testing::Test {
+  protected:
+    void SetUp() override {
+        dawnProcSetProcs(&GetProcs());
+
+        WGPUInstanceDescriptor instanceDesc = {};
+        instance = std::make_unique<Instance>(&instanceDesc);
+        instance->SetPlatform(&platform);
+        instance->DiscoverDefaultAdapters();
+        for (Adapter& nativeAdapter : instance->GetAdapters()) {
+            wgpu::AdapterProperties properties;
+            nativeAdapter.GetProperties(&properties);
+
+            if (properties.backendType == wgpu::BackendType::Null) {
+                device = wgpu::Device::Acquire(nativeAdapter.CreateDevice());
+                break;
+            }
+        }
+        ASSERT_NE(device, nullptr);
+    }
+
+    void TearDown() override {
+        // Let the pending worker tasks finish so that the device can be destroyed.
+        platform.OpenGate();
+        pipeline = nullptr;
+        device = nullptr;
+        instance = nullptr;
+        dawnProcSetProcs(nullptr);
+    }
+
+    // Creates a compute pipeline asynchronously and returns the future of the creation.
+    uint64_t CreateComputePipelineAsyncF() {
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.compute.module = utils::CreateShaderModule(device, R"(
+            @compute @workgroup_size(1) fn main() {})");
+        descriptor.compute.entryPoint = "main";
+
+        return DeviceCreateComputePipelineAsyncF(
+            device.Get(), reinterpret_cast<const WGPUComputePipelineDescriptor*>(&descriptor),
+            [](WGPUCreatePipelineAsyncStatus status, WGPUComputePipeline pipeline, const char*,
+               void* userdata) {
+                auto* self = static_cast<FutureTests*>(userdata);
+                self->pipelineStatus = status;
+                self->pipeline = wgpu::ComputePipeline::Acquire(pipeline);
+            },
+            this);
+    }
+
+    GatedWorkerPlatform platform;
+    std::unique_ptr<Instance> instance;
+    wgpu::Device device;
+
+    WGPUCreatePipelineAsyncStatus pipelineStatus = WGPUCreatePipelineAsyncStatus_Unknown;
+    wgpu::ComputePipeline pipeline;
+};
+
+// Test that WaitAny returns once the work submitted to the queue is done, and that the callback was
+// called with the user's userdata.
+TEST_F(FutureTests, QueueWorkDone) {
+    WGPUQueueWorkDoneStatus status = WGPUQueueWorkDoneStatus_Unknown;
+    FutureWaitInfo info;
+    info.future = QueueOnSubmittedWorkDoneF(
+        device.GetQueue().Get(), 0,
+        [](WGPUQueueWorkDoneStatus callbackStatus, void* userdata) {
+            *static_cast<WGPUQueueWorkDoneStatus*>(userdata) = callbackStatus;
+        },
+        &status);
+    EXPECT_NE(info.future, 0u);
+
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, kTimeoutNS), WaitStatus::Success);
+    EXPECT_TRUE(info.completed);
+    EXPECT_EQ(status, WGPUQueueWorkDoneStatus_Success);
+}
+
+// Test that WaitAny returns once a buffer is mapped.
+TEST_F(FutureTests, BufferMapAsync) {
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = 4;
+    descriptor.usage = wgpu::BufferUsage::MapRead;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    WGPUBufferMapAsyncStatus status = WGPUBufferMapAsyncStatus_Unknown;
+    FutureWaitInfo info;
+    info.future = BufferMapAsyncF(
+        buffer.Get(), WGPUMapMode_Read, 0, 4,
+        [](WGPUBufferMapAsyncStatus callbackStatus, void* userdata) {
+            *static_cast<WGPUBufferMapAsyncStatus*>(userdata) = callbackStatus;
+        },
+        &status);
+
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, kTimeoutNS), WaitStatus::Success);
+    EXPECT_TRUE(info.completed);
+    EXPECT_EQ(status, WGPUBufferMapAsyncStatus_Success);
+    EXPECT_NE(buffer.GetConstMappedRange(), nullptr);
+}
+
+// Test that futures can be waited on after their callback was called by ProcessEvents, and that
+// WaitAny doesn't block in that case.
+TEST_F(FutureTests, CompletedByProcessEvents) {
+    bool done = false;
+    FutureWaitInfo info;
+    info.future = QueueOnSubmittedWorkDoneF(
+        device.GetQueue().Get(), 0,
+        [](WGPUQueueWorkDoneStatus, void* userdata) { *static_cast<bool*>(userdata) = true; },
+        &done);
+    while (!done) {
+        InstanceProcessEvents(instance->Get());
+    }
+
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, 0), WaitStatus::Success);
+    EXPECT_TRUE(info.completed);
+}
+
+// Test that waiting on futures that weren't returned by the instance is an error.
+TEST_F(FutureTests, UnknownFuture) {
+    FutureWaitInfo info;
+    info.future = 0;
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, 0), WaitStatus::UnknownFuture);
+
+    info.future = QueueOnSubmittedWorkDoneF(device.GetQueue().Get(), 0, nullptr, nullptr);
+    info.future++;
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, 0), WaitStatus::UnknownFuture);
+}
+
+// Test that WaitAny returns TimedOut when the futures don't complete in time, and that the futures
+// can still be waited on after that.
+TEST_F(FutureTests, TimedOut) {
+    FutureWaitInfo info;
+    info.future = CreateComputePipelineAsyncF();
+
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, 0), WaitStatus::TimedOut);
+    EXPECT_FALSE(info.completed);
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, 1'000'000), WaitStatus::TimedOut);
+    EXPECT_FALSE(info.completed);
+    EXPECT_EQ(pipelineStatus, WGPUCreatePipelineAsyncStatus_Unknown);
+
+    platform.OpenGate();
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, kTimeoutNS), WaitStatus::Success);
+    EXPECT_TRUE(info.completed);
+    EXPECT_EQ(pipelineStatus, WGPUCreatePipelineAsyncStatus_Success);
+}
+
+// Test that a thread waiting on the future of an asynchronous pipeline creation is woken up when a
+// worker thread finishes creating the pipeline.
+TEST_F(FutureTests, CreatePipelineAsyncWokenByWorker) {
+    FutureWaitInfo info;
+    info.future = CreateComputePipelineAsyncF();
+
+    // Open the gate once the main thread is likely asleep in WaitAny.
+    std::thread opener([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        platform.OpenGate();
+    });
+    EXPECT_EQ(InstanceWaitAny(instance->Get(), 1, &info, kTimeoutNS), WaitStatus::Success);
+    opener.join();
+
+    EXPECT_TRUE(info.completed);
+    EXPECT_EQ(pipelineStatus, WGPUCreatePipelineAsyncStatus_Success);
+    EXPECT_NE(pipeline, nullptr);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
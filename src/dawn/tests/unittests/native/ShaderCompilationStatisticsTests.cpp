@@ -0,0 +1,70 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "dawn/native/ShaderCompilationStatistics.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+
+namespace {
+
+ShaderCompilationStatistics MakeCompilation(const char* entryPoint,
+                                            ShaderCompilationStatistics::Source source) {
+    ShaderCompilationStatistics statistics;
+    statistics.entryPoint = entryPoint;
+    statistics.source = source;
+    return statistics;
+}
+
+// Test that the recorder only keeps the most recent entries and counts the dropped ones.
+TEST(ShaderCompilationStatisticsTests, DropsOldestEntries) {
+    ShaderCompilationStatisticsRecorder recorder(2);
+
+    ShaderModuleStatistics module;
+    module.label = "a";
+    recorder.RecordShaderModule(module);
+    module.label = "b";
+    recorder.RecordShaderModule(module);
+    module.label = "c";
+    recorder.RecordShaderModule(module);
+
+    recorder.RecordCompilation(MakeCompilation("x", ShaderCompilationStatistics::Source::Compiled));
+    recorder.RecordCompilation(
+        MakeCompilation("y", ShaderCompilationStatistics::Source::BlobCache));
+    recorder.RecordCompilation(
+        MakeCompilation("z", ShaderCompilationStatistics::Source::InMemoryCache));
+
+    std::string json = recorder.ToJSON();
+    EXPECT_EQ(json.find(R"("label":"a")"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("label":"b")"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("label":"c")"), std::string::npos) << json;
+
+    EXPECT_EQ(json.find(R"("entryPoint":"x")"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("entryPoint":"y","stage":"vertex","generator":"","source":"blobCache")"),
+              std::string::npos)
+        << json;
+    EXPECT_NE(
+        json.find(R"("entryPoint":"z","stage":"vertex","generator":"","source":"inMemoryCache")"),
+        std::string::npos)
+        << json;
+
+    EXPECT_NE(json.find(R"("droppedShaderModules":1,"droppedCompilations":1})"), std::string::npos)
+        << json;
+}
+
+}  // anonymous namespace
+
+}  // namespace dawn::native
@@ -124,6 +124,10 @@ class DeviceMock : public DeviceBase {
     MOCK_METHOD(MaybeError, TickImpl, (), (override));
 
     MOCK_METHOD(ResultOrError<ExecutionSerial>, CheckAndUpdateCompletedSerials, (), (override));
+    MOCK_METHOD(MaybeError,
+                WaitForQueueSerialImpl,
+                (ExecutionSerial, std::chrono::nanoseconds),
+                (override));
     MOCK_METHOD(void, DestroyImpl, (), (override));
     MOCK_METHOD(MaybeError, WaitForIdleForDestruction, (), (override));
     MOCK_METHOD(bool, HasPendingCommands, (), (const, override));
@@ -498,6 +498,47 @@ TEST_F(MinBufferSizeDrawTimeValidationTests, MultipleGroups) {
     });
 }
 
+// Draw time validation catches bind groups too small for a pipeline that shares its layout with
+// a previous pipeline that had smaller minimum sizes
+TEST_F(MinBufferSizeDrawTimeValidationTests, PipelinesSharingLayout) {
+    std::vector<BindingDescriptor> smallBindings = {{0, 0, "a : f32, b : f32", "f32", "a", 8}};
+    std::vector<BindingDescriptor> largeBindings = {
+        {0, 0, "a : f32, b : f32, c : f32, d : f32", "f32", "a", 16}};
+
+    std::string vertexShader = CreateVertexShaderWithBindings({});
+    wgpu::BindGroupLayout layout = CreateBindGroupLayout(smallBindings, {0});
+
+    wgpu::RenderPipeline smallPipeline = CreateRenderPipeline(
+        {layout}, vertexShader, CreateFragmentShaderWithBindings(smallBindings));
+    wgpu::RenderPipeline largePipeline = CreateRenderPipeline(
+        {layout}, vertexShader, CreateFragmentShaderWithBindings(largeBindings));
+
+    wgpu::BindGroup bindGroup = CreateBindGroup(layout, smallBindings, {8});
+
+    auto TestDrawWithPipelines = [&](const std::vector<wgpu::RenderPipeline>& pipelines,
+                                     bool expectation) {
+        PlaceholderRenderPass renderPass(device);
+
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetBindGroup(0, bindGroup);
+        for (const wgpu::RenderPipeline& pipeline : pipelines) {
+            renderPassEncoder.SetPipeline(pipeline);
+            renderPassEncoder.Draw(3);
+        }
+        renderPassEncoder.End();
+        if (!expectation) {
+            ASSERT_DEVICE_ERROR(commandEncoder.Finish());
+        } else {
+            commandEncoder.Finish();
+        }
+    };
+
+    TestDrawWithPipelines({smallPipeline, smallPipeline}, true);
+    TestDrawWithPipelines({smallPipeline, largePipeline}, false);
+    TestDrawWithPipelines({largePipeline, smallPipeline}, false);
+}
+
 // The correctness of minimum buffer size for the defaulted layout for a pipeline
 class MinBufferSizeDefaultLayoutTests : public MinBufferSizeTestsBase {
   public:
@@ -187,6 +187,45 @@ TEST_F(ShaderModuleValidationTest, NonUniformDerivatives_FlagSetToTrue) {
     utils::CreateShaderModuleFromASM(device, kShaderWithNonUniformDerivative, &spirv_options_desc);
 }
 
+// Shader module tests on a device that skips validation. The shader module cache is then looked up
+// before the shader is parsed, so a module can be wrongly returned by the cache instead of failing.
+class ShaderModuleSkipValidationTest : public ValidationTest {
+  protected:
+    WGPUDevice CreateTestDevice(dawn::native::Adapter dawnAdapter) override {
+        const char* enabledToggle = "skip_validation";
+        wgpu::DawnTogglesDescriptor deviceTogglesDesc;
+        deviceTogglesDesc.enabledToggles = &enabledToggle;
+        deviceTogglesDesc.enabledTogglesCount = 1;
+
+        wgpu::DeviceDescriptor deviceDescriptor;
+        deviceDescriptor.nextInChain = &deviceTogglesDesc;
+        return dawnAdapter.CreateDevice(&deviceDescriptor);
+    }
+};
+
+// Test that a module created with the `allowNonUniformDerivatives` flag set to `true` isn't reused
+// for the same SPIR-V shader created without it, which must still fail.
+TEST_F(ShaderModuleSkipValidationTest, NonUniformDerivatives_FlagNotSharedByCache) {
+    // The test compares the dawn::native objects returned by the cache.
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    wgpu::DawnShaderModuleSPIRVOptionsDescriptor spirv_options_desc = {};
+    spirv_options_desc.allowNonUniformDerivatives = true;
+    wgpu::ShaderModule module = utils::CreateShaderModuleFromASM(
+        device, kShaderWithNonUniformDerivative, &spirv_options_desc);
+
+    // Check that the cache is reached: the same descriptor returns the same module.
+    wgpu::ShaderModule sameModule = utils::CreateShaderModuleFromASM(
+        device, kShaderWithNonUniformDerivative, &spirv_options_desc);
+    EXPECT_EQ(module.Get(), sameModule.Get());
+
+    spirv_options_desc.allowNonUniformDerivatives = false;
+    wgpu::ShaderModule otherModule;
+    ASSERT_DEVICE_ERROR(otherModule = utils::CreateShaderModuleFromASM(
+                            device, kShaderWithNonUniformDerivative, &spirv_options_desc));
+    EXPECT_NE(module.Get(), otherModule.Get());
+}
+
 #endif  // TINT_BUILD_SPV_READER
 
 // Test that it is invalid to create a shader module with no chained descriptor. (It must be
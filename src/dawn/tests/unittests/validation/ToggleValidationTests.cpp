@@ -12,9 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string>
 #include <vector>
 
 #include "dawn/tests/unittests/validation/ValidationTest.h"
+#include "dawn/utils/WGPUHelpers.h"
 
 namespace {
 
@@ -109,4 +111,49 @@ TEST_F(ToggleValidationTest, TurnOffVsyncWithToggle) {
     }
     ASSERT_EQ(validToggleExists, true);
 }
+
+// Tests that the shader compilation statistics are only recorded with the toggle, and contain the
+// shader modules and compilations of the device.
+TEST_F(ToggleValidationTest, RecordShaderCompilationStatistics) {
+    // The statistics aren't recorded by default.
+    EXPECT_EQ(dawn::native::GetShaderCompilationStatisticsJSON(device.Get()), "");
+
+    const char* kToggleName = "record_shader_compilation_statistics";
+    wgpu::DeviceDescriptor descriptor;
+    wgpu::DawnTogglesDescriptor deviceTogglesDesc;
+    descriptor.nextInChain = &deviceTogglesDesc;
+    deviceTogglesDesc.enabledToggles = &kToggleName;
+    deviceTogglesDesc.enabledTogglesCount = 1;
+
+    wgpu::Device deviceWithToggle =
+        wgpu::Device::Acquire(GetBackendAdapter().CreateDevice(&descriptor));
+    EXPECT_EQ(dawn::native::GetShaderCompilationStatisticsJSON(deviceWithToggle.Get()),
+              R"({"shaderModules":[],"compilations":[],)"
+              R"("droppedShaderModules":0,"droppedCompilations":0})");
+
+    wgpu::ShaderModuleWGSLDescriptor wgslDesc;
+    wgslDesc.source = R"(
+        @compute @workgroup_size(1) fn main() {
+        })";
+    wgpu::ShaderModuleDescriptor moduleDesc;
+    moduleDesc.nextInChain = &wgslDesc;
+    moduleDesc.label = "my \"module\"";
+    wgpu::ShaderModule module = deviceWithToggle.CreateShaderModule(&moduleDesc);
+
+    wgpu::ComputePipelineDescriptor pipelineDesc;
+    pipelineDesc.compute.module = module;
+    pipelineDesc.compute.entryPoint = "main";
+    wgpu::ComputePipeline pipeline = deviceWithToggle.CreateComputePipeline(&pipelineDesc);
+
+    std::string json = dawn::native::GetShaderCompilationStatisticsJSON(deviceWithToggle.Get());
+    EXPECT_NE(json.find(R"({"shaderModules":[{"label":"my \"module\"","sourceDigest":")"),
+              std::string::npos)
+        << json;
+    EXPECT_NE(json.find(R"("astNodeCount":)"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("compilations":[{"shaderModuleLabel":"my \"module\"")"),
+              std::string::npos)
+        << json;
+    EXPECT_NE(json.find(R"("entryPoint":"main","stage":"compute")"), std::string::npos) << json;
+    EXPECT_NE(json.find(R"("source":"compiled")"), std::string::npos) << json;
+}
 }  // anonymous namespace
@@ -237,6 +237,12 @@ void ValidationTest::WaitForAllOperations(const wgpu::Device& device) {
         FlushWire();
     }
 
+    // Pipelines are created asynchronously on worker threads, so also wait for the backend device
+    // to be idle for their callbacks to be called.
+    while (dawn::native::DeviceTick(backendDevice)) {
+        FlushWire();
+    }
+
     // TODO(cwallez@chromium.org): It's not clear why we need this additional tick. Investigate it
     // once WebGPU has defined the ordering of callbacks firing.
     device.Tick();
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "dawn/tests/unittests/wire/WireTest.h"
 #include "dawn/wire/WireClient.h"
@@ -20,8 +22,10 @@
 namespace dawn::wire {
 
 using testing::_;
+using testing::Invoke;
 using testing::InvokeWithoutArgs;
 using testing::Mock;
+using testing::Return;
 
 class MockQueueWorkDoneCallback {
   public:
@@ -193,6 +197,80 @@ TEST_F(WireQueueTests, DeviceThenDefaultQueueReleased) {
     DefaultApiDeviceWasReleased();
 }
 
+// Test WriteBuffer with data larger than the maximum allocation size of the serializer, which is
+// split in chunks.
+TEST_F(WireQueueTests, WriteBufferLargerThanMaximumAllocationSize) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = 4 * 1024 * 1024;
+    descriptor.usage = WGPUBufferUsage_CopyDst;
+
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    FlushClient();
+
+    // Use a size that isn't a multiple of the wire alignment so that padding is needed.
+    std::vector<uint8_t> data(3 * 1024 * 1024 + 3);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    wgpuQueueWriteBuffer(queue, buffer, 16, data.data(), data.size());
+
+    EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 16, _, data.size()))
+        .WillOnce(Invoke([&](WGPUQueue, WGPUBuffer, uint64_t, const void* apiData, size_t size) {
+            EXPECT_EQ(memcmp(apiData, data.data(), size), 0);
+        }));
+    FlushClient();
+}
+
+// Test WriteTexture with data larger than the maximum allocation size of the serializer, which is
+// split in chunks, and followed by other members of the command.
+TEST_F(WireQueueTests, WriteTextureLargerThanMaximumAllocationSize) {
+    WGPUTextureDescriptor descriptor = {};
+    descriptor.dimension = WGPUTextureDimension_2D;
+    descriptor.size = {1024, 1024, 1};
+    descriptor.format = WGPUTextureFormat_RGBA8Unorm;
+    descriptor.mipLevelCount = 1;
+    descriptor.sampleCount = 1;
+    descriptor.usage = WGPUTextureUsage_CopyDst;
+
+    WGPUTexture texture = wgpuDeviceCreateTexture(device, &descriptor);
+    WGPUTexture apiTexture = api.GetNewTexture();
+    EXPECT_CALL(api, DeviceCreateTexture(apiDevice, _)).WillOnce(Return(apiTexture));
+    FlushClient();
+
+    std::vector<uint8_t> data(4 * 1024 * 1024 + 5);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+    WGPUImageCopyTexture destination = {};
+    destination.texture = texture;
+    destination.origin = {0, 0, 0};
+    destination.aspect = WGPUTextureAspect_All;
+    WGPUTextureDataLayout dataLayout = {};
+    dataLayout.offset = 5;
+    dataLayout.bytesPerRow = 4 * 1024;
+    dataLayout.rowsPerImage = 1024;
+    WGPUExtent3D writeSize = {1024, 1024, 1};
+    wgpuQueueWriteTexture(queue, &destination, data.data(), data.size(), &dataLayout, &writeSize);
+
+    EXPECT_CALL(api, QueueWriteTexture(apiQueue, _, _, data.size(), _, _))
+        .WillOnce(Invoke([&](WGPUQueue, const WGPUImageCopyTexture* apiDestination,
+                             const void* apiData, size_t size,
+                             const WGPUTextureDataLayout* apiDataLayout,
+                             const WGPUExtent3D* apiWriteSize) {
+            EXPECT_EQ(apiDestination->texture, apiTexture);
+            EXPECT_EQ(memcmp(apiData, data.data(), size), 0);
+            EXPECT_EQ(apiDataLayout->offset, 5u);
+            EXPECT_EQ(apiDataLayout->bytesPerRow, 4u * 1024);
+            EXPECT_EQ(apiDataLayout->rowsPerImage, 1024u);
+            EXPECT_EQ(apiWriteSize->width, 1024u);
+            EXPECT_EQ(apiWriteSize->height, 1024u);
+            EXPECT_EQ(apiWriteSize->depthOrArrayLayers, 1u);
+        }));
+    FlushClient();
+}
+
 // Only one default queue is supported now so we cannot test ~Queue triggering ClearAllCallbacks
 // since it is always destructed after the test TearDown, and we cannot create a new queue obj
 // with wgpuDeviceGetQueue
@@ -0,0 +1,166 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+namespace dawn::wire {
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+
+class WireRenderPassEncoderTests : public WireTest {
+  protected:
+    void SetUp() override {
+        WireTest::SetUp();
+
+        WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+
+        WGPURenderPassDescriptor passDescriptor = {};
+        pass = wgpuCommandEncoderBeginRenderPass(encoder, &passDescriptor);
+        apiPass = api.GetNewRenderPassEncoder();
+        EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _)).WillOnce(Return(apiPass));
+
+        WGPUBufferDescriptor bufferDescriptor = {};
+        bufferDescriptor.size = 64;
+        bufferDescriptor.usage = WGPUBufferUsage_Vertex;
+        buffer = wgpuDeviceCreateBuffer(device, &bufferDescriptor);
+        apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+
+        FlushClient();
+    }
+
+    WGPUCommandEncoder apiEncoder;
+    WGPURenderPassEncoder pass;
+    WGPURenderPassEncoder apiPass;
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+};
+
+// Test that the state and draw commands are only sent when the pass ends, in order.
+TEST_F(WireRenderPassEncoderTests, CommandsSentAtEnd) {
+    WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+    WGPUBindGroupLayout bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _))
+        .WillOnce(Return(api.GetNewBindGroupLayout()));
+
+    WGPUBindGroupDescriptor bindGroupDescriptor = {};
+    bindGroupDescriptor.layout = bgl;
+    WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &bindGroupDescriptor);
+    WGPUBindGroup apiBindGroup = api.GetNewBindGroup();
+    EXPECT_CALL(api, DeviceCreateBindGroup(apiDevice, _)).WillOnce(Return(apiBindGroup));
+    FlushClient();
+
+    std::array<uint32_t, 2> offsets = {256, 0xDEAD'BEEFu};
+    WGPUColor color = {0.25, 0.5, 0.75, 1.0};
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffer, 8, 16);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffer, WGPUIndexFormat_Uint32, 4, 32);
+    wgpuRenderPassEncoderSetBindGroup(pass, 2, bindGroup, offsets.size(), offsets.data());
+    wgpuRenderPassEncoderSetViewport(pass, 1.0f, 2.0f, 3.0f, 4.0f, 0.0f, 1.0f);
+    wgpuRenderPassEncoderSetScissorRect(pass, 5, 6, 7, 8);
+    wgpuRenderPassEncoderSetBlendConstant(pass, &color);
+    wgpuRenderPassEncoderSetStencilReference(pass, 3);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 2, 1, -1, 4);
+    wgpuRenderPassEncoderDrawIndirect(pass, buffer, 16);
+    wgpuRenderPassEncoderDrawIndexedIndirect(pass, buffer, 32);
+
+    // Nothing is sent before the pass ends.
+    FlushClient();
+
+    wgpuRenderPassEncoderEnd(pass);
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffer, 8, 16));
+        EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffer,
+                                                         WGPUIndexFormat_Uint32, 4, 32));
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(
+                             apiPass, 2, apiBindGroup, offsets.size(),
+                             MatchesLambda([offsets](const uint32_t* actual) -> bool {
+                                 return actual[0] == offsets[0] && actual[1] == offsets[1];
+                             })));
+        EXPECT_CALL(api, RenderPassEncoderSetViewport(apiPass, 1.0f, 2.0f, 3.0f, 4.0f, 0.0f, 1.0f));
+        EXPECT_CALL(api, RenderPassEncoderSetScissorRect(apiPass, 5, 6, 7, 8));
+        EXPECT_CALL(api, RenderPassEncoderSetBlendConstant(
+                             apiPass, MatchesLambda([](const WGPUColor* actual) -> bool {
+                                 return actual->r == 0.25 && actual->g == 0.5 &&
+                                        actual->b == 0.75 && actual->a == 1.0;
+                             })));
+        EXPECT_CALL(api, RenderPassEncoderSetStencilReference(apiPass, 3));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 2, 1, -1, 4));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndirect(apiPass, apiBuffer, 16));
+        EXPECT_CALL(api, RenderPassEncoderDrawIndexedIndirect(apiPass, apiBuffer, 32));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that the packed commands are sent before the other commands of the pass.
+TEST_F(WireRenderPassEncoderTests, OrderWithUnpackedCommands) {
+    wgpuRenderPassEncoderDraw(pass, 1, 1, 0, 0);
+    wgpuRenderPassEncoderInsertDebugMarker(pass, "marker");
+    wgpuRenderPassEncoderDraw(pass, 2, 1, 0, 0);
+    wgpuRenderPassEncoderEnd(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 1, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderInsertDebugMarker(apiPass, _));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 2, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that an object released while used by packed commands stays alive until they are sent.
+TEST_F(WireRenderPassEncoderTests, ReleasedObjectKeptAlive) {
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffer, 0, 64);
+    wgpuBufferRelease(buffer);
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+
+    // The buffer isn't released on the server yet.
+    FlushClient();
+
+    wgpuRenderPassEncoderEnd(pass);
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffer, 0, 64));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+        EXPECT_CALL(api, BufferRelease(apiBuffer));
+        EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    }
+    FlushClient();
+}
+
+// Test that releasing the pass sends its packed commands.
+TEST_F(WireRenderPassEncoderTests, ReleaseSendsPackedCommands) {
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    wgpuRenderPassEncoderRelease(pass);
+
+    {
+        InSequence s;
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderRelease(apiPass));
+    }
+    FlushClient();
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,260 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "dawn/common/Platform.h"
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace dawn::wire {
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+
+namespace {
+
+void ExpectSuccessCallback(WGPUBufferMapAsyncStatus status, void* userdata) {
+    EXPECT_EQ(status, WGPUBufferMapAsyncStatus_Success);
+    *static_cast<bool*>(userdata) = true;
+}
+
+}  // anonymous namespace
+
+// Test mapping buffers with the shared memory MemoryTransferService, with the data going through
+// the shared memory instead of the commands.
+class WireSharedMemoryTransferServiceTests : public WireTest {
+  public:
+    WireSharedMemoryTransferServiceTests() {
+        int sockets[2] = {-1, -1};
+#if DAWN_PLATFORM_IS(LINUX)
+        socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets);
+#endif
+        mClientMemoryTransferService = client::CreateSharedMemoryTransferService(sockets[0]);
+        mServerMemoryTransferService = server::CreateSharedMemoryTransferService(sockets[1]);
+    }
+    ~WireSharedMemoryTransferServiceTests() override = default;
+
+    client::MemoryTransferService* GetClientMemoryTransferService() override {
+        return mClientMemoryTransferService.get();
+    }
+
+    server::MemoryTransferService* GetServerMemoryTransferService() override {
+        return mServerMemoryTransferService.get();
+    }
+
+    void SetUp() override {
+        WireTest::SetUp();
+        if (mClientMemoryTransferService == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on this platform.";
+        }
+    }
+
+  protected:
+    static constexpr uint64_t kBufferSize = 16;
+
+    std::unique_ptr<client::MemoryTransferService> mClientMemoryTransferService;
+    std::unique_ptr<server::MemoryTransferService> mServerMemoryTransferService;
+};
+
+// Test that the data of a buffer mapped for reading is received through the shared memory.
+TEST_F(WireSharedMemoryTransferServiceTests, MapRead) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_MapRead;
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    FlushClient();
+
+    bool mapped = false;
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 8, 8, ExpectSuccessCallback, &mapped);
+
+    std::array<uint32_t, 4> apiBufferData = {1, 2, 3, 4};
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Read, 8, 8, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetConstMappedRange(apiBuffer, 8, 8))
+        .WillOnce(Return(&apiBufferData[2]));
+    FlushClient();
+    FlushServer();
+    ASSERT_TRUE(mapped);
+
+    const uint32_t* data =
+        static_cast<const uint32_t*>(wgpuBufferGetConstMappedRange(buffer, 8, 8));
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data[0], 3u);
+    EXPECT_EQ(data[1], 4u);
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+}
+
+// Test that the data written in a buffer mapped for writing is received through the shared
+// memory.
+TEST_F(WireSharedMemoryTransferServiceTests, MapWrite) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_MapWrite;
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    FlushClient();
+
+    bool mapped = false;
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Write, 0, kBufferSize, ExpectSuccessCallback, &mapped);
+
+    std::array<uint32_t, 4> apiBufferData = {};
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Write, 0, kBufferSize, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(apiBufferData.data()));
+    FlushClient();
+    FlushServer();
+    ASSERT_TRUE(mapped);
+
+    uint32_t* data = static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, 0, kBufferSize));
+    ASSERT_NE(data, nullptr);
+    // The mapped data is zero-initialized.
+    EXPECT_EQ(data[3], 0u);
+    data[0] = 42;
+    data[3] = 1337;
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    EXPECT_EQ(apiBufferData[0], 42u);
+    EXPECT_EQ(apiBufferData[3], 1337u);
+}
+
+// Test that the data of a buffer mapped at creation is received even if the client destroys its
+// handle when unmapping, before the server saw the creation of the buffer.
+TEST_F(WireSharedMemoryTransferServiceTests, MappedAtCreationUnmapBeforeFlush) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kBufferSize;
+    descriptor.usage = WGPUBufferUsage_CopySrc;
+    descriptor.mappedAtCreation = true;
+
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+    uint32_t* data = static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, 0, kBufferSize));
+    ASSERT_NE(data, nullptr);
+    data[1] = 7;
+    wgpuBufferUnmap(buffer);
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    std::array<uint32_t, 4> apiBufferData = {};
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, kBufferSize))
+        .WillOnce(Return(apiBufferData.data()));
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    EXPECT_EQ(apiBufferData[1], 7u);
+}
+
+#if DAWN_PLATFORM_IS(LINUX)
+// Test that the server only uses the file descriptors received from the client, and doesn't close
+// a file descriptor whose number the client puts in the create info.
+TEST_F(WireSharedMemoryTransferServiceTests, UnknownIdIsRejected) {
+    int fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    ASSERT_GE(fd, 0);
+
+    SharedMemoryHandleCreateInfo info = {};
+    info.id = static_cast<uint64_t>(fd);
+    info.size = kBufferSize;
+
+    server::MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    EXPECT_FALSE(
+        mServerMemoryTransferService->DeserializeWriteHandle(&info, sizeof(info), &writeHandle));
+    server::MemoryTransferService::ReadHandle* readHandle = nullptr;
+    EXPECT_FALSE(
+        mServerMemoryTransferService->DeserializeReadHandle(&info, sizeof(info), &readHandle));
+
+    EXPECT_NE(fcntl(fd, F_GETFD), -1);
+    close(fd);
+}
+
+// Test that each region sent by the client can only be used by one server handle.
+TEST_F(WireSharedMemoryTransferServiceTests, RegionUsedOnce) {
+    client::MemoryTransferService::WriteHandle* clientHandle =
+        mClientMemoryTransferService->CreateWriteHandle(kBufferSize);
+    ASSERT_NE(clientHandle, nullptr);
+    std::vector<uint8_t> createInfo(clientHandle->SerializeCreateSize());
+    clientHandle->SerializeCreate(createInfo.data());
+    delete clientHandle;
+
+    server::MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    EXPECT_TRUE(mServerMemoryTransferService->DeserializeWriteHandle(
+        createInfo.data(), createInfo.size(), &writeHandle));
+    ASSERT_NE(writeHandle, nullptr);
+    delete writeHandle;
+
+    writeHandle = nullptr;
+    EXPECT_FALSE(mServerMemoryTransferService->DeserializeWriteHandle(
+        createInfo.data(), createInfo.size(), &writeHandle));
+}
+
+// Test that the regions created by the client can't be truncated, since the server would fault
+// when accessing its mapping.
+TEST_F(WireSharedMemoryTransferServiceTests, RegionSizeIsSealed) {
+    std::unique_ptr<SharedMemoryMapping> mapping = SharedMemoryMapping::Create(kBufferSize);
+    ASSERT_NE(mapping, nullptr);
+    EXPECT_NE(ftruncate(mapping->GetFd(), 0), 0);
+    EXPECT_NE(ftruncate(mapping->GetFd(), 2 * kBufferSize), 0);
+}
+
+// Test that the server rejects a region whose size isn't sealed.
+TEST_F(WireSharedMemoryTransferServiceTests, UnsealedRegionIsRejected) {
+    int fd = static_cast<int>(syscall(__NR_memfd_create, "unsealed", 0));
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, kBufferSize), 0);
+    EXPECT_EQ(SharedMemoryMapping::Import(dup(fd), kBufferSize), nullptr);
+
+    // Regions received through the socket are rejected as well.
+    int sockets[2] = {-1, -1};
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets), 0);
+    std::unique_ptr<server::MemoryTransferService> serverService =
+        server::CreateSharedMemoryTransferService(sockets[1]);
+    SharedMemoryHandleCreateInfo info = {};
+    info.id = 1;
+    info.size = kBufferSize;
+    ASSERT_TRUE(SendSharedMemoryFd(sockets[0], info.id, fd));
+    close(fd);
+
+    server::MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    EXPECT_FALSE(serverService->DeserializeWriteHandle(&info, sizeof(info), &writeHandle));
+    close(sockets[0]);
+}
+#endif  // DAWN_PLATFORM_IS(LINUX)
+
+}  // namespace dawn::wire
@@ -0,0 +1,110 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/DawnTest.h"
+
+#include "dawn/native/vulkan/ShaderModuleVk.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native::vulkan {
+
+namespace {
+
+class VulkanShaderModuleCacheTests : public DawnTest {
+  protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+        mVSModule = utils::CreateShaderModule(device, R"(
+            @vertex fn main() -> @builtin(position) vec4f {
+                return vec4f(0.0, 0.0, 0.0, 1.0);
+            })");
+        mFSModule = utils::CreateShaderModule(device, R"(
+            @fragment fn red() -> @location(0) vec4f {
+                return vec4f(1.0, 0.0, 0.0, 1.0);
+            }
+            @fragment fn green() -> @location(0) vec4f {
+                return vec4f(0.0, 1.0, 0.0, 1.0);
+            })");
+        mLayout = utils::MakeBasicPipelineLayout(device, nullptr);
+    }
+
+    wgpu::RenderPipeline CreatePipeline(const char* fragmentEntryPoint) {
+        utils::ComboRenderPipelineDescriptor descriptor;
+        descriptor.layout = mLayout;
+        descriptor.vertex.module = mVSModule;
+        descriptor.vertex.entryPoint = "main";
+        descriptor.cFragment.module = mFSModule;
+        descriptor.cFragment.entryPoint = fragmentEntryPoint;
+        return device.CreateRenderPipeline(&descriptor);
+    }
+
+    static TransformedShaderModuleCacheStats GetStats(const wgpu::ShaderModule& module) {
+        return ToBackend(FromAPI(module.Get()))->GetTransformedShaderModuleCacheStatsForTesting();
+    }
+
+    wgpu::ShaderModule mVSModule;
+    wgpu::ShaderModule mFSModule;
+    wgpu::PipelineLayout mLayout;
+};
+
+}  // anonymous namespace
+
+// Test that an entry point is only compiled once per layout, and that the pipelines using it
+// afterwards hit the cache.
+TEST_P(VulkanShaderModuleCacheTests, SameEntryPointAndLayoutHitsTheCache) {
+    wgpu::RenderPipeline redPipeline = CreatePipeline("red");
+    {
+        TransformedShaderModuleCacheStats vsStats = GetStats(mVSModule);
+        EXPECT_EQ(vsStats.hits, 0u);
+        EXPECT_EQ(vsStats.misses, 1u);
+        EXPECT_EQ(vsStats.coalescedWaits, 0u);
+    }
+
+    // The second pipeline is a different pipeline, so it isn't deduplicated by the device, but it
+    // shares its vertex stage with the first one.
+    wgpu::RenderPipeline greenPipeline = CreatePipeline("green");
+    {
+        TransformedShaderModuleCacheStats vsStats = GetStats(mVSModule);
+        EXPECT_EQ(vsStats.hits, 1u);
+        EXPECT_EQ(vsStats.misses, 1u);
+        EXPECT_EQ(vsStats.coalescedWaits, 0u);
+    }
+
+    // Each fragment entry point is compiled once.
+    TransformedShaderModuleCacheStats fsStats = GetStats(mFSModule);
+    EXPECT_EQ(fsStats.hits, 0u);
+    EXPECT_EQ(fsStats.misses, 2u);
+    EXPECT_EQ(fsStats.coalescedWaits, 0u);
+}
+
+// Test that the same entry point is compiled again for a different layout.
+TEST_P(VulkanShaderModuleCacheTests, DifferentLayoutMissesTheCache) {
+    wgpu::RenderPipeline pipeline = CreatePipeline("red");
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Uniform}});
+    mLayout = utils::MakeBasicPipelineLayout(device, &bgl);
+    wgpu::RenderPipeline otherLayoutPipeline = CreatePipeline("red");
+
+    TransformedShaderModuleCacheStats vsStats = GetStats(mVSModule);
+    EXPECT_EQ(vsStats.hits, 0u);
+    EXPECT_EQ(vsStats.misses, 2u);
+}
+
+DAWN_INSTANTIATE_TEST(VulkanShaderModuleCacheTests, VulkanBackend());
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,217 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/RingBufferCommandSerializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+
+namespace utils {
+
+namespace {
+
+// Each batch starts with a header containing the size of its commands. A header containing
+// kWrapMarker, or a tail of the ring too small for a header, means that the next batch is at the
+// start of the ring.
+constexpr size_t kHeaderSize = sizeof(uint64_t);
+constexpr uint64_t kWrapMarker = ~uint64_t(0);
+
+constexpr size_t kMinCapacity = 64;
+
+}  // anonymous namespace
+
+RingBufferCommandSerializer::RingBufferCommandSerializer(size_t capacity)
+    : mCapacity(static_cast<size_t>(NextPowerOfTwo(std::max(capacity, kMinCapacity)))),
+      mStorage(new uint64_t[mCapacity / sizeof(uint64_t)]),
+      mData(reinterpret_cast<char*>(mStorage.get())) {}
+
+RingBufferCommandSerializer::~RingBufferCommandSerializer() = default;
+
+size_t RingBufferCommandSerializer::GetMaximumAllocationSize() const {
+    return mCapacity - kHeaderSize;
+}
+
+void* RingBufferCommandSerializer::GetCmdSpace(size_t size) {
+    if (size > GetMaximumAllocationSize() || mFailed.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    if (mHasOpenBatch) {
+        // Commands of a batch must be contiguous, and the batch can't grow over data that isn't
+        // consumed yet. Otherwise publish the batch so that the consumer can make progress.
+        uint64_t batchEnd = (mBatchStart & (mCapacity - 1)) + (mAllocationPosition - mBatchStart);
+        if (batchEnd + size > mCapacity) {
+            Flush();
+        } else if (mAllocationPosition + size - mCachedReadPosition > mCapacity) {
+            mCachedReadPosition = mReadPosition.load(std::memory_order_acquire);
+            if (mAllocationPosition + size - mCachedReadPosition > mCapacity) {
+                Flush();
+            }
+        }
+    }
+    if (!mHasOpenBatch) {
+        OpenBatch(size);
+    }
+
+    char* result =
+        mData + (mBatchStart & (mCapacity - 1)) + (mAllocationPosition - mBatchStart);
+    mAllocationPosition += size;
+    return result;
+}
+
+bool RingBufferCommandSerializer::Flush() {
+    if (mHasOpenBatch) {
+        uint64_t size = mAllocationPosition - mBatchStart - kHeaderSize;
+        memcpy(mData + (mBatchStart & (mCapacity - 1)), &size, sizeof(size));
+        mHasOpenBatch = false;
+        Publish(mAllocationPosition);
+    }
+    return !mFailed.load(std::memory_order_acquire);
+}
+
+void RingBufferCommandSerializer::OpenBatch(size_t size) {
+    ASSERT(!mHasOpenBatch);
+    uint64_t position = mWritePosition.load(std::memory_order_relaxed);
+
+    // Skip the end of the ring if the batch doesn't fit in it.
+    size_t tail = mCapacity - (position & (mCapacity - 1));
+    if (tail < kHeaderSize + size) {
+        WaitForSpace(position + tail);
+        if (tail >= kHeaderSize) {
+            memcpy(mData + (position & (mCapacity - 1)), &kWrapMarker, sizeof(kWrapMarker));
+        }
+        position += tail;
+        Publish(position);
+    }
+
+    WaitForSpace(position + kHeaderSize + size);
+    mBatchStart = position;
+    mAllocationPosition = position + kHeaderSize;
+    mHasOpenBatch = true;
+}
+
+void RingBufferCommandSerializer::Publish(uint64_t position) {
+    // The sequentially consistent store and load pair with the ones in WaitForCommands so that
+    // either the consumer sees the new batch, or the producer sees that the consumer sleeps.
+    mWritePosition.store(position, std::memory_order_seq_cst);
+    if (mConsumerWaiting.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCommandsCondition.notify_one();
+    }
+}
+
+void RingBufferCommandSerializer::WaitForSpace(uint64_t endPosition) {
+    if (endPosition - mCachedReadPosition <= mCapacity) {
+        return;
+    }
+    mCachedReadPosition = mReadPosition.load(std::memory_order_acquire);
+    if (endPosition - mCachedReadPosition <= mCapacity) {
+        return;
+    }
+
+    // The sequentially consistent store and load pair with the ones in ConsumeCommands so that
+    // either the producer sees the freed space, or the consumer sees that the producer sleeps.
+    mProducerWaiting.store(true, std::memory_order_seq_cst);
+    if (mProducerWaitingCallback) {
+        mProducerWaitingCallback();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mSpaceCondition.wait(lock, [&] {
+            mCachedReadPosition = mReadPosition.load(std::memory_order_seq_cst);
+            return endPosition - mCachedReadPosition <= mCapacity;
+        });
+    }
+    mProducerWaiting.store(false, std::memory_order_release);
+}
+
+bool RingBufferCommandSerializer::ConsumeCommands(dawn::wire::CommandHandler* handler) {
+    uint64_t writePosition = mWritePosition.load(std::memory_order_acquire);
+    uint64_t readPosition = mReadPosition.load(std::memory_order_relaxed);
+
+    while (readPosition != writePosition) {
+        size_t offset = readPosition & (mCapacity - 1);
+        size_t tail = mCapacity - offset;
+
+        uint64_t size = kWrapMarker;
+        if (tail >= kHeaderSize) {
+            memcpy(&size, mData + offset, sizeof(size));
+        }
+
+        if (size == kWrapMarker) {
+            readPosition += tail;
+        } else {
+            ASSERT(kHeaderSize + size <= tail);
+            if (!mFailed.load(std::memory_order_relaxed) &&
+                handler->HandleCommands(mData + offset + kHeaderSize, size) == nullptr) {
+                mFailed.store(true, std::memory_order_release);
+            }
+            readPosition += kHeaderSize + size;
+        }
+
+        // Free the space of each batch as soon as possible in case the producer waits for it.
+        mReadPosition.store(readPosition, std::memory_order_seq_cst);
+        if (mProducerWaiting.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mSpaceCondition.notify_one();
+        }
+    }
+
+    return !mFailed.load(std::memory_order_relaxed);
+}
+
+bool RingBufferCommandSerializer::WaitForCommands() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mConsumerWaiting.store(true, std::memory_order_seq_cst);
+    mCommandsCondition.wait(lock, [this] { return mClosed || HasBatch(); });
+    mConsumerWaiting.store(false, std::memory_order_relaxed);
+    return !mClosed;
+}
+
+void RingBufferCommandSerializer::Close() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mClosed = true;
+    mCommandsCondition.notify_all();
+}
+
+bool RingBufferCommandSerializer::IsDrained() const {
+    return !HasBatch();
+}
+
+uint64_t RingBufferCommandSerializer::GetPublishedPosition() const {
+    return mWritePosition.load(std::memory_order_acquire);
+}
+
+uint64_t RingBufferCommandSerializer::GetConsumedPosition() const {
+    return mReadPosition.load(std::memory_order_acquire);
+}
+
+bool RingBufferCommandSerializer::IsProducerWaitingForSpace() const {
+    return mProducerWaiting.load(std::memory_order_acquire);
+}
+
+void RingBufferCommandSerializer::SetProducerWaitingCallback(std::function<void()> callback) {
+    mProducerWaitingCallback = std::move(callback);
+}
+
+bool RingBufferCommandSerializer::HasBatch() const {
+    return mWritePosition.load(std::memory_order_seq_cst) !=
+           mReadPosition.load(std::memory_order_acquire);
+}
+
+}  // namespace utils
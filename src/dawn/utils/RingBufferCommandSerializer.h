@@ -0,0 +1,110 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_RINGBUFFERCOMMANDSERIALIZER_H_
+#define SRC_DAWN_UTILS_RINGBUFFERCOMMANDSERIALIZER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "dawn/wire/Wire.h"
+
+namespace utils {
+
+// A CommandSerializer transporting commands from one producer thread to one consumer thread
+// through a lock-free ring buffer.
+//
+// The producer serializes commands in a batch that is published to the consumer on Flush(), or
+// earlier when the batch doesn't fit in the ring anymore. When the ring is full, the producer
+// blocks until the consumer frees space. The consumer passes the published batches to a
+// CommandHandler with ConsumeCommands(), and can block until batches are published with
+// WaitForCommands().
+class RingBufferCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    static constexpr size_t kDefaultCapacity = 4 * 1024 * 1024;
+
+    // |capacity| is rounded up to a power of two.
+    explicit RingBufferCommandSerializer(size_t capacity = kDefaultCapacity);
+    ~RingBufferCommandSerializer() override;
+
+    // Producer side.
+    size_t GetMaximumAllocationSize() const override;
+    void* GetCmdSpace(size_t size) override;
+    // Publishes the current batch. Returns false if the consumer failed to handle a batch.
+    bool Flush() override;
+
+    // Consumer side.
+    // Passes all the published batches to |handler|. Returns false if the handler failed on any
+    // of them, after which the remaining batches are skipped.
+    bool ConsumeCommands(dawn::wire::CommandHandler* handler);
+    // Blocks until batches are published. Returns false once Close() is called.
+    bool WaitForCommands();
+    // Makes WaitForCommands() return false on the consumer thread.
+    void Close();
+
+    // Returns true if all the published batches were consumed.
+    bool IsDrained() const;
+    // Returns the position up to which batches are published. Positions only increase, so the
+    // consumer has handled the batches published so far once its consumed position reaches it.
+    uint64_t GetPublishedPosition() const;
+    // Returns the position up to which batches are consumed.
+    uint64_t GetConsumedPosition() const;
+    // Returns true if the producer is waiting for the consumer to free space.
+    bool IsProducerWaitingForSpace() const;
+    // Sets a function that the producer calls when it starts waiting for space, after which
+    // IsProducerWaitingForSpace() returns true. Lets a consumer that blocks on something else
+    // wake up to free space. Must be set before the producer starts.
+    void SetProducerWaitingCallback(std::function<void()> callback);
+
+  private:
+    bool HasBatch() const;
+    void OpenBatch(size_t size);
+    void Publish(uint64_t position);
+    void WaitForSpace(uint64_t endPosition);
+
+    const size_t mCapacity;
+    std::unique_ptr<uint64_t[]> mStorage;
+    char* mData;
+
+    // Position up to which data is published, written by the producer.
+    alignas(64) std::atomic<uint64_t> mWritePosition{0};
+    // Position up to which data is consumed, written by the consumer.
+    alignas(64) std::atomic<uint64_t> mReadPosition{0};
+
+    // State only accessed by the producer.
+    alignas(64) uint64_t mBatchStart = 0;
+    uint64_t mAllocationPosition = 0;
+    uint64_t mCachedReadPosition = 0;
+    bool mHasOpenBatch = false;
+
+    std::atomic<bool> mFailed{false};
+
+    // Only used to put the consumer to sleep when there is nothing to consume, and the producer
+    // when there is no space left.
+    std::atomic<bool> mConsumerWaiting{false};
+    std::atomic<bool> mProducerWaiting{false};
+    std::function<void()> mProducerWaitingCallback;
+    bool mClosed = false;
+    std::mutex mMutex;
+    std::condition_variable mCommandsCondition;
+    std::condition_variable mSpaceCondition;
+};
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_RINGBUFFERCOMMANDSERIALIZER_H_
@@ -0,0 +1,287 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/WireCapture.h"
+
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Log.h"
+#include "dawn/wire/WireServer.h"
+
+namespace utils {
+
+namespace {
+
+constexpr char kMagic[8] = {'D', 'A', 'W', 'N', 'W', 'C', 'A', 'P'};
+constexpr uint32_t kVersion = 1;
+
+struct RecordHeader {
+    WireCaptureRecordType type;
+    uint32_t padding = 0;
+    uint64_t size;
+};
+
+// Discards the commands sent back by the server during a replay.
+class DiscardingCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    size_t GetMaximumAllocationSize() const override { return 1024 * 1024 * 1024; }
+    void* GetCmdSpace(size_t size) override {
+        if (size > mBuffer.size()) {
+            mBuffer.resize(size);
+        }
+        return mBuffer.data();
+    }
+    bool Flush() override { return true; }
+
+  private:
+    std::vector<char> mBuffer;
+};
+
+bool ReplayClientCommands(dawn::wire::WireServer* wireServer,
+                          const std::vector<char>& data,
+                          WireReplayObserver* observer) {
+    const volatile char* commands = data.data();
+    size_t remaining = data.size();
+    dawn::wire::CommandInfo info;
+    while (remaining > 0 && dawn::wire::GetClientCommandInfo(commands, remaining, &info)) {
+        if (info.size > remaining || info.name == nullptr) {
+            dawn::ErrorLog() << "Invalid command in the wire capture.";
+            return false;
+        }
+
+        observer->OnCommandBegin();
+        auto start = std::chrono::steady_clock::now();
+        const volatile char* result = wireServer->HandleCommands(
+            const_cast<const char*>(commands), static_cast<size_t>(info.size));
+        auto duration = std::chrono::steady_clock::now() - start;
+        if (result == nullptr) {
+            dawn::ErrorLog() << "The wire server failed to handle a " << info.name << " command.";
+            return false;
+        }
+        observer->OnCommandEnd(info.name, duration);
+
+        commands += info.size;
+        remaining -= info.size;
+    }
+    return true;
+}
+
+}  // anonymous namespace
+
+// WireCaptureWriter
+
+// static
+std::unique_ptr<WireCaptureWriter> WireCaptureWriter::Create(const char* path) {
+    auto stream = std::make_unique<std::ofstream>(
+        path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!stream->is_open()) {
+        return nullptr;
+    }
+    return std::make_unique<WireCaptureWriter>(std::move(stream));
+}
+
+WireCaptureWriter::WireCaptureWriter(std::unique_ptr<std::ostream> stream)
+    : mStream(std::move(stream)) {
+    mStream->write(kMagic, sizeof(kMagic));
+    mStream->write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+}
+
+WireCaptureWriter::~WireCaptureWriter() {
+    mStream->flush();
+}
+
+void WireCaptureWriter::WriteRecord(WireCaptureRecordType type, const void* data, size_t size) {
+    RecordHeader header;
+    header.type = type;
+    header.size = size;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStream->write(reinterpret_cast<const char*>(&header), sizeof(header));
+    mStream->write(static_cast<const char*>(data), size);
+}
+
+void WireCaptureWriter::WriteInjection(WireCaptureRecordType type,
+                                       uint32_t id,
+                                       uint32_t generation) {
+    ASSERT(type == WireCaptureRecordType::InjectInstance ||
+           type == WireCaptureRecordType::InjectDevice);
+    WireCaptureInjection injection = {id, generation};
+    WriteRecord(type, &injection, sizeof(injection));
+}
+
+// WireCaptureReader
+
+// static
+std::unique_ptr<WireCaptureReader> WireCaptureReader::Open(const char* path) {
+    auto stream =
+        std::make_unique<std::ifstream>(path, std::ios_base::in | std::ios_base::binary);
+    if (!stream->is_open()) {
+        return nullptr;
+    }
+    return Create(std::move(stream));
+}
+
+// static
+std::unique_ptr<WireCaptureReader> WireCaptureReader::Create(std::unique_ptr<std::istream> stream) {
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    stream->read(magic, sizeof(magic));
+    stream->read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!stream->good() || memcmp(magic, kMagic, sizeof(kMagic)) != 0 || version != kVersion) {
+        return nullptr;
+    }
+    return std::unique_ptr<WireCaptureReader>(new WireCaptureReader(std::move(stream)));
+}
+
+WireCaptureReader::WireCaptureReader(std::unique_ptr<std::istream> stream)
+    : mStream(std::move(stream)) {}
+
+WireCaptureReader::~WireCaptureReader() = default;
+
+bool WireCaptureReader::ReadRecord(WireCaptureRecordType* type, std::vector<char>* data) {
+    RecordHeader header;
+    mStream->read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (mStream->gcount() != sizeof(header)) {
+        return false;
+    }
+
+    data->resize(header.size);
+    mStream->read(data->data(), header.size);
+    if (static_cast<uint64_t>(mStream->gcount()) != header.size) {
+        return false;
+    }
+
+    *type = header.type;
+    return true;
+}
+
+// CaptureCommandSerializer
+
+CaptureCommandSerializer::CaptureCommandSerializer(dawn::wire::CommandSerializer* serializer,
+                                                   WireCaptureWriter* writer,
+                                                   WireCaptureRecordType type)
+    : mSerializer(serializer), mWriter(writer), mType(type) {}
+
+CaptureCommandSerializer::~CaptureCommandSerializer() = default;
+
+size_t CaptureCommandSerializer::GetMaximumAllocationSize() const {
+    return mSerializer->GetMaximumAllocationSize();
+}
+
+void* CaptureCommandSerializer::GetCmdSpace(size_t size) {
+    CapturePendingCommand();
+
+    void* space = mSerializer->GetCmdSpace(size);
+    if (space != nullptr) {
+        mPendingCommand = static_cast<char*>(space);
+        mPendingCommandSize = size;
+    }
+    return space;
+}
+
+bool CaptureCommandSerializer::Flush() {
+    CapturePendingCommand();
+    if (!mCapturedCommands.empty()) {
+        mWriter->WriteRecord(mType, mCapturedCommands.data(), mCapturedCommands.size());
+        mCapturedCommands.clear();
+    }
+    return mSerializer->Flush();
+}
+
+void CaptureCommandSerializer::CapturePendingCommand() {
+    if (mPendingCommand == nullptr) {
+        return;
+    }
+    mCapturedCommands.insert(mCapturedCommands.end(), mPendingCommand,
+                             mPendingCommand + mPendingCommandSize);
+    mPendingCommand = nullptr;
+}
+
+bool ReplayWireCapture(const std::vector<WireCaptureRecord>& records,
+                       const DawnProcTable& procs,
+                       WGPUInstance instance,
+                       const std::function<WGPUDevice()>& createDevice,
+                       WireReplayObserver* observer) {
+    DiscardingCommandSerializer serializer;
+    dawn::wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &procs;
+    serverDesc.serializer = &serializer;
+    auto wireServer = std::make_unique<dawn::wire::WireServer>(serverDesc);
+
+    std::vector<WGPUDevice> devices;
+    bool success = true;
+    for (const WireCaptureRecord& record : records) {
+        switch (record.type) {
+            case WireCaptureRecordType::InjectInstance:
+            case WireCaptureRecordType::InjectDevice: {
+                if (record.data.size() != sizeof(WireCaptureInjection)) {
+                    dawn::ErrorLog() << "Invalid injection record.";
+                    success = false;
+                    break;
+                }
+                WireCaptureInjection injection;
+                memcpy(&injection, record.data.data(), sizeof(injection));
+
+                if (record.type == WireCaptureRecordType::InjectInstance) {
+                    success =
+                        wireServer->InjectInstance(instance, injection.id, injection.generation);
+                } else {
+                    WGPUDevice device = createDevice();
+                    devices.push_back(device);
+                    success = device != nullptr && wireServer->InjectDevice(device, injection.id,
+                                                                            injection.generation);
+                }
+                if (!success) {
+                    dawn::ErrorLog() << "Couldn't inject object " << injection.id << ".";
+                }
+                break;
+            }
+
+            case WireCaptureRecordType::ClientCommands:
+                success = ReplayClientCommands(wireServer.get(), record.data, observer);
+                break;
+
+            case WireCaptureRecordType::ServerCommands:
+                // The data returned by the server is only needed to replay the client.
+                break;
+
+            default:
+                dawn::ErrorLog() << "Unknown wire capture record type "
+                                 << static_cast<uint32_t>(record.type) << ".";
+                success = false;
+                break;
+        }
+
+        if (!success) {
+            break;
+        }
+    }
+
+    // Flush remaining callbacks before destroying the server.
+    procs.instanceProcessEvents(instance);
+
+    // Note: Deleting the server will release all created objects.
+    wireServer = nullptr;
+    for (WGPUDevice device : devices) {
+        if (device != nullptr) {
+            procs.deviceRelease(device);
+        }
+    }
+    return success;
+}
+
+}  // namespace utils
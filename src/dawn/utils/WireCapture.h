@@ -0,0 +1,145 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_UTILS_WIRECAPTURE_H_
+#define SRC_DAWN_UTILS_WIRECAPTURE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "dawn/dawn_proc_table.h"
+#include "dawn/wire/Wire.h"
+
+namespace utils {
+
+// A wire capture is a header followed by a sequence of records, each made of a record type, the
+// size of its data and the data itself. Replaying the records of a capture in order through a
+// WireServer reproduces the calls of the client.
+enum class WireCaptureRecordType : uint32_t {
+    // Commands sent by the client to the server.
+    ClientCommands = 0,
+    // Commands sent by the server to the client. They contain the data of the buffers mapped for
+    // reading when using the inline memory transfer service.
+    ServerCommands = 1,
+    // The injection of an instance or a device in the server. The data is a
+    // WireCaptureInjection.
+    InjectInstance = 2,
+    InjectDevice = 3,
+};
+
+struct WireCaptureInjection {
+    uint32_t id;
+    uint32_t generation;
+};
+
+struct WireCaptureRecord {
+    WireCaptureRecordType type;
+    std::vector<char> data;
+};
+
+// Writes a wire capture. Thread-safe, so that the client and server commands can be captured from
+// different threads.
+class WireCaptureWriter {
+  public:
+    // Returns nullptr if the file can't be opened.
+    static std::unique_ptr<WireCaptureWriter> Create(const char* path);
+
+    explicit WireCaptureWriter(std::unique_ptr<std::ostream> stream);
+    ~WireCaptureWriter();
+
+    void WriteRecord(WireCaptureRecordType type, const void* data, size_t size);
+    void WriteInjection(WireCaptureRecordType type, uint32_t id, uint32_t generation);
+
+  private:
+    std::mutex mMutex;
+    std::unique_ptr<std::ostream> mStream;
+};
+
+// Reads a wire capture.
+class WireCaptureReader {
+  public:
+    // Returns nullptr if the file can't be opened or isn't a wire capture.
+    static std::unique_ptr<WireCaptureReader> Open(const char* path);
+    static std::unique_ptr<WireCaptureReader> Create(std::unique_ptr<std::istream> stream);
+
+    ~WireCaptureReader();
+
+    // Reads the next record into |type| and |data|. Returns false at the end of the capture, or
+    // if the capture is truncated.
+    bool ReadRecord(WireCaptureRecordType* type, std::vector<char>* data);
+
+  private:
+    explicit WireCaptureReader(std::unique_ptr<std::istream> stream);
+
+    std::unique_ptr<std::istream> mStream;
+};
+
+// A CommandSerializer forwarding the commands to another CommandSerializer, and writing them to a
+// wire capture as a record of |type| when they are flushed.
+class CaptureCommandSerializer : public dawn::wire::CommandSerializer {
+  public:
+    CaptureCommandSerializer(dawn::wire::CommandSerializer* serializer,
+                             WireCaptureWriter* writer,
+                             WireCaptureRecordType type);
+    ~CaptureCommandSerializer() override;
+
+    size_t GetMaximumAllocationSize() const override;
+    void* GetCmdSpace(size_t size) override;
+    bool Flush() override;
+
+  private:
+    void CapturePendingCommand();
+
+    dawn::wire::CommandSerializer* mSerializer;
+    WireCaptureWriter* mWriter;
+    WireCaptureRecordType mType;
+
+    // The command is only serialized after GetCmdSpace returns, so it is captured on the next call
+    // to GetCmdSpace or Flush, while its space is still owned by the serializer.
+    char* mPendingCommand = nullptr;
+    size_t mPendingCommandSize = 0;
+    std::vector<char> mCapturedCommands;
+};
+
+// Observes the client commands handled by the wire server during a replay.
+class WireReplayObserver {
+  public:
+    virtual ~WireReplayObserver() = default;
+
+    // Called right before the wire server handles a client command, so that the observer can
+    // start measuring it.
+    virtual void OnCommandBegin() {}
+    // Called after the wire server handled a client command with the name of the command and the
+    // time spent handling it.
+    virtual void OnCommandEnd(const char* name, std::chrono::nanoseconds duration) = 0;
+};
+
+// Replays |records| through a new WireServer using |procs|. The injected instances are replaced by
+// |instance| and the injected devices by the devices returned by |createDevice|, which are
+// released at the end of the replay. The server commands are skipped. Returns false and logs an
+// error if a record couldn't be replayed.
+bool ReplayWireCapture(const std::vector<WireCaptureRecord>& records,
+                       const DawnProcTable& procs,
+                       WGPUInstance instance,
+                       const std::function<WGPUDevice()>& createDevice,
+                       WireReplayObserver* observer);
+
+}  // namespace utils
+
+#endif  // SRC_DAWN_UTILS_WIRECAPTURE_H_
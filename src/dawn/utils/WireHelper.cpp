@@ -13,18 +13,23 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Log.h"
 #include "dawn/common/SystemUtils.h"
 #include "dawn/dawn_proc.h"
 #include "dawn/native/DawnNative.h"
+#include "dawn/utils/RingBufferCommandSerializer.h"
 #include "dawn/utils/TerribleCommandBuffer.h"
 #include "dawn/utils/WireHelper.h"
 #include "dawn/wire/WireClient.h"
@@ -145,13 +150,131 @@ class WireHelperProxy : public WireHelper {
     std::unique_ptr<dawn::wire::WireClient> mWireClient;
 };
 
+// Runs the wire server on its own thread, with the commands going through ring buffers. The
+// client still flushes synchronously: FlushClient waits for the server to handle the commands,
+// and the server-to-client commands are only handled in FlushServer, so that tests see the same
+// ordering as with WireHelperProxy.
+class WireHelperThreadedProxy : public WireHelper {
+  public:
+    explicit WireHelperThreadedProxy(const char* wireTraceDir, const DawnProcTable& procs) {
+        mC2sBuf = std::make_unique<utils::RingBufferCommandSerializer>();
+        mS2cBuf = std::make_unique<utils::RingBufferCommandSerializer>();
+        // Wake up FlushClient when the server blocks on the server-to-client commands.
+        mS2cBuf->SetProducerWaitingCallback([this]() {
+            std::lock_guard<std::mutex> lock(mServerProgressMutex);
+            mServerProgressCondition.notify_one();
+        });
+
+        dawn::wire::WireServerDescriptor serverDesc = {};
+        serverDesc.procs = &procs;
+        serverDesc.serializer = mS2cBuf.get();
+
+        mWireServer.reset(new dawn::wire::WireServer(serverDesc));
+        dawn::wire::CommandHandler* serverHandler = mWireServer.get();
+
+        if (wireTraceDir != nullptr && strlen(wireTraceDir) > 0) {
+            mWireServerTraceLayer.reset(new WireServerTraceLayer(wireTraceDir, mWireServer.get()));
+            serverHandler = mWireServerTraceLayer.get();
+        }
+
+        dawn::wire::WireClientDescriptor clientDesc = {};
+        clientDesc.serializer = mC2sBuf.get();
+
+        mWireClient.reset(new dawn::wire::WireClient(clientDesc));
+        dawnProcSetProcs(&dawn::wire::client::GetProcs());
+
+        mServerThread = std::thread([this, serverHandler]() {
+            while (mC2sBuf->WaitForCommands()) {
+                mC2sBuf->ConsumeCommands(serverHandler);
+                uint64_t handledPosition = mC2sBuf->GetConsumedPosition();
+                // Only report the commands as handled once their replies are published, so that
+                // the FlushServer following FlushClient sees them.
+                mS2cBuf->Flush();
+                std::lock_guard<std::mutex> lock(mServerProgressMutex);
+                mHandledPosition.store(handledPosition, std::memory_order_release);
+                mServerProgressCondition.notify_one();
+            }
+        });
+    }
+
+    ~WireHelperThreadedProxy() override {
+        mC2sBuf->Close();
+        mServerThread.join();
+    }
+
+    wgpu::Instance RegisterInstance(WGPUInstance backendInstance) override {
+        ASSERT(backendInstance != nullptr);
+
+        // The server thread only touches the server when handling commands, and the client
+        // doesn't know of the instance before the reservation, so the server is idle here.
+        auto reservation = mWireClient->ReserveInstance();
+        mWireServer->InjectInstance(backendInstance, reservation.id, reservation.generation);
+
+        return wgpu::Instance::Acquire(reservation.instance);
+    }
+
+    void BeginWireTrace(const char* name) override {
+        if (mWireServerTraceLayer) {
+            return mWireServerTraceLayer->BeginWireTrace(name);
+        }
+    }
+
+    bool FlushClient() override {
+        bool success = true;
+        mC2sBuf->Flush();
+        uint64_t publishedPosition = mC2sBuf->GetPublishedPosition();
+        while (true) {
+            {
+                // The server is blocked on the server-to-client commands if it waits for space
+                // while some are left to consume. Otherwise it will make progress on its own.
+                std::unique_lock<std::mutex> lock(mServerProgressMutex);
+                mServerProgressCondition.wait(lock, [&] {
+                    return mHandledPosition.load(std::memory_order_acquire) >= publishedPosition ||
+                           (mS2cBuf->IsProducerWaitingForSpace() && !mS2cBuf->IsDrained());
+                });
+            }
+            if (mHandledPosition.load(std::memory_order_acquire) >= publishedPosition) {
+                break;
+            }
+            // Handle the server-to-client commands early since the server is blocked on them,
+            // like TerribleCommandBuffer does when it is full.
+            success &= mS2cBuf->ConsumeCommands(mWireClient.get());
+        }
+        // Flush again now that the server is done to know whether it failed on any command.
+        return mC2sBuf->Flush() && success;
+    }
+
+    bool FlushServer() override { return mS2cBuf->ConsumeCommands(mWireClient.get()); }
+
+  private:
+    std::unique_ptr<utils::RingBufferCommandSerializer> mC2sBuf;
+    std::unique_ptr<utils::RingBufferCommandSerializer> mS2cBuf;
+    std::unique_ptr<WireServerTraceLayer> mWireServerTraceLayer;
+    std::unique_ptr<dawn::wire::WireServer> mWireServer;
+    std::unique_ptr<dawn::wire::WireClient> mWireClient;
+    std::thread mServerThread;
+    // Position in |mC2sBuf| up to which the server handled the commands and published the replies.
+    std::atomic<uint64_t> mHandledPosition{0};
+    // Signaled when mHandledPosition changes or the server starts waiting for space in |mS2cBuf|.
+    std::mutex mServerProgressMutex;
+    std::condition_variable mServerProgressCondition;
+};
+
 }  // anonymous namespace
 
 std::unique_ptr<WireHelper> CreateWireHelper(const DawnProcTable& procs,
                                              bool useWire,
-                                             const char* wireTraceDir) {
+                                             const char* wireTraceDir,
+                                             WireTransport transport) {
     if (useWire) {
-        return std::unique_ptr<WireHelper>(new WireHelperProxy(wireTraceDir, procs));
+        switch (transport) {
+            case WireTransport::Synchronous:
+                return std::unique_ptr<WireHelper>(new WireHelperProxy(wireTraceDir, procs));
+            case WireTransport::ServerThread:
+                return std::unique_ptr<WireHelper>(
+                    new WireHelperThreadedProxy(wireTraceDir, procs));
+        }
+        UNREACHABLE();
     } else {
         return std::unique_ptr<WireHelper>(new WireHelperDirect(procs));
     }
@@ -41,9 +41,18 @@ class WireHelper {
     virtual bool FlushServer() = 0;
 };
 
-std::unique_ptr<WireHelper> CreateWireHelper(const DawnProcTable& procs,
-                                             bool useWire,
-                                             const char* wireTraceDir = nullptr);
+enum class WireTransport {
+    // The commands are handled synchronously on the thread flushing them.
+    Synchronous,
+    // The wire server runs on its own thread and receives the commands through a ring buffer.
+    ServerThread,
+};
+
+std::unique_ptr<WireHelper> CreateWireHelper(
+    const DawnProcTable& procs,
+    bool useWire,
+    const char* wireTraceDir = nullptr,
+    WireTransport transport = WireTransport::Synchronous);
 
 }  // namespace utils
 
@@ -16,6 +16,7 @@
 #define SRC_DAWN_WIRE_BUFFERCONSUMER_H_
 
 #include <cstddef>
+#include <vector>
 
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
@@ -64,11 +65,33 @@ class BufferConsumer {
     size_t mSize;
 };
 
+// A run of plain data that a SerializeBuffer in gather mode references instead of copying. It is
+// serialized before the byte at |offset| of the SerializeBuffer's memory, and takes |alignedSize|
+// bytes of the serialized command.
+struct GatheredData {
+    size_t offset;
+    const char* data;
+    size_t size;
+    size_t alignedSize;
+};
+
 class SerializeBuffer : public BufferConsumer<char> {
   public:
-    using BufferConsumer::BufferConsumer;
+    // In gather mode, when |gatheredData| isn't null, the data passed to NextData is appended to
+    // |gatheredData| instead of being copied, so |buffer| only needs to fit the rest.
+    SerializeBuffer(char* buffer, size_t size, std::vector<GatheredData>* gatheredData = nullptr)
+        : BufferConsumer(buffer, size), mStart(buffer), mGatheredData(gatheredData) {}
+
     using BufferConsumer::Next;
     using BufferConsumer::NextN;
+
+    // Serializes |count| elements of |data| that are only used as plain data.
+    template <typename T, typename N>
+    WireResult NextData(N count, const T* data);
+
+  private:
+    char* mStart;
+    std::vector<GatheredData>* mGatheredData;
 };
 
 class DeserializeBuffer : public BufferConsumer<const volatile char> {
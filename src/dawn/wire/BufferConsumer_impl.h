@@ -15,6 +15,7 @@
 #ifndef SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
 #define SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
 
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -64,6 +65,26 @@ WireResult BufferConsumer<BufferT>::NextN(N count, T** data) {
     return WireResult::Success;
 }
 
+template <typename T, typename N>
+WireResult SerializeBuffer::NextData(N count, const T* data) {
+    static_assert(std::is_trivially_copyable<T>::value, "NextData only serializes plain data.");
+
+    if (mGatheredData == nullptr) {
+        T* buffer;
+        WIRE_TRY(NextN(count, &buffer));
+        memcpy(buffer, data, sizeof(T) * count);
+        return WireResult::Success;
+    }
+
+    auto size = WireAlignSizeofN<T>(count);
+    if (!size) {
+        return WireResult::FatalError;
+    }
+    mGatheredData->push_back({static_cast<size_t>(Buffer() - mStart),
+                              reinterpret_cast<const char*>(data), sizeof(T) * count, *size});
+    return WireResult::Success;
+}
+
 }  // namespace dawn::wire
 
 #endif  // SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
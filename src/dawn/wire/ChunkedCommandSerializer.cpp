@@ -14,24 +14,73 @@
 
 #include "dawn/wire/ChunkedCommandSerializer.h"
 
+#include "dawn/common/Assert.h"
+
 namespace dawn::wire {
 
+namespace {
+
+// Copies successive runs of bytes in chunks of at most |maxChunkSize| bytes.
+class ChunkWriter {
+  public:
+    ChunkWriter(CommandSerializer* serializer, size_t maxChunkSize, size_t totalSize)
+        : mSerializer(serializer), mMaxChunkSize(maxChunkSize), mUnallocatedSize(totalSize) {}
+
+    bool Write(const char* data, size_t size) {
+        while (size > 0) {
+            if (mChunkRemainingSize == 0) {
+                size_t chunkSize = std::min(mUnallocatedSize, mMaxChunkSize);
+                mChunk = static_cast<char*>(mSerializer->GetCmdSpace(chunkSize));
+                if (mChunk == nullptr) {
+                    return false;
+                }
+                mChunkRemainingSize = chunkSize;
+                mUnallocatedSize -= chunkSize;
+            }
+
+            size_t copySize = std::min(size, mChunkRemainingSize);
+            memcpy(mChunk, data, copySize);
+            mChunk += copySize;
+            mChunkRemainingSize -= copySize;
+            data += copySize;
+            size -= copySize;
+        }
+        return true;
+    }
+
+  private:
+    CommandSerializer* mSerializer;
+    size_t mMaxChunkSize;
+    size_t mUnallocatedSize;
+    char* mChunk = nullptr;
+    size_t mChunkRemainingSize = 0;
+};
+
+}  // anonymous namespace
+
 ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer)
     : mSerializer(serializer), mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {}
 
-void ChunkedCommandSerializer::SerializeChunkedCommand(const char* allocatedBuffer,
-                                                       size_t remainingSize) {
-    while (remainingSize > 0) {
-        size_t chunkSize = std::min(remainingSize, mMaxAllocationSize);
-        void* dst = mSerializer->GetCmdSpace(chunkSize);
-        if (dst == nullptr) {
+void ChunkedCommandSerializer::SerializeChunkedCommand(
+    const char* allocatedBuffer,
+    size_t allocatedSize,
+    const std::vector<GatheredData>& gatheredData,
+    size_t commandSize) {
+    static constexpr char kPadding[kWireBufferAlignment] = {};
+
+    ChunkWriter writer(mSerializer, mMaxAllocationSize, commandSize);
+    size_t offset = 0;
+    for (const GatheredData& data : gatheredData) {
+        ASSERT(data.offset >= offset && data.offset <= allocatedSize);
+        ASSERT(data.alignedSize - data.size < kWireBufferAlignment);
+        if (!writer.Write(allocatedBuffer + offset, data.offset - offset) ||
+            !writer.Write(data.data, data.size) ||
+            !writer.Write(kPadding, data.alignedSize - data.size)) {
             return;
         }
-        memcpy(dst, allocatedBuffer, chunkSize);
-
-        allocatedBuffer += chunkSize;
-        remainingSize -= chunkSize;
+        offset = data.offset;
     }
+    writer.Write(allocatedBuffer + offset, allocatedSize - offset);
 }
 
 }  // namespace dawn::wire
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/common/Alloc.h"
 #include "dawn/common/Compiler.h"
@@ -114,21 +115,32 @@ class ChunkedCommandSerializer {
             return;
         }
 
-        auto cmdSpace = std::unique_ptr<char[]>(AllocNoThrow<char>(requiredSize));
+        // Commands too large for the serializer are serialized in a temporary buffer and then
+        // copied in chunks. Their data-only members are gathered instead of copied in the
+        // temporary buffer, so that they are only copied once, directly in the chunks.
+        size_t temporarySize = requiredSize - cmd.GetDataOnlySize();
+        auto cmdSpace = std::unique_ptr<char[]>(AllocNoThrow<char>(temporarySize));
         if (!cmdSpace) {
             return;
         }
-        SerializeBuffer serializeBuffer(cmdSpace.get(), requiredSize);
+        std::vector<GatheredData> gatheredData;
+        SerializeBuffer serializeBuffer(cmdSpace.get(), temporarySize, &gatheredData);
         WireResult rCmd = SerializeCmd(cmd, requiredSize, &serializeBuffer);
         WireResult rExts = detail::SerializeCommandExtension(&serializeBuffer, extensions...);
         if (DAWN_UNLIKELY(rCmd != WireResult::Success || rExts != WireResult::Success)) {
             mSerializer->OnSerializeError();
             return;
         }
-        SerializeChunkedCommand(cmdSpace.get(), requiredSize);
+        SerializeChunkedCommand(cmdSpace.get(), temporarySize - serializeBuffer.AvailableSize(),
+                                gatheredData, requiredSize);
     }
 
-    void SerializeChunkedCommand(const char* allocatedBuffer, size_t remainingSize);
+    // Copies in chunks the |commandSize| bytes of a command serialized in |allocatedBuffer| and
+    // |gatheredData|.
+    void SerializeChunkedCommand(const char* allocatedBuffer,
+                                 size_t allocatedSize,
+                                 const std::vector<GatheredData>& gatheredData,
+                                 size_t commandSize);
 
     CommandSerializer* mSerializer;
     size_t mMaxAllocationSize;
@@ -0,0 +1,121 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_PACKEDRENDERPASSCOMMANDS_H_
+#define SRC_DAWN_WIRE_PACKEDRENDERPASSCOMMANDS_H_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace dawn::wire {
+
+// The render pass encoder commands that the client records in a packed stream and sends to the
+// server in a single RenderPassEncoderExecutePackedCommands command, instead of one wire command
+// each. In the stream, each command is its PackedRenderPassCommand followed by its arguments in the
+// order of the API, without padding. Objects are referred to by their ObjectId.
+enum class PackedRenderPassCommand : uint32_t {
+    SetPipeline,
+    // Followed by the dynamic offset count and the dynamic offsets.
+    SetBindGroup,
+    SetVertexBuffer,
+    SetIndexBuffer,
+    Draw,
+    DrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    SetViewport,
+    SetScissorRect,
+    // The color is packed as four doubles.
+    SetBlendConstant,
+    SetStencilReference,
+};
+
+// Appends values to a packed stream of commands.
+class PackedCommandWriter {
+  public:
+    template <typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        size_t offset = mData.size();
+        mData.resize(offset + sizeof(T));
+        memcpy(mData.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void WriteArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (count == 0) {
+            return;
+        }
+        size_t offset = mData.size();
+        mData.resize(offset + count * sizeof(T));
+        memcpy(mData.data() + offset, values, count * sizeof(T));
+    }
+
+    const uint8_t* GetData() const { return mData.data(); }
+    size_t GetSize() const { return mData.size(); }
+    bool IsEmpty() const { return mData.empty(); }
+
+    // Clears the stream but keeps its storage for the next commands.
+    void Reset() { mData.clear(); }
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+// Reads values from a packed stream of commands. The stream comes from the client so reads fail
+// instead of going past its end.
+class PackedCommandReader {
+  public:
+    PackedCommandReader(const uint8_t* data, size_t size) : mData(data), mRemaining(size) {}
+
+    bool IsEmpty() const { return mRemaining == 0; }
+
+    template <typename T>
+    [[nodiscard]] bool Read(T* value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (mRemaining < sizeof(T)) {
+            return false;
+        }
+        memcpy(value, mData, sizeof(T));
+        mData += sizeof(T);
+        mRemaining -= sizeof(T);
+        return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool ReadArray(std::vector<T>* values, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (count > mRemaining / sizeof(T)) {
+            return false;
+        }
+        values->resize(count);
+        if (count != 0) {
+            memcpy(values->data(), mData, count * sizeof(T));
+        }
+        mData += count * sizeof(T);
+        mRemaining -= count * sizeof(T);
+        return true;
+    }
+
+  private:
+    const uint8_t* mData;
+    size_t mRemaining;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_PACKEDRENDERPASSCOMMANDS_H_
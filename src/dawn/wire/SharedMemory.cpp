@@ -0,0 +1,260 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/SharedMemory.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(LINUX)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if !defined(MFD_CLOEXEC)
+#define MFD_CLOEXEC 0x0001U
+#endif
+#if !defined(MFD_ALLOW_SEALING)
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+#if !defined(F_ADD_SEALS)
+#define F_ADD_SEALS (1024 + 9)
+#define F_GET_SEALS (1024 + 10)
+#define F_SEAL_SEAL 0x0001
+#define F_SEAL_SHRINK 0x0002
+#define F_SEAL_GROW 0x0004
+#endif
+#endif
+
+namespace dawn::wire {
+
+#if DAWN_PLATFORM_IS(LINUX)
+
+namespace {
+
+// Empty regions still get a page so that their data pointer is valid.
+size_t GetMappedSize(size_t size) {
+    return std::max(size, size_t(1));
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<SharedMemoryMapping> SharedMemoryMapping::Create(size_t size) {
+    // memfd_create is called through syscall since the libc wrapper is missing from older glibc
+    // and Android versions.
+    int fd = static_cast<int>(syscall(__NR_memfd_create, "dawn_wire_shared_memory",
+                                      MFD_CLOEXEC | MFD_ALLOW_SEALING));
+    if (fd < 0) {
+        return nullptr;
+    }
+    // Seal the size of the region so that the other process can't shrink it while it is mapped,
+    // which would make the accesses to the mapping fault.
+    if (ftruncate(fd, static_cast<off_t>(GetMappedSize(size))) != 0 ||
+        fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, GetMappedSize(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryMapping>(
+        new SharedMemoryMapping(fd, static_cast<uint8_t*>(data), size));
+}
+
+// static
+std::unique_ptr<SharedMemoryMapping> SharedMemoryMapping::Import(int fd, size_t size) {
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    // Check the size of the region is sealed and large enough, so that accessing the mapping
+    // doesn't fault even if the client tries to truncate the region.
+    int seals = fcntl(fd, F_GET_SEALS);
+    if (seals < 0 || (seals & (F_SEAL_SHRINK | F_SEAL_GROW)) != (F_SEAL_SHRINK | F_SEAL_GROW)) {
+        close(fd);
+        return nullptr;
+    }
+
+    struct stat fdStat;
+    if (fstat(fd, &fdStat) != 0 || !S_ISREG(fdStat.st_mode) || fdStat.st_size < 0 ||
+        static_cast<uint64_t>(fdStat.st_size) < GetMappedSize(size)) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, GetMappedSize(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps the region alive so the file descriptor isn't needed anymore.
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::unique_ptr<SharedMemoryMapping>(
+        new SharedMemoryMapping(-1, static_cast<uint8_t*>(data), size));
+}
+
+SharedMemoryMapping::~SharedMemoryMapping() {
+    munmap(mData, GetMappedSize(mSize));
+    if (mFd >= 0) {
+        close(mFd);
+    }
+}
+
+bool SendSharedMemoryFd(int socket, uint64_t id, int fd) {
+    if (socket < 0 || fd < 0) {
+        return false;
+    }
+
+    iovec payload;
+    payload.iov_base = &id;
+    payload.iov_len = sizeof(id);
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message = {};
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(header), &fd, sizeof(int));
+
+    ssize_t sent;
+    do {
+        sent = sendmsg(socket, &message, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    return sent == static_cast<ssize_t>(sizeof(id));
+}
+
+int ReceiveSharedMemoryFd(int socket, uint64_t* id) {
+    if (socket < 0) {
+        return -1;
+    }
+
+    while (true) {
+        uint64_t receivedId = 0;
+        iovec payload;
+        payload.iov_base = &receivedId;
+        payload.iov_len = sizeof(receivedId);
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr message = {};
+        message.msg_iov = &payload;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        ssize_t received = recvmsg(socket, &message, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return -1;
+        }
+
+        // Only keep the file descriptors of well-formed messages, and close the others so that
+        // they don't leak.
+        int fd = -1;
+        for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr;
+             header = CMSG_NXTHDR(&message, header)) {
+            if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS) {
+                continue;
+            }
+            size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            for (size_t i = 0; i < count; ++i) {
+                int receivedFd;
+                memcpy(&receivedFd, CMSG_DATA(header) + i * sizeof(int), sizeof(int));
+                if (fd < 0) {
+                    fd = receivedFd;
+                } else {
+                    close(receivedFd);
+                }
+            }
+        }
+        bool wellFormed = received == static_cast<ssize_t>(sizeof(receivedId)) &&
+                          (message.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) == 0;
+        if (fd >= 0 && !wellFormed) {
+            close(fd);
+            fd = -1;
+        }
+        if (fd >= 0) {
+            *id = receivedId;
+            return fd;
+        }
+    }
+}
+
+void CloseSharedMemoryFd(int fd) {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+#else  // DAWN_PLATFORM_IS(LINUX)
+
+// static
+std::unique_ptr<SharedMemoryMapping> SharedMemoryMapping::Create(size_t size) {
+    return nullptr;
+}
+
+// static
+std::unique_ptr<SharedMemoryMapping> SharedMemoryMapping::Import(int fd, size_t size) {
+    return nullptr;
+}
+
+SharedMemoryMapping::~SharedMemoryMapping() {
+    UNREACHABLE();
+}
+
+bool SendSharedMemoryFd(int socket, uint64_t id, int fd) {
+    return false;
+}
+
+int ReceiveSharedMemoryFd(int socket, uint64_t* id) {
+    return -1;
+}
+
+void CloseSharedMemoryFd(int fd) {}
+
+#endif  // DAWN_PLATFORM_IS(LINUX)
+
+SharedMemoryMapping::SharedMemoryMapping(int fd, uint8_t* data, size_t size)
+    : mFd(fd), mData(data), mSize(size) {}
+
+uint8_t* SharedMemoryMapping::GetData() const {
+    return mData;
+}
+
+size_t SharedMemoryMapping::GetSize() const {
+    return mSize;
+}
+
+int SharedMemoryMapping::GetFd() const {
+    return mFd;
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,75 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_SHAREDMEMORY_H_
+#define SRC_DAWN_WIRE_SHAREDMEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "dawn/common/NonCopyable.h"
+
+namespace dawn::wire {
+
+// The data serialized by the client when creating a Read/WriteHandle of the shared memory
+// MemoryTransferService. The file descriptor of the region isn't part of the commands: it is sent
+// out of band on a Unix domain socket, tagged with |id|.
+struct SharedMemoryHandleCreateInfo {
+    uint64_t id;
+    uint64_t size;
+};
+
+// A memfd shared memory region mapped in the current process.
+class SharedMemoryMapping : public NonCopyable {
+  public:
+    // Creates and maps a new zero-initialized region of |size| bytes, with its size sealed.
+    // Returns nullptr on failure or if shared memory isn't supported on this platform.
+    static std::unique_ptr<SharedMemoryMapping> Create(size_t size);
+
+    // Maps the first |size| bytes of the region referenced by |fd|. Fails if the size of the
+    // region isn't sealed against shrinking and growing. Ownership of |fd| is taken even on
+    // failure, in which case nullptr is returned.
+    static std::unique_ptr<SharedMemoryMapping> Import(int fd, size_t size);
+
+    ~SharedMemoryMapping();
+
+    uint8_t* GetData() const;
+    size_t GetSize() const;
+
+    // Returns the file descriptor of the region, or -1 if it was closed after mapping.
+    int GetFd() const;
+
+  private:
+    SharedMemoryMapping(int fd, uint8_t* data, size_t size);
+
+    int mFd;
+    uint8_t* mData;
+    size_t mSize;
+};
+
+// Sends a copy of |fd| tagged with |id| on the Unix domain socket |socket| with SCM_RIGHTS.
+// Returns false on failure.
+bool SendSharedMemoryFd(int socket, uint64_t id, int fd);
+
+// Receives a file descriptor sent by SendSharedMemoryFd on |socket| without blocking. Returns the
+// file descriptor, owned by the caller, and sets |id|, or returns -1 if nothing was received.
+int ReceiveSharedMemoryFd(int socket, uint64_t* id);
+
+// Closes |fd| if it is a valid file descriptor.
+void CloseSharedMemoryFd(int fd);
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_SHAREDMEMORY_H_
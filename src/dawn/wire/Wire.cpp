@@ -14,6 +14,8 @@
 
 #include "dawn/wire/Wire.h"
 
+#include "dawn/wire/WireCmd_autogen.h"
+
 namespace dawn::wire {
 
 CommandSerializer::CommandSerializer() = default;
@@ -24,4 +26,14 @@ void CommandSerializer::OnSerializeError() {}
 CommandHandler::CommandHandler() = default;
 CommandHandler::~CommandHandler() = default;
 
+bool GetClientCommandInfo(const volatile char* commands, size_t size, CommandInfo* info) {
+    if (size < sizeof(CmdHeader) + sizeof(WireCmd)) {
+        return false;
+    }
+    info->size = reinterpret_cast<const volatile CmdHeader*>(commands)->commandSize;
+    info->name = WireCmdAsString(
+        *reinterpret_cast<const volatile WireCmd*>(commands + sizeof(CmdHeader)));
+    return true;
+}
+
 }  // namespace dawn::wire
@@ -0,0 +1,151 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/WireClient.h"
+
+namespace dawn::wire::client {
+
+namespace {
+
+// Serializes the id under which the file descriptor of |memory| was sent to the server.
+void SerializeSharedMemory(uint64_t id, const SharedMemoryMapping& memory, void* serializePointer) {
+    SharedMemoryHandleCreateInfo info = {};
+    info.id = id;
+    info.size = memory.GetSize();
+    memcpy(serializePointer, &info, sizeof(info));
+}
+
+}  // anonymous namespace
+
+class SharedMemoryTransferService : public MemoryTransferService {
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        ReadHandleImpl(uint64_t id, std::unique_ptr<SharedMemoryMapping> memory)
+            : mId(id), mMemory(std::move(memory)) {}
+
+        ~ReadHandleImpl() override = default;
+
+        size_t SerializeCreateSize() override { return sizeof(SharedMemoryHandleCreateInfo); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SerializeSharedMemory(mId, *mMemory, serializePointer);
+        }
+
+        const void* GetData() override { return mMemory->GetData(); }
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The server copied the data directly in the shared memory.
+            if (deserializeSize != 0) {
+                return false;
+            }
+            return offset <= mMemory->GetSize() && size <= mMemory->GetSize() - offset;
+        }
+
+      private:
+        uint64_t mId;
+        std::unique_ptr<SharedMemoryMapping> mMemory;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        WriteHandleImpl(uint64_t id, std::unique_ptr<SharedMemoryMapping> memory)
+            : mId(id), mMemory(std::move(memory)) {}
+
+        ~WriteHandleImpl() override = default;
+
+        size_t SerializeCreateSize() override { return sizeof(SharedMemoryHandleCreateInfo); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SerializeSharedMemory(mId, *mMemory, serializePointer);
+        }
+
+        void* GetData() override { return mMemory->GetData(); }
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+            ASSERT(offset <= mMemory->GetSize());
+            ASSERT(size <= mMemory->GetSize() - offset);
+            // The server reads the data directly from the shared memory.
+            return 0;
+        }
+
+        void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {}
+
+      private:
+        uint64_t mId;
+        std::unique_ptr<SharedMemoryMapping> mMemory;
+    };
+
+  public:
+    explicit SharedMemoryTransferService(int socket) : mSocket(socket) {}
+    ~SharedMemoryTransferService() override { CloseSharedMemoryFd(mSocket); }
+
+    ReadHandle* CreateReadHandle(size_t size) override {
+        uint64_t id;
+        std::unique_ptr<SharedMemoryMapping> memory = CreateAndSendMemory(size, &id);
+        if (memory) {
+            return new ReadHandleImpl(id, std::move(memory));
+        }
+        return nullptr;
+    }
+
+    WriteHandle* CreateWriteHandle(size_t size) override {
+        // Newly created shared memory is zero-initialized.
+        uint64_t id;
+        std::unique_ptr<SharedMemoryMapping> memory = CreateAndSendMemory(size, &id);
+        if (memory) {
+            return new WriteHandleImpl(id, std::move(memory));
+        }
+        return nullptr;
+    }
+
+  private:
+    // Creates a region and sends its file descriptor to the server right away, so that it is
+    // received before the command referencing it, and stays valid even if the handle is
+    // destroyed before the commands are flushed.
+    std::unique_ptr<SharedMemoryMapping> CreateAndSendMemory(size_t size, uint64_t* id) {
+        std::unique_ptr<SharedMemoryMapping> memory = SharedMemoryMapping::Create(size);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        *id = mNextId++;
+        if (!SendSharedMemoryFd(mSocket, *id, memory->GetFd())) {
+            return nullptr;
+        }
+        return memory;
+    }
+
+    int mSocket;
+    uint64_t mNextId = 1;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(int socket) {
+    // Check that shared memory is supported before returning a service that would fail to
+    // create any handle.
+    if (socket < 0 || SharedMemoryMapping::Create(0) == nullptr) {
+        CloseSharedMemoryFd(socket);
+        return nullptr;
+    }
+    return std::make_unique<SharedMemoryTransferService>(socket);
+}
+
+}  // namespace dawn::wire::client
@@ -0,0 +1,263 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/client/RenderPassEncoder.h"
+
+#include "dawn/wire/client/ApiObjects.h"
+#include "dawn/wire/client/Client.h"
+
+namespace dawn::wire::client {
+
+namespace {
+
+// Bound the memory used by passes with a very large number of commands: the packed commands are
+// sent early once they reach this size.
+constexpr size_t kMaxPackedCommandsSize = 256 * 1024;
+
+}  // anonymous namespace
+
+RenderPassEncoder::~RenderPassEncoder() = default;
+
+void RenderPassEncoder::FlushPackedCommands() {
+    if (mPackedCommands.IsEmpty()) {
+        return;
+    }
+
+    Client* client = GetClient();
+
+    RenderPassEncoderExecutePackedCommandsCmd cmd;
+    cmd.renderPassEncoderId = GetWireId();
+    cmd.commands = mPackedCommands.GetData();
+    cmd.commandsSize = mPackedCommands.GetSize();
+    client->SerializeCommand(cmd);
+    mPackedCommands.Reset();
+
+    // The server no longer needs the objects once it has executed the commands, so they are
+    // released after them.
+    for (auto [object, type] : mReferencedObjects) {
+        if (object->Release()) {
+            DestroyObjectCmd destroyCmd;
+            destroyCmd.objectType = type;
+            destroyCmd.objectId = object->GetWireId();
+            client->SerializeCommand(destroyCmd);
+            client->Free(object, type);
+        }
+    }
+    mReferencedObjects.clear();
+}
+
+void RenderPassEncoder::SetPipeline(WGPURenderPipeline pipeline) {
+    if (pipeline == nullptr) {
+        RenderPassEncoderSetPipelineCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.pipeline = pipeline;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::SetPipeline);
+    WriteObject(FromAPI(pipeline), ObjectType::RenderPipeline);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetBindGroup(uint32_t groupIndex,
+                                     WGPUBindGroup group,
+                                     uint32_t dynamicOffsetCount,
+                                     const uint32_t* dynamicOffsets) {
+    if (group == nullptr) {
+        RenderPassEncoderSetBindGroupCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.groupIndex = groupIndex;
+        cmd.group = group;
+        cmd.dynamicOffsetCount = dynamicOffsetCount;
+        cmd.dynamicOffsets = dynamicOffsets;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::SetBindGroup);
+    mPackedCommands.Write(groupIndex);
+    WriteObject(FromAPI(group), ObjectType::BindGroup);
+    mPackedCommands.Write(dynamicOffsetCount);
+    mPackedCommands.WriteArray(dynamicOffsets, dynamicOffsetCount);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetVertexBuffer(uint32_t slot,
+                                        WGPUBuffer buffer,
+                                        uint64_t offset,
+                                        uint64_t size) {
+    if (buffer == nullptr) {
+        RenderPassEncoderSetVertexBufferCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.slot = slot;
+        cmd.buffer = buffer;
+        cmd.offset = offset;
+        cmd.size = size;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::SetVertexBuffer);
+    mPackedCommands.Write(slot);
+    WriteObject(FromAPI(buffer), ObjectType::Buffer);
+    mPackedCommands.Write(offset);
+    mPackedCommands.Write(size);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetIndexBuffer(WGPUBuffer buffer,
+                                       WGPUIndexFormat format,
+                                       uint64_t offset,
+                                       uint64_t size) {
+    if (buffer == nullptr) {
+        RenderPassEncoderSetIndexBufferCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.buffer = buffer;
+        cmd.format = format;
+        cmd.offset = offset;
+        cmd.size = size;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::SetIndexBuffer);
+    WriteObject(FromAPI(buffer), ObjectType::Buffer);
+    mPackedCommands.Write(static_cast<uint32_t>(format));
+    mPackedCommands.Write(offset);
+    mPackedCommands.Write(size);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::Draw(uint32_t vertexCount,
+                             uint32_t instanceCount,
+                             uint32_t firstVertex,
+                             uint32_t firstInstance) {
+    WriteCommand(PackedRenderPassCommand::Draw);
+    mPackedCommands.Write(vertexCount);
+    mPackedCommands.Write(instanceCount);
+    mPackedCommands.Write(firstVertex);
+    mPackedCommands.Write(firstInstance);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::DrawIndexed(uint32_t indexCount,
+                                    uint32_t instanceCount,
+                                    uint32_t firstIndex,
+                                    int32_t baseVertex,
+                                    uint32_t firstInstance) {
+    WriteCommand(PackedRenderPassCommand::DrawIndexed);
+    mPackedCommands.Write(indexCount);
+    mPackedCommands.Write(instanceCount);
+    mPackedCommands.Write(firstIndex);
+    mPackedCommands.Write(baseVertex);
+    mPackedCommands.Write(firstInstance);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::DrawIndirect(WGPUBuffer indirectBuffer, uint64_t indirectOffset) {
+    if (indirectBuffer == nullptr) {
+        RenderPassEncoderDrawIndirectCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.indirectBuffer = indirectBuffer;
+        cmd.indirectOffset = indirectOffset;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::DrawIndirect);
+    WriteObject(FromAPI(indirectBuffer), ObjectType::Buffer);
+    mPackedCommands.Write(indirectOffset);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::DrawIndexedIndirect(WGPUBuffer indirectBuffer, uint64_t indirectOffset) {
+    if (indirectBuffer == nullptr) {
+        RenderPassEncoderDrawIndexedIndirectCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.indirectBuffer = indirectBuffer;
+        cmd.indirectOffset = indirectOffset;
+        SerializeUnpackedCommand(cmd);
+        return;
+    }
+
+    WriteCommand(PackedRenderPassCommand::DrawIndexedIndirect);
+    WriteObject(FromAPI(indirectBuffer), ObjectType::Buffer);
+    mPackedCommands.Write(indirectOffset);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetViewport(float x,
+                                    float y,
+                                    float width,
+                                    float height,
+                                    float minDepth,
+                                    float maxDepth) {
+    WriteCommand(PackedRenderPassCommand::SetViewport);
+    mPackedCommands.Write(x);
+    mPackedCommands.Write(y);
+    mPackedCommands.Write(width);
+    mPackedCommands.Write(height);
+    mPackedCommands.Write(minDepth);
+    mPackedCommands.Write(maxDepth);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    WriteCommand(PackedRenderPassCommand::SetScissorRect);
+    mPackedCommands.Write(x);
+    mPackedCommands.Write(y);
+    mPackedCommands.Write(width);
+    mPackedCommands.Write(height);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetBlendConstant(const WGPUColor* color) {
+    WriteCommand(PackedRenderPassCommand::SetBlendConstant);
+    mPackedCommands.Write(color->r);
+    mPackedCommands.Write(color->g);
+    mPackedCommands.Write(color->b);
+    mPackedCommands.Write(color->a);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::SetStencilReference(uint32_t reference) {
+    WriteCommand(PackedRenderPassCommand::SetStencilReference);
+    mPackedCommands.Write(reference);
+    FlushIfFull();
+}
+
+void RenderPassEncoder::WriteCommand(PackedRenderPassCommand command) {
+    mPackedCommands.Write(command);
+}
+
+void RenderPassEncoder::WriteObject(ObjectBase* object, ObjectType type) {
+    object->Reference();
+    mReferencedObjects.emplace_back(object, type);
+    mPackedCommands.Write(object->GetWireId());
+}
+
+void RenderPassEncoder::FlushIfFull() {
+    if (mPackedCommands.GetSize() >= kMaxPackedCommandsSize) {
+        FlushPackedCommands();
+    }
+}
+
+template <typename Cmd>
+void RenderPassEncoder::SerializeUnpackedCommand(const Cmd& cmd) {
+    FlushPackedCommands();
+    GetClient()->SerializeCommand(cmd);
+}
+
+}  // namespace dawn::wire::client
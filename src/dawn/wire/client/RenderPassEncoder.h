@@ -0,0 +1,80 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+#define SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
+
+#include <utility>
+#include <vector>
+
+#include "dawn/webgpu.h"
+
+#include "dawn/wire/ObjectType_autogen.h"
+#include "dawn/wire/PackedRenderPassCommands.h"
+#include "dawn/wire/client/ObjectBase.h"
+
+namespace dawn::wire::client {
+
+// Records the state setting and draw commands in a packed stream that is sent to the server in a
+// single command when the pass ends, or before any other command of the pass. This removes the
+// per-command overhead of the wire for passes with many draws.
+class RenderPassEncoder final : public ObjectBase {
+  public:
+    using ObjectBase::ObjectBase;
+    ~RenderPassEncoder() override;
+
+    // Sends the packed commands recorded so far to the server.
+    void FlushPackedCommands();
+
+    // Dawn API
+    void SetPipeline(WGPURenderPipeline pipeline);
+    void SetBindGroup(uint32_t groupIndex,
+                      WGPUBindGroup group,
+                      uint32_t dynamicOffsetCount,
+                      const uint32_t* dynamicOffsets);
+    void SetVertexBuffer(uint32_t slot, WGPUBuffer buffer, uint64_t offset, uint64_t size);
+    void SetIndexBuffer(WGPUBuffer buffer, WGPUIndexFormat format, uint64_t offset, uint64_t size);
+    void Draw(uint32_t vertexCount,
+              uint32_t instanceCount,
+              uint32_t firstVertex,
+              uint32_t firstInstance);
+    void DrawIndexed(uint32_t indexCount,
+                     uint32_t instanceCount,
+                     uint32_t firstIndex,
+                     int32_t baseVertex,
+                     uint32_t firstInstance);
+    void DrawIndirect(WGPUBuffer indirectBuffer, uint64_t indirectOffset);
+    void DrawIndexedIndirect(WGPUBuffer indirectBuffer, uint64_t indirectOffset);
+    void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth);
+    void SetScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+    void SetBlendConstant(const WGPUColor* color);
+    void SetStencilReference(uint32_t reference);
+
+  private:
+    void WriteCommand(PackedRenderPassCommand command);
+    // Keeps |object| alive until the packed commands referring to it are sent.
+    void WriteObject(ObjectBase* object, ObjectType type);
+    void FlushIfFull();
+
+    // Sends |cmd| as its own wire command, for calls that can't be packed.
+    template <typename Cmd>
+    void SerializeUnpackedCommand(const Cmd& cmd);
+
+    PackedCommandWriter mPackedCommands;
+    std::vector<std::pair<ObjectBase*, ObjectType>> mReferencedObjects;
+};
+
+}  // namespace dawn::wire::client
+
+#endif  // SRC_DAWN_WIRE_CLIENT_RENDERPASSENCODER_H_
@@ -133,45 +133,53 @@ bool Server::DoDeviceCreateBuffer(ObjectId deviceId,
         return false;
     }
 
+    // Deserialize both handles before handling errors so that the transfer service gets to release
+    // whatever the client created for each of them.
+    bool handlesDeserialized = true;
     if (isWriteMode) {
         MemoryTransferService::WriteHandle* writeHandle = nullptr;
         // Deserialize metadata produced from the client to create a companion server handle.
-        if (!mMemoryTransferService->DeserializeWriteHandle(
+        if (mMemoryTransferService->DeserializeWriteHandle(
                 writeHandleCreateInfo, static_cast<size_t>(writeHandleCreateInfoLength),
                 &writeHandle)) {
-            return false;
-        }
-        ASSERT(writeHandle != nullptr);
-        resultData->writeHandle.reset(writeHandle);
-        writeHandle->SetDataLength(descriptor->size);
-
-        if (descriptor->mappedAtCreation) {
-            void* mapping = mProcs.bufferGetMappedRange(resultData->handle, 0, descriptor->size);
-            if (mapping == nullptr) {
-                // A zero mapping is used to indicate an allocation error of an error buffer.
-                // This is a valid case and isn't fatal. Remember the buffer is an error so as
-                // to skip subsequent mapping operations.
-                resultData->mapWriteState = BufferMapWriteState::MapError;
-                return true;
-            }
-            ASSERT(mapping != nullptr);
-            writeHandle->SetTarget(mapping);
-
-            resultData->mapWriteState = BufferMapWriteState::Mapped;
+            ASSERT(writeHandle != nullptr);
+            resultData->writeHandle.reset(writeHandle);
+            writeHandle->SetDataLength(descriptor->size);
+        } else {
+            handlesDeserialized = false;
         }
     }
 
     if (isReadMode) {
         MemoryTransferService::ReadHandle* readHandle = nullptr;
         // Deserialize metadata produced from the client to create a companion server handle.
-        if (!mMemoryTransferService->DeserializeReadHandle(
+        if (mMemoryTransferService->DeserializeReadHandle(
                 readHandleCreateInfo, static_cast<size_t>(readHandleCreateInfoLength),
                 &readHandle)) {
-            return false;
+            ASSERT(readHandle != nullptr);
+            resultData->readHandle.reset(readHandle);
+        } else {
+            handlesDeserialized = false;
+        }
+    }
+
+    if (!handlesDeserialized) {
+        return false;
+    }
+
+    if (descriptor->mappedAtCreation) {
+        void* mapping = mProcs.bufferGetMappedRange(resultData->handle, 0, descriptor->size);
+        if (mapping == nullptr) {
+            // A zero mapping is used to indicate an allocation error of an error buffer.
+            // This is a valid case and isn't fatal. Remember the buffer is an error so as
+            // to skip subsequent mapping operations.
+            resultData->mapWriteState = BufferMapWriteState::MapError;
+            return true;
         }
-        ASSERT(readHandle != nullptr);
+        ASSERT(mapping != nullptr);
+        resultData->writeHandle->SetTarget(mapping);
 
-        resultData->readHandle.reset(readHandle);
+        resultData->mapWriteState = BufferMapWriteState::Mapped;
     }
 
     return true;
@@ -0,0 +1,239 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+#include <vector>
+
+#include "dawn/wire/PackedRenderPassCommands.h"
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire::server {
+
+namespace {
+
+// Resolves object IDs, remembering the last object resolved. The client keeps the objects used by
+// packed commands alive until they are executed, so the object stays valid for the whole batch.
+template <typename T>
+class CachedObjectResolver {
+  public:
+    explicit CachedObjectResolver(const KnownObjects<T>& objects) : mObjects(objects) {}
+
+    [[nodiscard]] bool Resolve(ObjectId id, T* handle) {
+        if (id != mLastId || mLastHandle == nullptr) {
+            const auto* data = mObjects.Get(id);
+            if (data == nullptr) {
+                return false;
+            }
+            mLastId = id;
+            mLastHandle = data->handle;
+        }
+        *handle = mLastHandle;
+        return true;
+    }
+
+  private:
+    const KnownObjects<T>& mObjects;
+    ObjectId mLastId = 0;
+    T mLastHandle = nullptr;
+};
+
+}  // anonymous namespace
+
+bool Server::DoRenderPassEncoderExecutePackedCommands(ObjectId renderPassEncoderId,
+                                                      const uint8_t* commands,
+                                                      uint64_t commandsSize) {
+    auto* renderPassEncoder = RenderPassEncoderObjects().Get(renderPassEncoderId);
+    if (renderPassEncoder == nullptr) {
+        return false;
+    }
+
+    if (commandsSize > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+
+    WGPURenderPassEncoder pass = renderPassEncoder->handle;
+    PackedCommandReader reader(commands, static_cast<size_t>(commandsSize));
+    CachedObjectResolver<WGPURenderPipeline> pipelines(RenderPipelineObjects());
+    CachedObjectResolver<WGPUBindGroup> bindGroups(BindGroupObjects());
+    CachedObjectResolver<WGPUBuffer> buffers(BufferObjects());
+    std::vector<uint32_t> dynamicOffsets;
+
+    while (!reader.IsEmpty()) {
+        PackedRenderPassCommand command;
+        if (!reader.Read(&command)) {
+            return false;
+        }
+
+        switch (command) {
+            case PackedRenderPassCommand::SetPipeline: {
+                ObjectId pipelineId;
+                WGPURenderPipeline pipeline;
+                if (!reader.Read(&pipelineId) || !pipelines.Resolve(pipelineId, &pipeline)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetPipeline(pass, pipeline);
+                break;
+            }
+
+            case PackedRenderPassCommand::SetBindGroup: {
+                uint32_t groupIndex;
+                ObjectId groupId;
+                WGPUBindGroup group;
+                uint32_t dynamicOffsetCount;
+                if (!reader.Read(&groupIndex) || !reader.Read(&groupId) ||
+                    !bindGroups.Resolve(groupId, &group) || !reader.Read(&dynamicOffsetCount) ||
+                    !reader.ReadArray(&dynamicOffsets, dynamicOffsetCount)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetBindGroup(pass, groupIndex, group, dynamicOffsetCount,
+                                                     dynamicOffsets.data());
+                break;
+            }
+
+            case PackedRenderPassCommand::SetVertexBuffer: {
+                uint32_t slot;
+                ObjectId bufferId;
+                WGPUBuffer buffer;
+                uint64_t offset;
+                uint64_t size;
+                if (!reader.Read(&slot) || !reader.Read(&bufferId) ||
+                    !buffers.Resolve(bufferId, &buffer) || !reader.Read(&offset) ||
+                    !reader.Read(&size)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetVertexBuffer(pass, slot, buffer, offset, size);
+                break;
+            }
+
+            case PackedRenderPassCommand::SetIndexBuffer: {
+                ObjectId bufferId;
+                WGPUBuffer buffer;
+                uint32_t format;
+                uint64_t offset;
+                uint64_t size;
+                if (!reader.Read(&bufferId) || !buffers.Resolve(bufferId, &buffer) ||
+                    !reader.Read(&format) || !reader.Read(&offset) || !reader.Read(&size)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetIndexBuffer(
+                    pass, buffer, static_cast<WGPUIndexFormat>(format), offset, size);
+                break;
+            }
+
+            case PackedRenderPassCommand::Draw: {
+                uint32_t vertexCount;
+                uint32_t instanceCount;
+                uint32_t firstVertex;
+                uint32_t firstInstance;
+                if (!reader.Read(&vertexCount) || !reader.Read(&instanceCount) ||
+                    !reader.Read(&firstVertex) || !reader.Read(&firstInstance)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderDraw(pass, vertexCount, instanceCount, firstVertex,
+                                             firstInstance);
+                break;
+            }
+
+            case PackedRenderPassCommand::DrawIndexed: {
+                uint32_t indexCount;
+                uint32_t instanceCount;
+                uint32_t firstIndex;
+                int32_t baseVertex;
+                uint32_t firstInstance;
+                if (!reader.Read(&indexCount) || !reader.Read(&instanceCount) ||
+                    !reader.Read(&firstIndex) || !reader.Read(&baseVertex) ||
+                    !reader.Read(&firstInstance)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderDrawIndexed(pass, indexCount, instanceCount, firstIndex,
+                                                    baseVertex, firstInstance);
+                break;
+            }
+
+            case PackedRenderPassCommand::DrawIndirect:
+            case PackedRenderPassCommand::DrawIndexedIndirect: {
+                ObjectId indirectBufferId;
+                WGPUBuffer indirectBuffer;
+                uint64_t indirectOffset;
+                if (!reader.Read(&indirectBufferId) ||
+                    !buffers.Resolve(indirectBufferId, &indirectBuffer) ||
+                    !reader.Read(&indirectOffset)) {
+                    return false;
+                }
+                if (command == PackedRenderPassCommand::DrawIndirect) {
+                    mProcs.renderPassEncoderDrawIndirect(pass, indirectBuffer, indirectOffset);
+                } else {
+                    mProcs.renderPassEncoderDrawIndexedIndirect(pass, indirectBuffer,
+                                                                indirectOffset);
+                }
+                break;
+            }
+
+            case PackedRenderPassCommand::SetViewport: {
+                float x;
+                float y;
+                float width;
+                float height;
+                float minDepth;
+                float maxDepth;
+                if (!reader.Read(&x) || !reader.Read(&y) || !reader.Read(&width) ||
+                    !reader.Read(&height) || !reader.Read(&minDepth) || !reader.Read(&maxDepth)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetViewport(pass, x, y, width, height, minDepth,
+                                                    maxDepth);
+                break;
+            }
+
+            case PackedRenderPassCommand::SetScissorRect: {
+                uint32_t x;
+                uint32_t y;
+                uint32_t width;
+                uint32_t height;
+                if (!reader.Read(&x) || !reader.Read(&y) || !reader.Read(&width) ||
+                    !reader.Read(&height)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetScissorRect(pass, x, y, width, height);
+                break;
+            }
+
+            case PackedRenderPassCommand::SetBlendConstant: {
+                WGPUColor color;
+                if (!reader.Read(&color.r) || !reader.Read(&color.g) || !reader.Read(&color.b) ||
+                    !reader.Read(&color.a)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetBlendConstant(pass, &color);
+                break;
+            }
+
+            case PackedRenderPassCommand::SetStencilReference: {
+                uint32_t reference;
+                if (!reader.Read(&reference)) {
+                    return false;
+                }
+                mProcs.renderPassEncoderSetStencilReference(pass, reference);
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace dawn::wire::server
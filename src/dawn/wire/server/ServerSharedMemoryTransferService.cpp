@@ -0,0 +1,178 @@
+// Copyright 2023 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn::wire::server {
+
+namespace {
+
+// The maximum number of received file descriptors waiting for a command referencing them. It
+// bounds the number of file descriptors a misbehaving client can make the server hold.
+constexpr size_t kMaxPendingFds = 1024;
+
+}  // anonymous namespace
+
+class SharedMemoryTransferService : public MemoryTransferService {
+  public:
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        explicit ReadHandleImpl(std::unique_ptr<SharedMemoryMapping> memory)
+            : mMemory(std::move(memory)) {}
+        ~ReadHandleImpl() override = default;
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override { return 0; }
+
+        void SerializeDataUpdate(const void* data,
+                                 size_t offset,
+                                 size_t size,
+                                 void* serializePointer) override {
+            // Copy the data directly where the client reads it instead of in the command.
+            if (size > 0) {
+                ASSERT(data != nullptr);
+                ASSERT(offset <= mMemory->GetSize() && size <= mMemory->GetSize() - offset);
+                memcpy(mMemory->GetData() + offset, data, size);
+            }
+        }
+
+      private:
+        std::unique_ptr<SharedMemoryMapping> mMemory;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        explicit WriteHandleImpl(std::unique_ptr<SharedMemoryMapping> memory)
+            : mMemory(std::move(memory)) {}
+        ~WriteHandleImpl() override = default;
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The client wrote the data directly in the shared memory.
+            if (deserializeSize != 0 || mTargetData == nullptr) {
+                return false;
+            }
+            if (offset > mDataLength || size > mDataLength - offset ||
+                offset > mMemory->GetSize() || size > mMemory->GetSize() - offset) {
+                return false;
+            }
+            memcpy(static_cast<uint8_t*>(mTargetData) + offset, mMemory->GetData() + offset,
+                   size);
+            return true;
+        }
+
+      private:
+        std::unique_ptr<SharedMemoryMapping> mMemory;
+    };
+
+    explicit SharedMemoryTransferService(int socket) : mSocket(socket) {}
+    ~SharedMemoryTransferService() override {
+        for (const auto& pending : mPendingFds) {
+            CloseSharedMemoryFd(pending.second);
+        }
+        CloseSharedMemoryFd(mSocket);
+    }
+
+    bool DeserializeReadHandle(const void* deserializePointer,
+                               size_t deserializeSize,
+                               ReadHandle** readHandle) override {
+        ASSERT(readHandle != nullptr);
+        std::unique_ptr<SharedMemoryMapping> memory =
+            DeserializeSharedMemory(deserializePointer, deserializeSize);
+        if (memory == nullptr) {
+            return false;
+        }
+        *readHandle = new ReadHandleImpl(std::move(memory));
+        return true;
+    }
+
+    bool DeserializeWriteHandle(const void* deserializePointer,
+                                size_t deserializeSize,
+                                WriteHandle** writeHandle) override {
+        ASSERT(writeHandle != nullptr);
+        std::unique_ptr<SharedMemoryMapping> memory =
+            DeserializeSharedMemory(deserializePointer, deserializeSize);
+        if (memory == nullptr) {
+            return false;
+        }
+        *writeHandle = new WriteHandleImpl(std::move(memory));
+        return true;
+    }
+
+  private:
+    // Maps the shared memory referenced by the create info of a handle. Only file descriptors
+    // received on the socket are used, and each of them at most once.
+    std::unique_ptr<SharedMemoryMapping> DeserializeSharedMemory(const void* deserializePointer,
+                                                                 size_t deserializeSize) {
+        if (deserializeSize != sizeof(SharedMemoryHandleCreateInfo) ||
+            deserializePointer == nullptr) {
+            return nullptr;
+        }
+
+        SharedMemoryHandleCreateInfo info;
+        memcpy(&info, deserializePointer, sizeof(info));
+        int fd = TakeFd(info.id);
+        if (fd < 0) {
+            return nullptr;
+        }
+        if (info.size > std::numeric_limits<size_t>::max()) {
+            CloseSharedMemoryFd(fd);
+            return nullptr;
+        }
+        return SharedMemoryMapping::Import(fd, static_cast<size_t>(info.size));
+    }
+
+    // Returns the file descriptor received with |id| and removes it from the pending ones, or -1
+    // if it wasn't received. The client sends the file descriptor before the command referencing
+    // it, so it is already queued on the socket when the command is handled.
+    int TakeFd(uint64_t id) {
+        auto it = mPendingFds.find(id);
+        if (it == mPendingFds.end()) {
+            uint64_t receivedId;
+            int receivedFd;
+            while ((receivedFd = ReceiveSharedMemoryFd(mSocket, &receivedId)) >= 0) {
+                if (mPendingFds.size() >= kMaxPendingFds ||
+                    !mPendingFds.emplace(receivedId, receivedFd).second) {
+                    CloseSharedMemoryFd(receivedFd);
+                }
+            }
+            it = mPendingFds.find(id);
+            if (it == mPendingFds.end()) {
+                return -1;
+            }
+        }
+        int fd = it->second;
+        mPendingFds.erase(it);
+        return fd;
+    }
+
+    int mSocket;
+    // The file descriptors received on the socket that no command referenced yet, by id.
+    std::unordered_map<uint64_t, int> mPendingFds;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(int socket) {
+    return std::make_unique<SharedMemoryTransferService>(socket);
+}
+
+}  // namespace dawn::wire::server
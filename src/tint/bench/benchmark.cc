@@ -110,6 +110,12 @@ std::variant<ProgramAndFile, Error> LoadProgram(std::string name) {
     return ProgramAndFile{std::move(program), std::move(file)};
 }
 
+void ReportOutput(benchmark::State& state, size_t output_size, uint64_t allocations) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * output_size));
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
 }  // namespace tint::bench
 
 int main(int argc, char** argv) {
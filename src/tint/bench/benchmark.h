@@ -15,11 +15,13 @@
 #ifndef SRC_TINT_BENCH_BENCHMARK_H_
 #define SRC_TINT_BENCH_BENCHMARK_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <variant>
 
 #include "benchmark/benchmark.h"
+#include "src/tint/utils/allocation_counter.h"
 #include "src/tint/utils/concat.h"
 #include "tint/tint.h"
 
@@ -51,6 +53,16 @@ std::variant<Source::File, Error> LoadInputFile(std::string name);
 /// @returns either the loaded Program or an Error
 std::variant<ProgramAndFile, Error> LoadProgram(std::string name);
 
+/// ScopedAllocationCounter counts the allocations of the benchmarks that report them.
+using ScopedAllocationCounter = utils::ScopedAllocationCounter;
+
+/// ReportOutput reports the number of bytes output per second by a benchmark, and the average
+/// number of heap allocations made per iteration.
+/// @param state the benchmark state
+/// @param output_size the size in bytes of the output produced by each iteration
+/// @param allocations the number of heap allocations made by all the iterations
+void ReportOutput(benchmark::State& state, size_t output_size, uint64_t allocations);
+
 /// Declares a benchmark with the given function and WGSL file name
 #define TINT_BENCHMARK_WGSL_PROGRAM(FUNC, WGSL_NAME) BENCHMARK_CAPTURE(FUNC, WGSL_NAME, WGSL_NAME);
 
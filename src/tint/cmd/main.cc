@@ -58,7 +58,11 @@ namespace {
 
 /// Prints the given hash value in a format string that the end-to-end test runner can parse.
 void PrintHash(uint32_t hash) {
-    std::cout << "<<HASH: 0x" << std::hex << hash << ">>" << std::endl;
+    // Format the line first so that it is written at once when entry points are generated in
+    // parallel.
+    std::stringstream line;
+    line << "<<HASH: 0x" << std::hex << hash << ">>" << std::endl;
+    std::cout << line.str() << std::flush;
 }
 
 enum class Format {
@@ -93,6 +97,7 @@ struct Options {
 
     bool emit_single_entry_point = false;
     std::string ep_name;
+    bool parallel = false;
 
     bool rename_all = false;
 
@@ -131,6 +136,8 @@ const char kUsage[] = R"(Usage: tint [options] <input-file>
                                    .hlsl   -> hlsl
                                If none matches, then default to SPIR-V assembly.
   -ep <name>                -- Output single entry point
+  --parallel                -- Output each entry point separately, generating them in parallel.
+                               The output of entry point <name> is written to <output-file>.<name>
   --output-file <name>      -- Output file name.  Use "-" for standard output
   -o <name>                 -- Output file name.  Use "-" for standard output
   --transform <name list>   -- Runs transforms, name list is comma separated
@@ -319,6 +326,8 @@ bool ParseArgs(const std::vector<std::string>& args, Options* opts) {
             opts->ep_name = args[i];
             opts->emit_single_entry_point = true;
 
+        } else if (arg == "--parallel") {
+            opts->parallel = true;
         } else if (arg == "-o" || arg == "--output-name") {
             ++i;
             if (i >= args.size()) {
@@ -925,6 +934,72 @@ bool GenerateGlsl(const tint::Program* program, const Options& options) {
 #endif  // TINT_BUILD_GLSL_WRITER
 }
 
+/// Generate code for a program, in the format given by the options.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @returns true on success
+bool Generate(const tint::Program* program, const Options& options) {
+    switch (options.format) {
+        case Format::kSpirv:
+        case Format::kSpvAsm:
+            return GenerateSpirv(program, options);
+        case Format::kWgsl:
+            return GenerateWgsl(program, options);
+        case Format::kMsl:
+            return GenerateMsl(program, options);
+        case Format::kHlsl:
+            return GenerateHlsl(program, options);
+        case Format::kGlsl:
+            return GenerateGlsl(program, options);
+        case Format::kNone:
+            return false;
+        default:
+            std::cerr << "Unknown output format specified" << std::endl;
+            return false;
+    }
+}
+
+/// Generate code for each entry point of a program separately, on multiple threads.
+/// @param program the program to generate
+/// @param options the options that Tint was invoked with
+/// @returns true on success
+bool GenerateEntryPointsInParallel(const tint::Program* program, const Options& options) {
+    if (options.output_file.empty() || options.output_file == "-") {
+        std::cerr << "--parallel requires an output file" << std::endl;
+        return false;
+    }
+    if (options.validate) {
+        std::cerr << "--parallel cannot be used with --validate" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> entry_points;
+    tint::inspector::Inspector inspector(program);
+    for (auto& entry_point : inspector.GetEntryPoints()) {
+        entry_points.push_back(entry_point.name);
+    }
+
+    std::vector<int> succeeded(entry_points.size());
+    tint::writer::GenerateEntryPoints(
+        program, entry_points, [&](size_t index, const tint::Program& entry_point_program) {
+            if (!entry_point_program.IsValid()) {
+                std::cerr << "Failed to extract entry point " << entry_points[index] << ":\n"
+                          << entry_point_program.Diagnostics().str() << std::endl;
+                return;
+            }
+            Options entry_point_options = options;
+            entry_point_options.output_file = options.output_file + "." + entry_points[index];
+            succeeded[index] = Generate(&entry_point_program, entry_point_options);
+        });
+
+    for (int s : succeeded) {
+        if (!s) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace
 
 int main(int argc, const char** argv) {
@@ -1190,30 +1265,8 @@ int main(int argc, const char** argv) {
 
     *program = std::move(out.program);
 
-    bool success = false;
-    switch (options.format) {
-        case Format::kSpirv:
-        case Format::kSpvAsm:
-            success = GenerateSpirv(program.get(), options);
-            break;
-        case Format::kWgsl:
-            success = GenerateWgsl(program.get(), options);
-            break;
-        case Format::kMsl:
-            success = GenerateMsl(program.get(), options);
-            break;
-        case Format::kHlsl:
-            success = GenerateHlsl(program.get(), options);
-            break;
-        case Format::kGlsl:
-            success = GenerateGlsl(program.get(), options);
-            break;
-        case Format::kNone:
-            break;
-        default:
-            std::cerr << "Unknown output format specified" << std::endl;
-            return 1;
-    }
+    bool success = options.parallel ? GenerateEntryPointsInParallel(program.get(), options)
+                                    : Generate(program.get(), options);
     if (!success) {
         return 1;
     }
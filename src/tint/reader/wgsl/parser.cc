@@ -21,9 +21,23 @@
 namespace tint::reader::wgsl {
 
 Program Parse(Source::File const* file) {
+    return Parse(file, nullptr);
+}
+
+Program Parse(Source::File const* file, ParseStatistics* statistics) {
+    using Clock = std::chrono::steady_clock;
+
+    auto start = Clock::now();
     ParserImpl parser(file);
     parser.Parse();
-    return Program(std::move(parser.builder()));
+    auto parsed = Clock::now();
+    Program program(std::move(parser.builder()));
+
+    if (statistics != nullptr) {
+        statistics->parse_duration = parsed - start;
+        statistics->resolve_duration = Clock::now() - parsed;
+    }
+    return program;
 }
 
 }  // namespace tint::reader::wgsl
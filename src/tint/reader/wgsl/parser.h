@@ -15,6 +15,8 @@
 #ifndef SRC_TINT_READER_WGSL_PARSER_H_
 #define SRC_TINT_READER_WGSL_PARSER_H_
 
+#include <chrono>
+
 #include "src/tint/program.h"
 
 namespace tint::reader::wgsl {
@@ -27,6 +29,23 @@ namespace tint::reader::wgsl {
 /// @returns the parsed program
 Program Parse(Source::File const* file);
 
+/// ParseStatistics holds the time spent in the phases of Parse()
+struct ParseStatistics {
+    /// The time spent parsing the source into an AST
+    std::chrono::nanoseconds parse_duration{0};
+    /// The time spent building the Program from the AST, which includes the resolver
+    std::chrono::nanoseconds resolve_duration{0};
+};
+
+/// Parses the WGSL source, returning the parsed program.
+/// If the source fails to parse then the returned
+/// `program.Diagnostics.contains_errors()` will be true, and the
+/// `program.Diagnostics()` will describe the error.
+/// @param file the source file
+/// @param statistics if not null, receives the time spent in each phase of the parsing
+/// @returns the parsed program
+Program Parse(Source::File const* file, ParseStatistics* statistics);
+
 }  // namespace tint::reader::wgsl
 
 #endif  // SRC_TINT_READER_WGSL_PARSER_H_
@@ -15,10 +15,40 @@
 #include <string>
 
 #include "src/tint/bench/benchmark.h"
+#include "src/tint/reader/wgsl/lexer.h"
 
 namespace tint::reader::wgsl {
 namespace {
 
+/// Reports the number of tokens processed per second, and the memory used by the token list which
+/// the parser keeps for the whole file.
+void ReportTokens(benchmark::State& state, const Source::File& file) {
+    Lexer lexer(&file);
+    auto tokens = lexer.Lex();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * tokens.size()));
+    state.counters["tokens"] = static_cast<double>(tokens.size());
+    state.counters["token_bytes"] = benchmark::Counter(
+        static_cast<double>(tokens.capacity() * sizeof(Token)), benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024);
+}
+
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::LoadInputFile(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto& file = std::get<Source::File>(res);
+    for (auto _ : state) {
+        Lexer lexer(&file);
+        auto tokens = lexer.Lex();
+        benchmark::DoNotOptimize(tokens.data());
+    }
+    ReportTokens(state, file);
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(LexWGSL);
+
 void ParseWGSL(benchmark::State& state, std::string input_name) {
     auto res = bench::LoadInputFile(input_name);
     if (auto err = std::get_if<bench::Error>(&res)) {
@@ -32,6 +62,7 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
             state.SkipWithError(res.Diagnostics().str().c_str());
         }
     }
+    ReportTokens(state, file);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(ParseWGSL);
@@ -61,5 +61,24 @@ fn main() ->  {  // missing return type
 )");
 }
 
+TEST_F(ParserTest, Statistics) {
+    Source::File file("test.wgsl", R"(
+@fragment
+fn main() -> @location(0) vec4<f32> {
+  return vec4<f32>(.4, .2, .3, 1.);
+}
+)");
+    ParseStatistics statistics;
+    statistics.parse_duration = std::chrono::nanoseconds(-1);
+    statistics.resolve_duration = std::chrono::nanoseconds(-1);
+
+    auto program = Parse(&file, &statistics);
+    auto errs = diag::Formatter().format(program.Diagnostics());
+    ASSERT_TRUE(program.IsValid()) << errs;
+
+    EXPECT_GE(statistics.parse_duration.count(), 0);
+    EXPECT_GE(statistics.resolve_duration.count(), 0);
+}
+
 }  // namespace
 }  // namespace tint::reader::wgsl
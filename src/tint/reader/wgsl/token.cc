@@ -200,68 +200,104 @@ std::string_view Token::TypeToName(Type type) {
 
 Token::Token() : type_(Type::kUninitialized) {}
 
+Token::Token(Type type, const Source& source)
+    : file_(source.file),
+      begin_line_(static_cast<uint32_t>(source.range.begin.line)),
+      begin_column_(static_cast<uint32_t>(source.range.begin.column)),
+      end_line_(static_cast<uint32_t>(source.range.end.line)),
+      end_column_(static_cast<uint32_t>(source.range.end.column)),
+      type_(type) {}
+
 Token::Token(Type type, const Source& source, const std::string_view& view)
-    : type_(type), source_(source), value_(view) {}
+    : Token(type, source) {
+    value_.view = view.data();
+    view_length_ = static_cast<uint32_t>(view.size());
+    value_kind_ = ValueKind::kStringView;
+}
 
-Token::Token(Type type, const Source& source, const std::string& str)
-    : type_(type), source_(source), value_(str) {}
+Token::Token(Type type, const Source& source, const std::string& str) : Token(type, source) {
+    value_.owned = new std::string(str);
+    value_kind_ = ValueKind::kOwnedString;
+}
 
 Token::Token(Type type, const Source& source, const char* str)
-    : type_(type), source_(source), value_(std::string_view(str)) {}
+    : Token(type, source, std::string_view(str)) {}
 
-Token::Token(Type type, const Source& source, int64_t val)
-    : type_(type), source_(source), value_(val) {}
+Token::Token(Type type, const Source& source, int64_t val) : Token(type, source) {
+    value_.i64 = val;
+    value_kind_ = ValueKind::kI64;
+}
 
-Token::Token(Type type, const Source& source, double val)
-    : type_(type), source_(source), value_(val) {}
+Token::Token(Type type, const Source& source, double val) : Token(type, source) {
+    value_.f64 = val;
+    value_kind_ = ValueKind::kF64;
+}
 
-Token::Token(Type type, const Source& source) : type_(type), source_(source) {}
+Token::Token(Token&& other)
+    : file_(other.file_),
+      begin_line_(other.begin_line_),
+      begin_column_(other.begin_column_),
+      end_line_(other.end_line_),
+      end_column_(other.end_column_),
+      value_(other.value_),
+      view_length_(other.view_length_),
+      type_(other.type_),
+      value_kind_(other.value_kind_) {
+    other.value_kind_ = ValueKind::kNone;
+}
 
-Token::Token(Token&&) = default;
+Token::~Token() {
+    if (value_kind_ == ValueKind::kOwnedString) {
+        delete value_.owned;
+    }
+}
 
-Token::~Token() = default;
+std::string_view Token::str_view() const {
+    switch (value_kind_) {
+        case ValueKind::kStringView:
+            return std::string_view(value_.view, view_length_);
+        case ValueKind::kOwnedString:
+            return *value_.owned;
+        default:
+            return {};
+    }
+}
 
 bool Token::operator==(std::string_view ident) const {
     if (type_ != Type::kIdentifier) {
         return false;
     }
-    if (auto* view = std::get_if<std::string_view>(&value_)) {
-        return *view == ident;
-    }
-    return std::get<std::string>(value_) == ident;
+    return str_view() == ident;
 }
 
 std::string Token::to_str() const {
     switch (type_) {
         case Type::kFloatLiteral:
-            return std::to_string(std::get<double>(value_));
+            return std::to_string(value_.f64);
         case Type::kFloatLiteral_F:
-            return std::to_string(std::get<double>(value_)) + "f";
+            return std::to_string(value_.f64) + "f";
         case Type::kFloatLiteral_H:
-            return std::to_string(std::get<double>(value_)) + "h";
+            return std::to_string(value_.f64) + "h";
         case Type::kIntLiteral:
-            return std::to_string(std::get<int64_t>(value_));
+            return std::to_string(value_.i64);
         case Type::kIntLiteral_I:
-            return std::to_string(std::get<int64_t>(value_)) + "i";
+            return std::to_string(value_.i64) + "i";
         case Type::kIntLiteral_U:
-            return std::to_string(std::get<int64_t>(value_)) + "u";
+            return std::to_string(value_.i64) + "u";
         case Type::kIdentifier:
         case Type::kError:
-            if (auto* view = std::get_if<std::string_view>(&value_)) {
-                return std::string(*view);
-            }
-            return std::get<std::string>(value_);
+            return std::string(str_view());
         default:
             return "";
     }
 }
 
 double Token::to_f64() const {
-    return std::get<double>(value_);
+    return value_kind_ == ValueKind::kF64 ? value_.f64 : 0;
 }
 
 int64_t Token::to_i64() const {
-    return std::get<int64_t>(value_);
+    return value_kind_ == ValueKind::kI64 ? value_.i64 : 0;
 }
 
 }  // namespace tint::reader::wgsl
@@ -15,19 +15,22 @@
 #ifndef SRC_TINT_READER_WGSL_TOKEN_H_
 #define SRC_TINT_READER_WGSL_TOKEN_H_
 
+#include <cstdint>
 #include <string>
 #include <string_view>
-#include <variant>
 
 #include "src/tint/source.h"
 
 namespace tint::reader::wgsl {
 
-/// Stores tokens generated by the Lexer
+/// Stores tokens generated by the Lexer.
+/// Tokens are kept compact as the parser holds the tokens of the whole file at once: the source
+/// range is stored with 32-bit lines and columns, and string values are views into the source file
+/// content, except for error messages which are owned by the token.
 class Token {
   public:
     /// The type of the parsed token
-    enum class Type {
+    enum class Type : int8_t {
         /// Error result
         kError = -2,
         /// Uninitialized token
@@ -326,7 +329,9 @@ class Token {
     }
 
     /// @returns the source information for this token
-    Source source() const { return source_; }
+    Source source() const {
+        return Source{Source::Range{{begin_line_, begin_column_}, {end_line_, end_column_}}, file_};
+    }
 
     /// @returns the type of the token
     Type type() const { return type_; }
@@ -347,12 +352,38 @@ class Token {
     std::string_view to_name() const { return Token::TypeToName(type_); }
 
   private:
+    /// The kind of value held by the token
+    enum class ValueKind : uint8_t {
+        kNone,
+        kI64,
+        kF64,
+        kStringView,
+        kOwnedString,
+    };
+
+    /// @returns the string value of the token, or an empty string if it doesn't hold one
+    std::string_view str_view() const;
+
+    /// The file where the token appeared
+    const Source::File* file_ = nullptr;
+    /// The range where the token appeared
+    uint32_t begin_line_ = 0;
+    uint32_t begin_column_ = 0;
+    uint32_t end_line_ = 0;
+    uint32_t end_column_ = 0;
+    /// The value represented by the token, as indicated by `value_kind_`
+    union {
+        int64_t i64;
+        double f64;
+        const char* view;
+        std::string* owned;
+    } value_ = {};
+    /// The length of the string view held by `value_`
+    uint32_t view_length_ = 0;
     /// The Token::Type of the token
     Type type_ = Type::kError;
-    /// The source where the token appeared
-    Source source_;
-    /// The value represented by the token
-    std::variant<int64_t, double, std::string, std::string_view> value_;
+    /// The kind of value held by `value_`
+    ValueKind value_kind_ = ValueKind::kNone;
 };
 
 inline utils::StringStream& operator<<(utils::StringStream& out, Token::Type type) {
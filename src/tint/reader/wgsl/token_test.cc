@@ -15,6 +15,9 @@
 #include "src/tint/reader/wgsl/token.h"
 
 #include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -94,5 +97,24 @@ TEST_F(TokenTest, ToStr) {
     EXPECT_EQ(Token(Token::Type::kError, Source{}, "blah").to_str(), "blah");
 }
 
+TEST_F(TokenTest, OwnsErrorMessage) {
+    std::vector<Token> tokens;
+    {
+        std::string msg = "value cannot be represented as 'i32'";
+        tokens.emplace_back(Token(Token::Type::kError, Source{}, msg));
+        msg = "overwritten";
+    }
+    // Grow the vector to move the token.
+    for (int i = 0; i < 16; i++) {
+        tokens.emplace_back(Token(Token::Type::kComma, Source{}));
+    }
+    EXPECT_EQ(tokens[0].to_str(), "value cannot be represented as 'i32'");
+}
+
+TEST_F(TokenTest, Compact) {
+    // Tokens for the whole file are held in memory by the parser.
+    EXPECT_LE(sizeof(Token), 40u);
+}
+
 }  // namespace
 }  // namespace tint::reader::wgsl
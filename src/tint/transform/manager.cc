@@ -18,17 +18,48 @@
 /// before and after each transform. Helpful for debugging bad output.
 #define TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM 0
 
-#if TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
+/// If set to 1 then the transform::Manager will print the time spent in each
+/// transform, and whether the transform cloned the program, after running them.
+/// Helpful to find the transforms worth optimizing on a corpus of shaders.
+#define TINT_PRINT_TRANSFORM_STATISTICS 0
+
+#if TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM || TINT_PRINT_TRANSFORM_STATISTICS
 #include <iostream>
+#endif
+
+#if TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 #define TINT_IF_PRINT_PROGRAM(x) x
 #else  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 #define TINT_IF_PRINT_PROGRAM(x)
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Statistics);
 
 namespace tint::transform {
 
+Manager::Statistics::Statistics() = default;
+Manager::Statistics::Statistics(const Statistics&) = default;
+Manager::Statistics::~Statistics() = default;
+
+size_t Manager::Statistics::CloneCount() const {
+    size_t count = 0;
+    for (auto& entry : transforms) {
+        if (entry.cloned) {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::chrono::nanoseconds Manager::Statistics::TotalDuration() const {
+    std::chrono::nanoseconds duration{0};
+    for (auto& entry : transforms) {
+        duration += entry.duration;
+    }
+    return duration;
+}
+
 Manager::Manager() = default;
 Manager::~Manager() = default;
 
@@ -52,11 +83,21 @@ Transform::ApplyResult Manager::Apply(const Program* program,
 #endif
 
     std::optional<Program> output;
+    auto statistics = std::make_unique<Statistics>();
+    statistics->transforms.reserve(transforms_.size());
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", this));
 
     for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(program, inputs, outputs)) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = transform->Apply(program, inputs, outputs);
+        auto& entry = statistics->transforms.emplace_back();
+        entry.name = transform->TypeInfo().name;
+        entry.cloned = result.has_value();
+        entry.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+
+        if (result) {
             output.emplace(std::move(result.value()));
             program = &output.value();
 
@@ -74,6 +115,18 @@ Transform::ApplyResult Manager::Apply(const Program* program,
 
     TINT_IF_PRINT_PROGRAM(print_program("Final output of", this));
 
+#if TINT_PRINT_TRANSFORM_STATISTICS
+    for (auto& entry : statistics->transforms) {
+        std::cout << entry.name << ": " << (entry.cloned ? "cloned" : "skipped") << " in "
+                  << entry.duration.count() << "ns" << std::endl;
+    }
+    std::cout << "Total: " << statistics->CloneCount() << "/" << statistics->transforms.size()
+              << " transforms cloned the program in " << statistics->TotalDuration().count()
+              << "ns" << std::endl;
+#endif  // TINT_PRINT_TRANSFORM_STATISTICS
+
+    outputs.Put(std::move(statistics));
+
     return output;
 }
 
@@ -15,6 +15,7 @@
 #ifndef SRC_TINT_TRANSFORM_MANAGER_H_
 #define SRC_TINT_TRANSFORM_MANAGER_H_
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -29,6 +30,39 @@ namespace tint::transform {
 /// the error can be retrieved with the Output's diagnostics.
 class Manager final : public Castable<Manager, Transform> {
   public:
+    /// Statistics is outputted by the Manager.
+    /// Statistics holds the time spent in each of the inner transforms, and whether
+    /// they cloned the program or were skipped because they had nothing to do.
+    struct Statistics final : public Castable<Statistics, Data> {
+        /// The statistics of a single inner transform
+        struct Entry {
+            /// The name of the transform
+            const char* name = nullptr;
+            /// True if the transform produced a new program, false if it was skipped
+            bool cloned = false;
+            /// The time spent in the transform
+            std::chrono::nanoseconds duration{0};
+        };
+
+        /// Constructor
+        Statistics();
+
+        /// Copy constructor
+        Statistics(const Statistics&);
+
+        /// Destructor
+        ~Statistics() override;
+
+        /// @returns the number of transforms that cloned the program
+        size_t CloneCount() const;
+
+        /// @returns the total time spent in the transforms
+        std::chrono::nanoseconds TotalDuration() const;
+
+        /// The statistics of the transforms, in the order they were run
+        std::vector<Entry> transforms;
+    };
+
     /// Constructor
     Manager();
     ~Manager() override;
@@ -0,0 +1,68 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/transform/manager.h"
+
+#include <string>
+
+#include "src/tint/program_builder.h"
+#include "src/tint/transform/add_empty_entry_point.h"
+#include "src/tint/transform/pad_structs.h"
+#include "src/tint/transform/test_helper.h"
+
+namespace tint::transform {
+namespace {
+
+using ManagerTest = TransformTest;
+
+TEST_F(ManagerTest, StatisticsEmptyManager) {
+    ProgramBuilder b;
+    Program program(std::move(b));
+
+    Manager manager;
+    DataMap outputs;
+    EXPECT_FALSE(manager.Apply(&program, {}, outputs).has_value());
+
+    auto* statistics = outputs.Get<Manager::Statistics>();
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_TRUE(statistics->transforms.empty());
+    EXPECT_EQ(statistics->CloneCount(), 0u);
+}
+
+TEST_F(ManagerTest, StatisticsSkippedAndClonedTransforms) {
+    ProgramBuilder b;
+    Program program(std::move(b));
+
+    // PadStructs has nothing to do for an empty module, AddEmptyEntryPoint adds an entry point.
+    Manager manager;
+    manager.Add<PadStructs>();
+    manager.Add<AddEmptyEntryPoint>();
+    DataMap outputs;
+    auto result = manager.Apply(&program, {}, outputs);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->IsValid()) << result->Diagnostics().str();
+
+    auto* statistics = outputs.Get<Manager::Statistics>();
+    ASSERT_NE(statistics, nullptr);
+    ASSERT_EQ(statistics->transforms.size(), 2u);
+    EXPECT_EQ(std::string(statistics->transforms[0].name), "tint::transform::PadStructs");
+    EXPECT_FALSE(statistics->transforms[0].cloned);
+    EXPECT_EQ(std::string(statistics->transforms[1].name), "tint::transform::AddEmptyEntryPoint");
+    EXPECT_TRUE(statistics->transforms[1].cloned);
+    EXPECT_EQ(statistics->CloneCount(), 1u);
+    EXPECT_GE(statistics->TotalDuration(), statistics->transforms[1].duration);
+}
+
+}  // namespace
+}  // namespace tint::transform
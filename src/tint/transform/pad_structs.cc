@@ -48,6 +48,52 @@ void CreatePadding(utils::Vector<const ast::StructMember*, 8>* new_members,
     }
 }
 
+/// @returns true if the host-shareable structure @p str has implicit padding of at least one u32
+/// between or after its members. This must match the padding created by PadStructs::Apply().
+bool NeedsPadding(const sem::Struct* str) {
+    uint32_t offset = 0;
+    bool has_runtime_sized_array = false;
+    for (auto* mem : str->Members()) {
+        if (offset < mem->Offset()) {
+            if (mem->Offset() - offset >= 4u) {
+                return true;
+            }
+            offset = mem->Offset();
+        }
+
+        auto* ty = mem->Type();
+        uint32_t size = ty->Size();
+        if (ty->Is<sem::Struct>() && str->UsedAs(builtin::AddressSpace::kUniform)) {
+            size = utils::RoundUp(16u, size);
+        } else if (auto* array_ty = ty->As<type::Array>()) {
+            if (array_ty->Count()->Is<type::RuntimeArrayCount>()) {
+                has_runtime_sized_array = true;
+            }
+        }
+        offset += size;
+    }
+
+    uint32_t struct_size = str->Size();
+    if (str->UsedAs(builtin::AddressSpace::kUniform)) {
+        struct_size = utils::RoundUp(16u, struct_size);
+    }
+    return offset < struct_size && !has_runtime_sized_array && struct_size - offset >= 4u;
+}
+
+/// PadStructs only changes the host-shareable structures that need padding. Other structures
+/// would be rebuilt without any padding member, which is equivalent to the input.
+bool ShouldRun(const Program* program) {
+    for (auto* ty : program->AST().TypeDecls()) {
+        if (auto* ast_str = ty->As<ast::Struct>()) {
+            auto* str = program->Sem().Get(ast_str);
+            if (str && str->IsHostShareable() && NeedsPadding(str)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 PadStructs::PadStructs() = default;
@@ -55,6 +101,10 @@ PadStructs::PadStructs() = default;
 PadStructs::~PadStructs() = default;
 
 Transform::ApplyResult PadStructs::Apply(const Program* src, const DataMap&, DataMap&) const {
+    if (!ShouldRun(src)) {
+        return SkipTransform;
+    }
+
     ProgramBuilder b;
     CloneContext ctx{&b, src, /* auto_clone_symbols */ true};
     auto& sem = src->Sem();
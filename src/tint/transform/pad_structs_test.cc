@@ -34,6 +34,66 @@ TEST_F(PadStructsTest, EmptyModule) {
     EXPECT_EQ(expect, str(got));
 }
 
+TEST_F(PadStructsTest, ShouldRunEmptyModule) {
+    auto* src = R"()";
+
+    EXPECT_FALSE(ShouldRun<PadStructs>(src));
+}
+
+TEST_F(PadStructsTest, ShouldRunNoImplicitPadding) {
+    auto* src = R"(
+struct S {
+  x : i32,
+  y : f32,
+  z : vec2<f32>,
+}
+
+@group(0) @binding(0) var<storage, read_write> s : S;
+)";
+
+    EXPECT_FALSE(ShouldRun<PadStructs>(src));
+}
+
+TEST_F(PadStructsTest, ShouldRunPrivateOnly) {
+    auto* src = R"(
+struct S {
+  @size(12)
+  x : i32,
+  y : i32,
+}
+
+var<private> p : S;
+)";
+
+    EXPECT_FALSE(ShouldRun<PadStructs>(src));
+}
+
+TEST_F(PadStructsTest, ShouldRunPaddingBetweenMembers) {
+    auto* src = R"(
+struct S {
+  x : i32,
+  @align(16)
+  y : i32,
+}
+
+@group(0) @binding(0) var<storage, read_write> s : S;
+)";
+
+    EXPECT_TRUE(ShouldRun<PadStructs>(src));
+}
+
+TEST_F(PadStructsTest, ShouldRunPaddingAfterLastMember) {
+    auto* src = R"(
+struct S {
+  x : vec3<f32>,
+}
+
+@group(0) @binding(0) var<uniform> u : S;
+)";
+
+    EXPECT_TRUE(ShouldRun<PadStructs>(src));
+}
+
 TEST_F(PadStructsTest, Uniform) {
     auto* src = R"(
 struct S {
@@ -0,0 +1,57 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/utils/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace tint::utils {
+namespace {
+
+/// The allocation counter of the innermost ScopedAllocationCounter of the thread, if any.
+thread_local uint64_t* current_allocation_count = nullptr;
+
+}  // namespace
+
+ScopedAllocationCounter::ScopedAllocationCounter() : previous_(current_allocation_count) {
+    current_allocation_count = &count_;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter() {
+    current_allocation_count = previous_;
+}
+
+}  // namespace tint::utils
+
+// The global allocation functions are replaced so that ScopedAllocationCounter can count the
+// allocations of the code that measures them. The rest only pays for a thread-local load.
+// The array and nothrow forms of operator new call these ones.
+void* operator new(std::size_t size) {
+    if (uint64_t* count = tint::utils::current_allocation_count) {
+        ++*count;
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,46 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_UTILS_ALLOCATION_COUNTER_H_
+#define SRC_TINT_UTILS_ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+namespace tint::utils {
+
+/// ScopedAllocationCounter counts the heap allocations made with the global operator new by the
+/// current thread while it is the innermost ScopedAllocationCounter of the thread.
+/// @note allocation_counter.cc replaces the global operator new, so it must only be linked into the
+/// executables that measure their allocations: the tint benchmarks and dawn_wire_replay.
+class ScopedAllocationCounter {
+  public:
+    /// Constructor. Starts counting the allocations of the current thread.
+    ScopedAllocationCounter();
+    /// Destructor. Stops counting, and resumes the counting of the previous counter, if any.
+    ~ScopedAllocationCounter();
+
+    /// @returns the number of allocations counted so far
+    uint64_t Count() const { return count_; }
+
+  private:
+    ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+    ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+
+    uint64_t count_ = 0;
+    uint64_t* const previous_;
+};
+
+}  // namespace tint::utils
+
+#endif  // SRC_TINT_UTILS_ALLOCATION_COUNTER_H_
@@ -22,18 +22,22 @@
 #include "src/tint/debug.h"
 #include "src/tint/utils/hash.h"
 #include "src/tint/utils/hashmap_base.h"
+#include "src/tint/utils/swiss_hashmap_base.h"
 #include "src/tint/utils/vector.h"
 
 namespace tint::utils {
 
-/// An unordered map that uses a robin-hood hashing algorithm.
+/// An unordered map.
+/// By default the map uses the robin-hood hashing algorithm of HashmapBase. SwissHashmap uses the
+/// SIMD group probing of SwissHashmapBase instead, which has the same API.
 template <typename KEY,
           typename VALUE,
           size_t N,
           typename HASH = Hasher<KEY>,
-          typename EQUAL = std::equal_to<KEY>>
-class Hashmap : public HashmapBase<KEY, VALUE, N, HASH, EQUAL> {
-    using Base = HashmapBase<KEY, VALUE, N, HASH, EQUAL>;
+          typename EQUAL = std::equal_to<KEY>,
+          template <typename, typename, size_t, typename, typename> class BASE = HashmapBase>
+class Hashmap : public BASE<KEY, VALUE, N, HASH, EQUAL> {
+    using Base = BASE<KEY, VALUE, N, HASH, EQUAL>;
     using PutMode = typename Base::PutMode;
 
   public:
@@ -209,8 +213,14 @@ class Hashmap : public HashmapBase<KEY, VALUE, N, HASH, EQUAL> {
     /// Equality operator
     /// @param other the other Hashmap to compare this Hashmap to
     /// @returns true if this Hashmap has the same key and value pairs as @p other
-    template <typename K, typename V, size_t N2>
-    bool operator==(const Hashmap<K, V, N2>& other) const {
+    template <typename K,
+              typename V,
+              size_t N2,
+              typename H2,
+              typename E2,
+              template <typename, typename, size_t, typename, typename>
+              class B2>
+    bool operator==(const Hashmap<K, V, N2, H2, E2, B2>& other) const {
         if (this->Count() != other.Count()) {
             return false;
         }
@@ -226,8 +236,14 @@ class Hashmap : public HashmapBase<KEY, VALUE, N, HASH, EQUAL> {
     /// Inequality operator
     /// @param other the other Hashmap to compare this Hashmap to
     /// @returns false if this Hashmap has the same key and value pairs as @p other
-    template <typename K, typename V, size_t N2>
-    bool operator!=(const Hashmap<K, V, N2>& other) const {
+    template <typename K,
+              typename V,
+              size_t N2,
+              typename H2,
+              typename E2,
+              template <typename, typename, size_t, typename, typename>
+              class B2>
+    bool operator!=(const Hashmap<K, V, N2, H2, E2, B2>& other) const {
         return !(*this == other);
     }
 
@@ -247,12 +263,26 @@ class Hashmap : public HashmapBase<KEY, VALUE, N, HASH, EQUAL> {
     }
 };
 
+/// A Hashmap that uses SwissHashmapBase.
+template <typename KEY,
+          typename VALUE,
+          size_t N,
+          typename HASH = Hasher<KEY>,
+          typename EQUAL = std::equal_to<KEY>>
+using SwissHashmap = Hashmap<KEY, VALUE, N, HASH, EQUAL, SwissHashmapBase>;
+
 /// Hasher specialization for Hashmap
-template <typename K, typename V, size_t N, typename HASH, typename EQUAL>
-struct Hasher<Hashmap<K, V, N, HASH, EQUAL>> {
+template <typename K,
+          typename V,
+          size_t N,
+          typename HASH,
+          typename EQUAL,
+          template <typename, typename, size_t, typename, typename>
+          class BASE>
+struct Hasher<Hashmap<K, V, N, HASH, EQUAL, BASE>> {
     /// @param map the Hashmap to hash
     /// @returns a hash of the map
-    size_t operator()(const Hashmap<K, V, N, HASH, EQUAL>& map) const {
+    size_t operator()(const Hashmap<K, V, N, HASH, EQUAL, BASE>& map) const {
         auto hash = Hash(map.Count());
         for (auto it : map) {
             // Use an XOR to ensure that the non-deterministic ordering of the map still produces
@@ -0,0 +1,135 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/utils/hashmap.h"
+
+namespace tint::utils {
+namespace {
+
+/// Stands in for the AST nodes used as keys by the resolver and CloneContext maps.
+struct Node {
+    int payload[4];
+};
+
+/// A map from @p KEY to int using the @p BASE implementation.
+template <typename KEY, template <typename, typename, size_t, typename, typename> class BASE>
+using Map = Hashmap<KEY, int, 8, Hasher<KEY>, std::equal_to<KEY>, BASE>;
+
+/// Creates `count` nodes, allocated separately like AST nodes.
+std::vector<std::unique_ptr<Node>> MakeNodes(size_t count) {
+    std::vector<std::unique_ptr<Node>> nodes;
+    nodes.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        nodes.push_back(std::make_unique<Node>());
+    }
+    return nodes;
+}
+
+/// Adds `state.range(0)` pointer keys to the map.
+template <template <typename, typename, size_t, typename, typename> class BASE>
+void Add(::benchmark::State& state) {
+    auto nodes = MakeNodes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Map<const Node*, BASE> map;
+        for (auto& node : nodes) {
+            map.Add(node.get(), 1);
+        }
+        ::benchmark::DoNotOptimize(map.Count());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Looks up the `state.range(0)` pointer keys of the map in a random order, like the resolver
+/// looking up the resolved identifiers.
+template <template <typename, typename, size_t, typename, typename> class BASE>
+void LookupHit(::benchmark::State& state) {
+    auto nodes = MakeNodes(static_cast<size_t>(state.range(0)));
+    Map<const Node*, BASE> map;
+    std::vector<const Node*> keys;
+    for (auto& node : nodes) {
+        map.Add(node.get(), 1);
+        keys.push_back(node.get());
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937{});
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (auto* key : keys) {
+            sum += *map.Get(key);
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Looks up keys that are not in the map, like CloneContext looking up the replacements of nodes
+/// that are not replaced.
+template <template <typename, typename, size_t, typename, typename> class BASE>
+void LookupMiss(::benchmark::State& state) {
+    auto nodes = MakeNodes(static_cast<size_t>(state.range(0)));
+    auto others = MakeNodes(static_cast<size_t>(state.range(0)));
+    Map<const Node*, BASE> map;
+    for (auto& node : nodes) {
+        map.Add(node.get(), 1);
+    }
+
+    for (auto _ : state) {
+        size_t found = 0;
+        for (auto& other : others) {
+            found += map.Contains(other.get()) ? 1 : 0;
+        }
+        ::benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Looks up integer keys, like the Symbol keyed maps. Half of the keys are missing.
+template <template <typename, typename, size_t, typename, typename> class BASE>
+void LookupInt(::benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    Map<int, BASE> map;
+    for (int i = 0; i < count; i++) {
+        map.Add(i, i);
+    }
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (int i = 0; i < count * 2; i++) {
+            if (auto value = map.Get(i)) {
+                sum += *value;
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 2);
+}
+
+#define TINT_HASHMAP_BENCHMARK(FUNC)                                               \
+    BENCHMARK_TEMPLATE(FUNC, HashmapBase)->RangeMultiplier(8)->Range(8, 1 << 15); \
+    BENCHMARK_TEMPLATE(FUNC, SwissHashmapBase)->RangeMultiplier(8)->Range(8, 1 << 15)
+
+TINT_HASHMAP_BENCHMARK(Add);
+TINT_HASHMAP_BENCHMARK(LookupHit);
+TINT_HASHMAP_BENCHMARK(LookupMiss);
+TINT_HASHMAP_BENCHMARK(LookupInt);
+
+}  // namespace
+}  // namespace tint::utils
@@ -28,10 +28,16 @@
 
 namespace tint::utils {
 
-/// An unordered set that uses a robin-hood hashing algorithm.
-template <typename KEY, size_t N, typename HASH = Hasher<KEY>, typename EQUAL = std::equal_to<KEY>>
-class Hashset : public HashmapBase<KEY, void, N, HASH, EQUAL> {
-    using Base = HashmapBase<KEY, void, N, HASH, EQUAL>;
+/// An unordered set.
+/// By default the set uses the robin-hood hashing algorithm of HashmapBase. SwissHashset uses the
+/// SIMD group probing of SwissHashmapBase instead, which has the same API.
+template <typename KEY,
+          size_t N,
+          typename HASH = Hasher<KEY>,
+          typename EQUAL = std::equal_to<KEY>,
+          template <typename, typename, size_t, typename, typename> class BASE = HashmapBase>
+class Hashset : public BASE<KEY, void, N, HASH, EQUAL> {
+    using Base = BASE<KEY, void, N, HASH, EQUAL>;
     using PutMode = typename Base::PutMode;
 
   public:
@@ -57,6 +63,10 @@ class Hashset : public HashmapBase<KEY, void, N, HASH, EQUAL> {
     }
 };
 
+/// A Hashset that uses SwissHashmapBase.
+template <typename KEY, size_t N, typename HASH = Hasher<KEY>, typename EQUAL = std::equal_to<KEY>>
+using SwissHashset = Hashset<KEY, N, HASH, EQUAL, SwissHashmapBase>;
+
 }  // namespace tint::utils
 
 #endif  // SRC_TINT_UTILS_HASHSET_H_
@@ -0,0 +1,665 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_UTILS_SWISS_HASHMAP_BASE_H_
+#define SRC_TINT_UTILS_SWISS_HASHMAP_BASE_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "src/tint/debug.h"
+#include "src/tint/utils/hash.h"
+#include "src/tint/utils/hashmap_base.h"
+#include "src/tint/utils/math.h"
+#include "src/tint/utils/vector.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINT_SWISS_HASHMAP_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && defined(TINT_SWISS_HASHMAP_ENABLE_NEON)
+// The NEON group matcher is opt-in until an arm64 bot runs SwissHashmap.GroupMatch. Without it,
+// aarch64 uses the portable matcher.
+#define TINT_SWISS_HASHMAP_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace tint::utils {
+
+namespace detail {
+
+/// The control byte of an empty slot.
+static constexpr uint8_t kSwissCtrlEmpty = 0x80;
+
+/// The control byte of a slot whose entry was removed. Lookups continue past deleted slots.
+static constexpr uint8_t kSwissCtrlDeleted = 0xfe;
+
+/// The number of slots whose control bytes are compared at once.
+static constexpr size_t kSwissGroupWidth = 16;
+
+/// SwissBitMask is a set of slot indices within a group, returned by the SwissGroup matches.
+/// @tparam SHIFT the base-2 logarithm of the number of bits used for each slot.
+template <uint32_t SHIFT>
+class SwissBitMask {
+  public:
+    /// Constructor
+    /// @param bits the mask bits, with at most one bit set for each slot
+    explicit SwissBitMask(uint64_t bits) : bits_(bits) {}
+
+    /// @returns true if the mask holds any slot
+    bool Any() const { return bits_ != 0; }
+
+    /// @returns the lowest slot index in the mask
+    size_t Lowest() const {
+#if defined(__clang__) || defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(bits_)) >> SHIFT;
+#else
+        return Log2(bits_ & (~bits_ + 1)) >> SHIFT;
+#endif
+    }
+
+    /// Removes the lowest slot index from the mask
+    void RemoveLowest() { bits_ &= bits_ - 1; }
+
+  private:
+    uint64_t bits_;
+};
+
+/// SwissGroupPortable matches the control bytes of a group one byte at a time.
+class SwissGroupPortable {
+  public:
+    /// The mask type, with one bit per slot
+    using BitMask = SwissBitMask<0>;
+
+    /// Constructor
+    /// @param ctrl the control bytes of the group
+    explicit SwissGroupPortable(const uint8_t* ctrl) { memcpy(ctrl_, ctrl, kSwissGroupWidth); }
+
+    /// @param h2 the control byte of a full slot
+    /// @returns the slots with the control byte @p h2
+    BitMask Match(uint8_t h2) const {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < kSwissGroupWidth; i++) {
+            bits |= static_cast<uint64_t>(ctrl_[i] == h2) << i;
+        }
+        return BitMask(bits);
+    }
+
+    /// @returns the empty slots
+    BitMask MatchEmpty() const { return Match(kSwissCtrlEmpty); }
+
+    /// @returns the empty or deleted slots
+    BitMask MatchEmptyOrDeleted() const {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < kSwissGroupWidth; i++) {
+            bits |= static_cast<uint64_t>(ctrl_[i] >> 7) << i;
+        }
+        return BitMask(bits);
+    }
+
+  private:
+    uint8_t ctrl_[kSwissGroupWidth];
+};
+
+#if TINT_SWISS_HASHMAP_SSE2
+/// SwissGroupSSE2 matches the 16 control bytes of a group with SSE2 instructions.
+class SwissGroupSSE2 {
+  public:
+    /// The mask type, with one bit per slot
+    using BitMask = SwissBitMask<0>;
+
+    /// Constructor
+    /// @param ctrl the control bytes of the group
+    explicit SwissGroupSSE2(const uint8_t* ctrl)
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    /// @param h2 the control byte of a full slot
+    /// @returns the slots with the control byte @p h2
+    BitMask Match(uint8_t h2) const {
+        return ToMask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl_));
+    }
+
+    /// @returns the empty slots
+    BitMask MatchEmpty() const { return Match(kSwissCtrlEmpty); }
+
+    /// @returns the empty or deleted slots, which are the ones with the top bit set
+    BitMask MatchEmptyOrDeleted() const { return ToMask(ctrl_); }
+
+  private:
+    static BitMask ToMask(__m128i v) {
+        return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(v)));
+    }
+
+    __m128i ctrl_;
+};
+
+/// The group matcher used by SwissHashmapBase
+using SwissGroup = SwissGroupSSE2;
+#elif TINT_SWISS_HASHMAP_NEON
+/// SwissGroupNEON matches the 16 control bytes of a group with NEON instructions.
+class SwissGroupNEON {
+  public:
+    /// The mask type, with four bits per slot of which only the top one is set
+    using BitMask = SwissBitMask<2>;
+
+    /// Constructor
+    /// @param ctrl the control bytes of the group
+    explicit SwissGroupNEON(const uint8_t* ctrl) : ctrl_(vld1q_u8(ctrl)) {}
+
+    /// @param h2 the control byte of a full slot
+    /// @returns the slots with the control byte @p h2
+    BitMask Match(uint8_t h2) const { return ToMask(vceqq_u8(ctrl_, vdupq_n_u8(h2))); }
+
+    /// @returns the empty slots
+    BitMask MatchEmpty() const { return Match(kSwissCtrlEmpty); }
+
+    /// @returns the empty or deleted slots, which are the ones with the top bit set
+    BitMask MatchEmptyOrDeleted() const { return ToMask(vtstq_u8(ctrl_, vdupq_n_u8(0x80))); }
+
+  private:
+    /// Narrows the 0x00 / 0xff bytes of @p v to a nibble per slot, as NEON has no movemask.
+    static BitMask ToMask(uint8x16_t v) {
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(v), 4);
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+        return BitMask(bits & 0x8888888888888888ull);
+    }
+
+    uint8x16_t ctrl_;
+};
+
+/// The group matcher used by SwissHashmapBase
+using SwissGroup = SwissGroupNEON;
+#else
+/// The group matcher used by SwissHashmapBase
+using SwissGroup = SwissGroupPortable;
+#endif
+
+}  // namespace detail
+
+/// An alternative base class for Hashmap and Hashset that uses the Swiss table design of Abseil's
+/// flat_hash_map. Each slot has a control byte holding 7 bits of the key's hash, and lookups
+/// compare the control bytes of 16 slots at once using SSE2 (or NEON when
+/// TINT_SWISS_HASHMAP_ENABLE_NEON is defined), only comparing keys when the hash bits match. This
+/// makes lookups faster than HashmapBase's, especially for missing keys, at the cost of a control
+/// byte per slot and of removed entries using slots until the next rehash.
+/// @see https://abseil.io/about/design/swisstables
+template <typename KEY,
+          typename VALUE,
+          size_t N,
+          typename HASH = Hasher<KEY>,
+          typename EQUAL = std::equal_to<KEY>>
+class SwissHashmapBase {
+    static constexpr bool ValueIsVoid = std::is_same_v<VALUE, void>;
+
+  public:
+    /// The key type
+    using Key = KEY;
+    /// The value type
+    using Value = VALUE;
+    /// The entry type for the map.
+    /// This is:
+    /// - Key when Value is void (used by Hashset)
+    /// - KeyValue<Key, Value> when Value is not void (used by Hashmap)
+    using Entry = std::conditional_t<ValueIsVoid, Key, KeyValue<Key, Value>>;
+
+    /// A reference to an entry in the map.
+    /// This is:
+    /// - const Key& when Value is void (used by Hashset)
+    /// - KeyValueRef<Key, Value> when Value is not void (used by Hashmap)
+    template <bool IS_CONST>
+    using EntryRef = std::conditional_t<
+        ValueIsVoid,
+        const Key&,
+        KeyValueRef<Key, std::conditional_t<ValueIsVoid, bool, Value>, IS_CONST>>;
+
+    /// STL-friendly alias to Entry. Used by gmock.
+    using value_type = Entry;
+
+  private:
+    /// @returns the key from an entry
+    static const Key& KeyOf(const Entry& entry) {
+        if constexpr (ValueIsVoid) {
+            return entry;
+        } else {
+            return entry.key;
+        }
+    }
+
+    /// @returns a pointer to the value from an entry.
+    static Value* ValueOf(Entry& entry) {
+        if constexpr (ValueIsVoid) {
+            return nullptr;  // Hashset only has keys
+        } else {
+            return &entry.value;
+        }
+    }
+
+    /// A slot is a single entry in the underlying vector.
+    /// The entry has a value if and only if the slot's control byte is a hash.
+    struct Slot {
+        /// The slot value. If this does not contain a value, then the slot is vacant.
+        std::optional<Entry> entry;
+    };
+
+    /// @returns the maximum number of entries, including removed ones, for `num_slots` slots.
+    static constexpr size_t MaxLoad(size_t num_slots) { return num_slots - num_slots / 8; }
+
+    /// @returns the number of slots required to hold `count` map entries.
+    /// This is a power of two multiple of the group width.
+    static constexpr size_t NumSlots(size_t count) {
+        const size_t min_slots = (count * 8 + 6) / 7;
+        return std::max<size_t>(static_cast<size_t>(NextPowerOfTwo(min_slots)),
+                                detail::kSwissGroupWidth);
+    }
+
+    /// The fixed-size slot vector length, based on N.
+    static constexpr size_t kNumFixedSlots = N == 0 ? 0 : NumSlots(N);
+
+    /// The minimum number of slots for the map.
+    static constexpr size_t kMinSlots = NumSlots(N);
+
+  public:
+    /// Iterator for entries in the map.
+    /// Iterators are invalidated if the map is modified.
+    template <bool IS_CONST>
+    class IteratorT {
+      public:
+        /// @returns the value pointed to by this iterator
+        EntryRef<IS_CONST> operator->() const { return *this; }
+
+        /// @returns a reference to the value at the iterator
+        EntryRef<IS_CONST> operator*() const {
+            auto& ref = current->entry.value();
+            if constexpr (ValueIsVoid) {
+                return ref;
+            } else {
+                return {ref.key, ref.value};
+            }
+        }
+
+        /// Increments the iterator
+        /// @returns this iterator
+        IteratorT& operator++() {
+            if (current == end) {
+                return *this;
+            }
+            current++;
+            SkipToNextValue();
+            return *this;
+        }
+
+        /// Equality operator
+        /// @param other the other iterator to compare this iterator to
+        /// @returns true if this iterator is equal to other
+        bool operator==(const IteratorT& other) const { return current == other.current; }
+
+        /// Inequality operator
+        /// @param other the other iterator to compare this iterator to
+        /// @returns true if this iterator is not equal to other
+        bool operator!=(const IteratorT& other) const { return current != other.current; }
+
+      private:
+        /// Friend class
+        friend class SwissHashmapBase;
+
+        using SLOT = std::conditional_t<IS_CONST, const Slot, Slot>;
+
+        IteratorT(SLOT* c, SLOT* e) : current(c), end(e) { SkipToNextValue(); }
+
+        /// Moves the iterator forward, stopping at the next slot that is not empty.
+        void SkipToNextValue() {
+            while (current != end && !current->entry.has_value()) {
+                current++;
+            }
+        }
+
+        SLOT* current;  /// The slot the iterator is pointing to
+        SLOT* end;      /// One past the last slot in the map
+    };
+
+    /// An immutable key and mutable value iterator
+    using Iterator = IteratorT</*IS_CONST*/ false>;
+
+    /// An immutable key and value iterator
+    using ConstIterator = IteratorT</*IS_CONST*/ true>;
+
+    /// Constructor
+    SwissHashmapBase() { Reset(kMinSlots); }
+
+    /// Copy constructor
+    /// @param other the other SwissHashmapBase to copy
+    SwissHashmapBase(const SwissHashmapBase& other) = default;
+
+    /// Move constructor
+    /// @param other the other SwissHashmapBase to move
+    SwissHashmapBase(SwissHashmapBase&& other) = default;
+
+    /// Destructor
+    ~SwissHashmapBase() = default;
+
+    /// Copy-assignment operator
+    /// @param other the other SwissHashmapBase to copy
+    /// @returns this so calls can be chained
+    SwissHashmapBase& operator=(const SwissHashmapBase& other) = default;
+
+    /// Move-assignment operator
+    /// @param other the other SwissHashmapBase to move
+    /// @returns this so calls can be chained
+    SwissHashmapBase& operator=(SwissHashmapBase&& other) = default;
+
+    /// Removes all entries from the map.
+    void Clear() {
+        slots_.Clear();  // Destructs all entries
+        Reset(kMinSlots);
+        count_ = 0;
+        generation_++;
+    }
+
+    /// Removes an entry from the map.
+    /// @param key the entry key.
+    /// @returns true if an entry was removed.
+    bool Remove(const Key& key) {
+        const auto [found, index] = IndexOf(key);
+        if (!found) {
+            return false;
+        }
+
+        slots_[index].entry.reset();
+
+        // Lookups stop at the first group with an empty slot. If the slot's group still has one,
+        // no lookup goes past this group and the slot can be made empty again. Otherwise it needs
+        // to be marked as deleted so lookups for the keys placed after it keep going.
+        const size_t group_start = index & ~(detail::kSwissGroupWidth - 1);
+        if (detail::SwissGroup(&ctrl_[group_start]).MatchEmpty().Any()) {
+            ctrl_[index] = detail::kSwissCtrlEmpty;
+            growth_left_++;
+        } else {
+            ctrl_[index] = detail::kSwissCtrlDeleted;
+        }
+
+        count_--;
+        generation_++;
+
+        return true;
+    }
+
+    /// Checks whether an entry exists in the map
+    /// @param key the key to search for.
+    /// @returns true if the map contains an entry with the given value.
+    bool Contains(const Key& key) const {
+        const auto [found, _] = IndexOf(key);
+        return found;
+    }
+
+    /// Pre-allocates memory so that the map can hold at least `capacity` entries.
+    /// @param capacity the new capacity of the map.
+    void Reserve(size_t capacity) {
+        const size_t num_slots = std::max(NumSlots(capacity), kMinSlots);
+        if (slots_.Length() >= num_slots) {
+            // Already have enough slots.
+            return;
+        }
+        Rehash(num_slots);
+    }
+
+    /// @returns the number of entries in the map.
+    size_t Count() const { return count_; }
+
+    /// @returns true if the map contains no entries.
+    bool IsEmpty() const { return count_ == 0; }
+
+    /// @returns a monotonic counter which is incremented whenever the map is mutated.
+    size_t Generation() const { return generation_; }
+
+    /// @returns an immutable iterator to the start of the map.
+    ConstIterator begin() const { return ConstIterator{slots_.begin(), slots_.end()}; }
+
+    /// @returns an immutable iterator to the end of the map.
+    ConstIterator end() const { return ConstIterator{slots_.end(), slots_.end()}; }
+
+    /// @returns an iterator to the start of the map.
+    Iterator begin() { return Iterator{slots_.begin(), slots_.end()}; }
+
+    /// @returns an iterator to the end of the map.
+    Iterator end() { return Iterator{slots_.end(), slots_.end()}; }
+
+    /// A debug function for checking that the map is in good health.
+    /// Asserts if the map is corrupted.
+    void ValidateIntegrity() const {
+        size_t num_alive = 0;
+        size_t num_deleted = 0;
+        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
+            const auto& slot = slots_[slot_idx];
+            const uint8_t ctrl = ctrl_[slot_idx];
+            if (ctrl & 0x80) {
+                TINT_ASSERT(Utils, !slot.entry.has_value());
+                TINT_ASSERT(Utils,
+                            ctrl == detail::kSwissCtrlEmpty || ctrl == detail::kSwissCtrlDeleted);
+                if (ctrl == detail::kSwissCtrlDeleted) {
+                    num_deleted++;
+                }
+            } else {
+                TINT_ASSERT(Utils, slot.entry.has_value());
+                num_alive++;
+                const auto hash = Hash(KeyOf(*slot.entry));
+                TINT_ASSERT(Utils, hash.h2 == ctrl);
+                const auto [found, index] = IndexOf(hash, KeyOf(*slot.entry));
+                TINT_ASSERT(Utils, found && index == slot_idx);
+            }
+        }
+        TINT_ASSERT(Utils, num_alive == count_);
+        TINT_ASSERT(Utils, growth_left_ + count_ + num_deleted == MaxLoad(slots_.Length()));
+    }
+
+  protected:
+    /// The behaviour of Put() when an entry already exists with the given key.
+    enum class PutMode {
+        /// Do not replace existing entries with the new value.
+        kAdd,
+        /// Replace existing entries with the new value.
+        kReplace,
+    };
+
+    /// Result of Put()
+    struct PutResult {
+        /// Whether the insert replaced or added a new entry to the map.
+        MapAction action = MapAction::kAdded;
+        /// A pointer to the inserted entry value.
+        Value* value = nullptr;
+
+        /// @returns true if the entry was added to the map, or an existing entry was replaced.
+        operator bool() const { return action != MapAction::kKeptExisting; }
+    };
+
+    /// The common implementation for Add() and Replace()
+    /// @param key the key of the entry to add to the map.
+    /// @param value the value of the entry to add to the map.
+    /// @returns A PutResult describing the result of the insertion
+    template <PutMode MODE, typename K, typename V>
+    PutResult Put(K&& key, V&& value) {
+        const auto hash = Hash(key);
+
+        auto make_entry = [&]() {
+            if constexpr (ValueIsVoid) {
+                return std::forward<K>(key);
+            } else {
+                return Entry{std::forward<K>(key), std::forward<V>(value)};
+            }
+        };
+
+        if (const auto [found, index] = IndexOf(hash, key); found) {
+            auto& slot = slots_[index];
+            // Slot is equal to value. Replace or preserve?
+            if constexpr (MODE == PutMode::kReplace) {
+                slot.entry = make_entry();
+                generation_++;
+                return PutResult{MapAction::kReplaced, ValueOf(*slot.entry)};
+            } else {
+                return PutResult{MapAction::kKeptExisting, ValueOf(*slot.entry)};
+            }
+        }
+
+        if (growth_left_ == 0) {
+            // If at least half of the load is made of removed entries, rehashing in place is
+            // enough to make room. Otherwise grow the map.
+            const size_t num_slots = slots_.Length();
+            Rehash(count_ < MaxLoad(num_slots) / 2 ? num_slots : num_slots * 2);
+        }
+
+        const size_t index = FindSlotForInsert(hash);
+        if (ctrl_[index] == detail::kSwissCtrlEmpty) {
+            growth_left_--;
+        }
+        ctrl_[index] = hash.h2;
+        auto& slot = slots_[index];
+        slot.entry.emplace(make_entry());
+        count_++;
+        generation_++;
+        return PutResult{MapAction::kAdded, ValueOf(*slot.entry)};
+    }
+
+    /// HashResult is the return value of Hash()
+    struct HashResult {
+        /// The hash bits used to select the first group to probe.
+        size_t h1;
+        /// The hash bits stored in the control byte of the key's slot.
+        uint8_t h2;
+    };
+
+    /// @param key the key to hash
+    /// @returns the hash of the key, split into the group selection and control byte bits.
+    HashResult Hash(const Key& key) const {
+        // Multiply by the golden ratio to spread weak hashes, such as pointers which have their
+        // low bits clear, into the high bits. Then fold the high bits back into the low bits that
+        // select the group.
+        uint64_t hash = static_cast<uint64_t>(HASH()(key)) * 0x9e3779b97f4a7c15ull;
+        const uint8_t h2 = static_cast<uint8_t>(hash >> 57);
+        hash ^= hash >> 32;
+        return {static_cast<size_t>(hash), h2};
+    }
+
+    /// Looks for the key in the map.
+    /// @param key the key to search for.
+    /// @returns a tuple holding a boolean representing whether the key was found in the map, and
+    /// if found, the index of the slot that holds the key.
+    std::tuple<bool, size_t> IndexOf(const Key& key) const { return IndexOf(Hash(key), key); }
+
+    /// Looks for the key in the map.
+    /// @param hash the hash of @p key
+    /// @param key the key to search for.
+    /// @returns a tuple holding a boolean representing whether the key was found in the map, and
+    /// if found, the index of the slot that holds the key.
+    std::tuple<bool, size_t> IndexOf(const HashResult& hash, const Key& key) const {
+        const size_t num_groups = slots_.Length() / detail::kSwissGroupWidth;
+        const size_t group_mask = num_groups - 1;
+        // Probe the groups quadratically. As the number of groups is a power of two, the
+        // triangular numbers visit each group once.
+        size_t group = hash.h1 & group_mask;
+        for (size_t probe = 1; probe <= num_groups; probe++) {
+            const size_t group_start = group * detail::kSwissGroupWidth;
+            const detail::SwissGroup ctrl(&ctrl_[group_start]);
+            for (auto match = ctrl.Match(hash.h2); match.Any(); match.RemoveLowest()) {
+                const size_t index = group_start + match.Lowest();
+                if (EQUAL()(key, KeyOf(*slots_[index].entry))) {
+                    return {/* found */ true, index};
+                }
+            }
+            if (ctrl.MatchEmpty().Any()) {
+                // The key would have been placed in this group.
+                return {/* found */ false, /* index */ 0};
+            }
+            group = (group + probe) & group_mask;
+        }
+        return {/* found */ false, /* index */ 0};
+    }
+
+    /// @param hash the hash of the key to insert
+    /// @returns the index of the first empty or deleted slot in the probe sequence of @p hash
+    size_t FindSlotForInsert(const HashResult& hash) const {
+        const size_t num_groups = slots_.Length() / detail::kSwissGroupWidth;
+        const size_t group_mask = num_groups - 1;
+        size_t group = hash.h1 & group_mask;
+        for (size_t probe = 1; probe <= num_groups; probe++) {
+            const size_t group_start = group * detail::kSwissGroupWidth;
+            const auto match = detail::SwissGroup(&ctrl_[group_start]).MatchEmptyOrDeleted();
+            if (match.Any()) {
+                return group_start + match.Lowest();
+            }
+            group = (group + probe) & group_mask;
+        }
+
+        tint::diag::List diags;
+        TINT_ICE(Utils, diags) << "SwissHashmapBase looped entire map without finding a slot";
+        return 0;
+    }
+
+    /// Resets the control bytes and load for `num_slots` empty slots.
+    /// @param num_slots the new number of slots
+    void Reset(size_t num_slots) {
+        slots_.Resize(num_slots);
+        ctrl_.Clear();
+        ctrl_.Resize(num_slots, detail::kSwissCtrlEmpty);
+        growth_left_ = MaxLoad(num_slots);
+    }
+
+    /// Moves all the entries to a new slot vector of `num_slots` slots, dropping the deleted slots.
+    /// @param num_slots the new number of slots
+    void Rehash(size_t num_slots) {
+        // Move all the values out of the map and into a vector.
+        Vector<Entry, N> entries;
+        entries.Reserve(count_);
+        for (auto& slot : slots_) {
+            if (slot.entry.has_value()) {
+                entries.Push(std::move(slot.entry.value()));
+            }
+        }
+
+        slots_.Clear();
+        Reset(num_slots);
+
+        // All keys are unique, so they can be placed without looking them up.
+        for (auto& entry : entries) {
+            const auto hash = Hash(KeyOf(entry));
+            const size_t index = FindSlotForInsert(hash);
+            ctrl_[index] = hash.h2;
+            slots_[index].entry.emplace(std::move(entry));
+        }
+        growth_left_ -= count_;
+        generation_++;
+    }
+
+    /// The vector of slots. The vector length is equal to its capacity.
+    Vector<Slot, kNumFixedSlots> slots_;
+
+    /// The control byte of each slot: kSwissCtrlEmpty, kSwissCtrlDeleted, or the 7 bits of the
+    /// entry's hash in HashResult::h2.
+    Vector<uint8_t, kNumFixedSlots> ctrl_;
+
+    /// The number of entries in the map.
+    size_t count_ = 0;
+
+    /// The number of entries that can be added to empty slots before the map needs rehashing.
+    size_t growth_left_ = 0;
+
+    /// Counter that's incremented with each modification to the map.
+    size_t generation_ = 0;
+};
+
+}  // namespace tint::utils
+
+#endif  // SRC_TINT_UTILS_SWISS_HASHMAP_BASE_H_
@@ -0,0 +1,257 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/utils/swiss_hashmap_base.h"
+
+#include <array>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "gmock/gmock.h"
+#include "src/tint/utils/hashmap.h"
+#include "src/tint/utils/hashset.h"
+
+namespace tint::utils {
+namespace {
+
+template <typename GROUP>
+std::vector<size_t> Indices(typename GROUP::BitMask mask) {
+    std::vector<size_t> out;
+    for (; mask.Any(); mask.RemoveLowest()) {
+        out.push_back(mask.Lowest());
+    }
+    return out;
+}
+
+TEST(SwissHashmap, GroupMatch) {
+    std::array<uint8_t, detail::kSwissGroupWidth> ctrl;
+    ctrl.fill(detail::kSwissCtrlEmpty);
+    ctrl[0] = 0x12;
+    ctrl[3] = detail::kSwissCtrlDeleted;
+    ctrl[7] = 0x12;
+    ctrl[8] = 0x7f;
+    ctrl[15] = 0x12;
+    for (size_t i = 9; i < 15; i++) {
+        ctrl[i] = 0x00;
+    }
+
+    using Portable = detail::SwissGroupPortable;
+    using Group = detail::SwissGroup;
+    const Portable portable(ctrl.data());
+    const Group group(ctrl.data());
+
+    EXPECT_THAT(Indices<Portable>(portable.Match(0x12)), testing::ElementsAre(0, 7, 15));
+    EXPECT_THAT(Indices<Portable>(portable.Match(0x00)),
+                testing::ElementsAre(9, 10, 11, 12, 13, 14));
+    EXPECT_THAT(Indices<Portable>(portable.Match(0x33)), testing::ElementsAre());
+    EXPECT_THAT(Indices<Portable>(portable.MatchEmpty()), testing::ElementsAre(1, 2, 4, 5, 6));
+    EXPECT_THAT(Indices<Portable>(portable.MatchEmptyOrDeleted()),
+                testing::ElementsAre(1, 2, 3, 4, 5, 6));
+
+    // The SIMD implementation, if any, matches the portable one.
+    for (uint32_t h2 = 0; h2 < 0x80; h2++) {
+        EXPECT_EQ(Indices<Group>(group.Match(static_cast<uint8_t>(h2))),
+                  Indices<Portable>(portable.Match(static_cast<uint8_t>(h2))))
+            << "h2: " << h2;
+    }
+    EXPECT_EQ(Indices<Group>(group.MatchEmpty()), Indices<Portable>(portable.MatchEmpty()));
+    EXPECT_EQ(Indices<Group>(group.MatchEmptyOrDeleted()),
+              Indices<Portable>(portable.MatchEmptyOrDeleted()));
+}
+
+TEST(SwissHashmap, AddRemove) {
+    SwissHashmap<std::string, std::string, 8> map;
+    EXPECT_TRUE(map.Add("hello", "world"));
+    EXPECT_EQ(map.Get("hello"), "world");
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_TRUE(map.Contains("hello"));
+    EXPECT_FALSE(map.Contains("world"));
+    EXPECT_FALSE(map.Add("hello", "cat"));
+    EXPECT_EQ(map.Count(), 1u);
+    map.Replace("hello", "cat");
+    EXPECT_EQ(map.Get("hello"), "cat");
+    EXPECT_TRUE(map.Remove("hello"));
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_FALSE(map.Contains("hello"));
+    EXPECT_FALSE(map.Remove("hello"));
+    map.ValidateIntegrity();
+}
+
+TEST(SwissHashmap, Generation) {
+    SwissHashmap<int, std::string, 8> map;
+    EXPECT_EQ(map.Generation(), 0u);
+    map.Add(1, "one");
+    EXPECT_EQ(map.Generation(), 1u);
+    map.Add(1, "uno");
+    EXPECT_EQ(map.Generation(), 1u);
+    map.Replace(1, "une");
+    EXPECT_EQ(map.Generation(), 2u);
+    map.Remove(1);
+    EXPECT_EQ(map.Generation(), 3u);
+    map.Clear();
+    EXPECT_EQ(map.Generation(), 4u);
+    map.Get(2);
+    EXPECT_EQ(map.Generation(), 4u);
+}
+
+TEST(SwissHashmap, Iterator) {
+    using Map = SwissHashmap<int, std::string, 8>;
+    using Entry = typename Map::Entry;
+    Map map;
+    map.Add(1, "one");
+    map.Add(4, "four");
+    map.Add(3, "three");
+    map.Add(2, "two");
+    for (auto pair : map) {
+        pair.value += "!";
+    }
+    EXPECT_THAT(map, testing::UnorderedElementsAre(Entry{1, "one!"}, Entry{2, "two!"},
+                                                   Entry{3, "three!"}, Entry{4, "four!"}));
+}
+
+TEST(SwissHashmap, FindAcrossRehash) {
+    SwissHashmap<int, int, 4> map;
+    map.Add(0, 100);
+    auto zero = map.Find(0);
+    for (int i = 1; i < 1000; i++) {
+        map.Add(i, i + 100);
+    }
+    ASSERT_TRUE(zero);
+    EXPECT_EQ(*zero, 100);
+    map.ValidateIntegrity();
+}
+
+TEST(SwissHashmap, GetOrCreate_CreateModifiesMap) {
+    SwissHashmap<int, std::string, 8> map;
+    EXPECT_EQ(map.GetOrCreate(0,
+                              [&] {
+                                  for (int i = 1; i < 100; i++) {
+                                      map.Add(i, std::to_string(i));
+                                  }
+                                  return "zero";
+                              }),
+              "zero");
+    EXPECT_EQ(map.Count(), 100u);
+    EXPECT_EQ(map.Get(0), "zero");
+    EXPECT_EQ(map.Get(99), "99");
+}
+
+// Pointers have their low bits clear, which must not make the keys collide.
+TEST(SwissHashmap, PointerKeys) {
+    std::vector<std::array<int, 4>> objects(2000);
+    SwissHashmap<const void*, size_t, 8> map;
+    for (size_t i = 0; i < objects.size(); i++) {
+        EXPECT_TRUE(map.Add(&objects[i], i));
+    }
+    for (size_t i = 0; i < objects.size(); i++) {
+        EXPECT_EQ(map.Get(&objects[i]), i);
+    }
+    map.ValidateIntegrity();
+}
+
+// Removing and adding entries reuses the deleted slots instead of growing the map forever.
+TEST(SwissHashmap, RemoveAddChurn) {
+    SwissHashmap<int, int, 0> map;
+    for (int i = 0; i < 100000; i++) {
+        EXPECT_TRUE(map.Add(i, i));
+        if (i >= 10) {
+            EXPECT_TRUE(map.Remove(i - 10));
+        }
+    }
+    EXPECT_EQ(map.Count(), 10u);
+    map.ValidateIntegrity();
+    for (int i = 99990; i < 100000; i++) {
+        EXPECT_EQ(map.Get(i), i);
+    }
+}
+
+TEST(SwissHashmap, Equality) {
+    SwissHashmap<int, std::string, 8> a;
+    SwissHashmap<int, std::string, 4> b;
+    Hashmap<int, std::string, 8> c;
+    a.Add(1, "one");
+    b.Add(1, "one");
+    c.Add(1, "one");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a, c);
+    b.Replace(1, "uno");
+    EXPECT_NE(a, b);
+}
+
+TEST(SwissHashset, AddRemove) {
+    SwissHashset<std::string, 8> set;
+    EXPECT_TRUE(set.Add("hello"));
+    EXPECT_FALSE(set.Add("hello"));
+    EXPECT_TRUE(set.Contains("hello"));
+    EXPECT_THAT(set.Vector(), testing::ElementsAre("hello"));
+    EXPECT_TRUE(set.Remove("hello"));
+    EXPECT_TRUE(set.IsEmpty());
+}
+
+TEST(SwissHashmap, Soak) {
+    std::mt19937 rnd;
+    std::unordered_map<std::string, std::string> reference;
+    SwissHashmap<std::string, std::string, 8> map;
+    for (size_t i = 0; i < 1000000; i++) {
+        std::string key = std::to_string(rnd() & 1023);
+        std::string value = "V" + key;
+        switch (rnd() % 7) {
+            case 0: {  // Add
+                auto expected = reference.emplace(key, value).second;
+                EXPECT_EQ(map.Add(key, value), expected) << "i:" << i;
+                EXPECT_EQ(map.Get(key), value) << "i:" << i;
+                break;
+            }
+            case 1: {  // Replace
+                reference[key] = value;
+                map.Replace(key, value);
+                EXPECT_EQ(map.Get(key), value) << "i:" << i;
+                break;
+            }
+            case 2: {  // Remove
+                auto expected = reference.erase(key) != 0;
+                EXPECT_EQ(map.Remove(key), expected) << "i:" << i;
+                EXPECT_FALSE(map.Contains(key)) << "i:" << i;
+                break;
+            }
+            case 3: {  // Contains
+                auto expected = reference.count(key) != 0;
+                EXPECT_EQ(map.Contains(key), expected) << "i:" << i;
+                break;
+            }
+            case 4: {  // Count
+                EXPECT_EQ(map.Count(), reference.size()) << "i:" << i;
+                break;
+            }
+            case 5: {  // Copy / Move
+                SwissHashmap<std::string, std::string, 8> tmp(map);
+                map = std::move(tmp);
+                break;
+            }
+            case 6: {  // Clear, rarely, so that the map fills up
+                if (rnd() % 64 == 0) {
+                    reference.clear();
+                    map.Clear();
+                }
+                break;
+            }
+        }
+    }
+    map.ValidateIntegrity();
+}
+
+}  // namespace
+}  // namespace tint::utils
@@ -0,0 +1,176 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/generate_entry_points.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/tint/transform/manager.h"
+#include "src/tint/transform/single_entry_point.h"
+
+namespace tint::writer {
+
+namespace {
+
+/// A pool of helper threads shared by all the calls to GenerateEntryPoints(), so that the threads
+/// are only created once rather than on every call.
+class WorkerPool {
+  public:
+    /// @returns the process-wide pool
+    static WorkerPool& Get() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    /// Destructor. Stops and joins the threads.
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    /// Runs `task` on up to `count` helper threads and on the calling thread, and returns once all
+    /// of them have returned. More threads are created if the pool has fewer than `count`.
+    /// @param count the maximum number of helper threads to run `task` on
+    /// @param task the function to run
+    void Run(size_t count, const std::function<void()>& task) {
+        size_t remaining = count;
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+        auto run_task = [&] {
+            task();
+            std::lock_guard<std::mutex> done_lock(done_mutex);
+            if (--remaining == 0) {
+                done_cv.notify_one();
+            }
+        };
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (threads_.size() < count) {
+                threads_.emplace_back([this] { ThreadMain(); });
+            }
+            for (size_t i = 0; i < count; i++) {
+                tasks_.push_back(Task{&remaining, run_task});
+            }
+        }
+        cv_.notify_all();
+
+        task();
+
+        // `task` has run out of work, so the queued tasks that haven't started yet have nothing
+        // left to do. Drop them rather than waiting for a thread to pick them up, which also
+        // avoids a deadlock when `task` itself calls Run() from a helper thread.
+        size_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = std::remove_if(tasks_.begin(), tasks_.end(),
+                                     [&](const Task& t) { return t.owner == &remaining; });
+            dropped = static_cast<size_t>(std::distance(it, tasks_.end()));
+            tasks_.erase(it, tasks_.end());
+        }
+
+        // The started tasks reference this stack frame, so wait for them to return.
+        std::unique_lock<std::mutex> done_lock(done_mutex);
+        remaining -= dropped;
+        done_cv.wait(done_lock, [&] { return remaining == 0; });
+    }
+
+  private:
+    struct Task {
+        /// Identifies the Run() call that queued the task
+        const void* owner = nullptr;
+        std::function<void()> fn;
+    };
+
+    void ThreadMain() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task.fn();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Task> tasks_;
+    std::vector<std::thread> threads_;
+    bool stopping_ = false;
+};
+
+void GenerateEntryPoint(const Program* program,
+                        const std::string& entry_point,
+                        size_t index,
+                        const EntryPointGenerator& generate) {
+    transform::Manager manager;
+    transform::DataMap inputs;
+    manager.Add<transform::SingleEntryPoint>();
+    inputs.Add<transform::SingleEntryPoint::Config>(entry_point);
+    auto output = manager.Run(program, std::move(inputs));
+    generate(index, output.program);
+}
+
+}  // namespace
+
+void GenerateEntryPoints(const Program* program,
+                         const std::vector<std::string>& entry_points,
+                         const EntryPointGenerator& generate,
+                         uint32_t max_threads) {
+    if (max_threads == 0) {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    size_t thread_count = std::min<size_t>(max_threads, entry_points.size());
+
+    if (thread_count <= 1) {
+        for (size_t i = 0; i < entry_points.size(); i++) {
+            GenerateEntryPoint(program, entry_points[i], i, generate);
+        }
+        return;
+    }
+
+    // Each thread picks the next entry point that hasn't been processed yet, which balances the
+    // load when the entry points have very different sizes.
+    std::atomic<size_t> next_index{0};
+    auto worker = [&] {
+        for (size_t i = next_index++; i < entry_points.size(); i = next_index++) {
+            GenerateEntryPoint(program, entry_points[i], i, generate);
+        }
+    };
+
+    // The calling thread is one of the workers.
+    WorkerPool::Get().Run(thread_count - 1, worker);
+}
+
+}  // namespace tint::writer
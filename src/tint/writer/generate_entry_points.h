@@ -0,0 +1,52 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_TINT_WRITER_GENERATE_ENTRY_POINTS_H_
+#define SRC_TINT_WRITER_GENERATE_ENTRY_POINTS_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "src/tint/program.h"
+
+namespace tint::writer {
+
+/// The function called by GenerateEntryPoints() for each entry point.
+/// @param index the index of the entry point in the list passed to GenerateEntryPoints()
+/// @param program the program holding only the entry point. The program is invalid if the entry
+/// point could not be extracted, in which case its diagnostics describe the error.
+using EntryPointGenerator = std::function<void(size_t index, const Program& program)>;
+
+/// Extracts each of `entry_points` from `program` with the SingleEntryPoint transform, and calls
+/// `generate` with the resulting program, which is typically passed to a writer.
+/// The entry points are processed concurrently on the calling thread and up to `max_threads - 1`
+/// threads from a pool that is shared by all the calls. `program` is only read, so it is shared by
+/// all the threads. `generate` is called concurrently for different entry points, so it must
+/// synchronize any access to shared state. Writing the result to the
+/// `index`-th element of a pre-sized vector needs no synchronization.
+/// @param program the valid program to extract the entry points from
+/// @param entry_points the names of the entry points
+/// @param generate the function called for each entry point
+/// @param max_threads the maximum number of threads to use. If 0, the number of hardware threads
+/// is used. If 1, the entry points are processed on the calling thread.
+void GenerateEntryPoints(const Program* program,
+                         const std::vector<std::string>& entry_points,
+                         const EntryPointGenerator& generate,
+                         uint32_t max_threads = 0);
+
+}  // namespace tint::writer
+
+#endif  // SRC_TINT_WRITER_GENERATE_ENTRY_POINTS_H_
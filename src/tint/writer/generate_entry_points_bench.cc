@@ -0,0 +1,109 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "src/tint/bench/benchmark.h"
+#include "src/tint/utils/string_stream.h"
+#include "src/tint/writer/generate_entry_points.h"
+
+namespace tint::writer {
+namespace {
+
+/// @returns a WGSL module with `count` compute entry points, which share a few helper functions.
+std::string EntryPointsWGSL(int64_t count) {
+    utils::StringStream wgsl;
+    wgsl << R"(
+struct Particle {
+  pos : vec4f,
+  vel : vec4f,
+}
+
+@group(0) @binding(0) var<storage, read_write> particles : array<Particle>;
+@group(0) @binding(1) var<uniform> params : vec4f;
+
+fn integrate(p : Particle, dt : f32) -> Particle {
+  var r = p;
+  r.vel = r.vel + vec4f(0, -9.8, 0, 0) * dt;
+  r.pos = r.pos + r.vel * dt;
+  return r;
+}
+
+fn bounce(p : Particle) -> Particle {
+  var r = p;
+  if (r.pos.y < 0) {
+    r.pos.y = -r.pos.y;
+    r.vel.y = -r.vel.y * params.w;
+  }
+  return r;
+}
+)";
+    for (int64_t i = 0; i < count; i++) {
+        wgsl << "\n@compute @workgroup_size(64)\n"
+             << "fn main" << i << "(@builtin(global_invocation_id) id : vec3u) {\n"
+             << "  var p = particles[id.x];\n"
+             << "  for (var i = 0; i < " << (i + 1) << "; i++) {\n"
+             << "    p = bounce(integrate(p, params.x * f32(i)));\n"
+             << "  }\n"
+             << "  particles[id.x] = p;\n"
+             << "}\n";
+    }
+    return wgsl.str();
+}
+
+void GenerateEntryPointsHLSL(benchmark::State& state) {
+    auto entry_point_count = state.range(0);
+    auto max_threads = static_cast<uint32_t>(state.range(1));
+
+    Source::File file("entry_points.wgsl", EntryPointsWGSL(entry_point_count));
+    auto program = reader::wgsl::Parse(&file);
+    if (!program.IsValid()) {
+        state.SkipWithError(program.Diagnostics().str().c_str());
+        return;
+    }
+    std::vector<std::string> entry_points;
+    for (int64_t i = 0; i < entry_point_count; i++) {
+        entry_points.push_back("main" + std::to_string(i));
+    }
+
+    std::atomic<bool> failed{false};
+    for (auto _ : state) {
+        std::vector<std::string> outputs(entry_points.size());
+        GenerateEntryPoints(
+            &program, entry_points,
+            [&](size_t index, const Program& single) {
+                auto res = hlsl::Generate(&single, {});
+                if (!res.success) {
+                    failed = true;
+                }
+                outputs[index] = std::move(res.hlsl);
+            },
+            max_threads);
+        if (failed) {
+            state.SkipWithError("failed to generate HLSL");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * entry_point_count);
+}
+
+BENCHMARK(GenerateEntryPointsHLSL)
+    ->ArgNames({"entry_points", "threads"})
+    ->ArgsProduct({{1, 8, 32}, {1, 2, 4, 8}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace tint::writer
@@ -0,0 +1,83 @@
+// Copyright 2023 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/tint/writer/generate_entry_points.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/tint/inspector/inspector.h"
+#include "src/tint/program_builder.h"
+
+namespace tint::writer {
+namespace {
+
+using namespace tint::number_suffixes;  // NOLINT
+
+class GenerateEntryPointsTest : public ::testing::TestWithParam<uint32_t> {
+  protected:
+    /// @returns a program with a compute entry point for each name in `names`
+    Program MakeProgram(const std::vector<std::string>& names) {
+        ProgramBuilder b;
+        for (auto& name : names) {
+            b.Func(name, utils::Empty, b.ty.void_(), utils::Empty,
+                   utils::Vector{b.Stage(ast::PipelineStage::kCompute), b.WorkgroupSize(1_i)});
+        }
+        return Program(std::move(b));
+    }
+};
+
+TEST_P(GenerateEntryPointsTest, EachEntryPoint) {
+    std::vector<std::string> names{"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+    Program program = MakeProgram(names);
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    // The entry points are processed in reverse order, to check the indices.
+    std::vector<std::string> entry_points(names.rbegin(), names.rend());
+    std::vector<std::vector<std::string>> generated(entry_points.size());
+    GenerateEntryPoints(
+        &program, entry_points,
+        [&](size_t index, const Program& single) {
+            ASSERT_TRUE(single.IsValid()) << single.Diagnostics().str();
+            inspector::Inspector inspector(&single);
+            for (auto& entry_point : inspector.GetEntryPoints()) {
+                generated[index].push_back(entry_point.name);
+            }
+        },
+        GetParam());
+
+    for (size_t i = 0; i < entry_points.size(); i++) {
+        EXPECT_EQ(generated[i], std::vector<std::string>{entry_points[i]});
+    }
+}
+
+TEST_P(GenerateEntryPointsTest, UnknownEntryPoint) {
+    Program program = MakeProgram({"a", "b"});
+    ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+    std::vector<int> valid(3);
+    GenerateEntryPoints(
+        &program, {"a", "unknown", "b"},
+        [&](size_t index, const Program& single) { valid[index] = single.IsValid() ? 1 : 0; },
+        GetParam());
+
+    EXPECT_EQ(valid, (std::vector<int>{1, 0, 1}));
+}
+
+INSTANTIATE_TEST_SUITE_P(MaxThreads, GenerateEntryPointsTest, ::testing::Values(0u, 1u, 2u, 4u));
+
+}  // namespace
+}  // namespace tint::writer
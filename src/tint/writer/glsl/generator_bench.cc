@@ -35,14 +35,21 @@ void GenerateGLSL(benchmark::State& state, std::string input_name) {
         }
     }
 
+    size_t output_size = 0;
+    uint64_t allocations = 0;
     for (auto _ : state) {
+        bench::ScopedAllocationCounter allocation_counter;
+        output_size = 0;
         for (auto& ep : entry_points) {
             auto res = Generate(&program, {}, ep);
             if (!res.error.empty()) {
                 state.SkipWithError(res.error.c_str());
             }
+            output_size += res.glsl.size();
         }
+        allocations += allocation_counter.Count();
     }
+    bench::ReportOutput(state, output_size, allocations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateGLSL);
@@ -14,9 +14,6 @@
 
 #include "src/tint/writer/spirv/binary_writer.h"
 
-#include <cstring>
-#include <string>
-
 namespace tint::writer::spirv {
 namespace {
 
@@ -29,12 +26,12 @@ BinaryWriter::BinaryWriter() = default;
 BinaryWriter::~BinaryWriter() = default;
 
 void BinaryWriter::WriteBuilder(Builder* builder) {
-    out_.reserve(builder->total_size());
-    builder->iterate([this](const Instruction& inst) { this->process_instruction(inst); });
+    out_.reserve(out_.size() + builder->total_size());
+    builder->append_words(out_);
 }
 
 void BinaryWriter::WriteInstruction(const Instruction& inst) {
-    process_instruction(inst);
+    EncodeInstruction(inst.opcode(), inst.operands(), out_);
 }
 
 void BinaryWriter::WriteHeader(uint32_t bound) {
@@ -45,31 +42,4 @@ void BinaryWriter::WriteHeader(uint32_t bound) {
     out_.push_back(0);
 }
 
-void BinaryWriter::process_instruction(const Instruction& inst) {
-    out_.push_back(inst.word_length() << 16 | static_cast<uint32_t>(inst.opcode()));
-    for (const auto& op : inst.operands()) {
-        process_op(op);
-    }
-}
-
-void BinaryWriter::process_op(const Operand& op) {
-    if (auto* i = std::get_if<uint32_t>(&op)) {
-        out_.push_back(*i);
-        return;
-    }
-    if (auto* f = std::get_if<float>(&op)) {
-        // Allocate space for the float
-        out_.push_back(0);
-        uint8_t* ptr = reinterpret_cast<uint8_t*>(out_.data() + (out_.size() - 1));
-        memcpy(ptr, f, 4);
-        return;
-    }
-    if (auto* str = std::get_if<std::string>(&op)) {
-        auto idx = out_.size();
-        out_.resize(out_.size() + OperandLength(op), 0);
-        memcpy(out_.data() + idx, str->c_str(), str->size() + 1);
-        return;
-    }
-}
-
 }  // namespace tint::writer::spirv
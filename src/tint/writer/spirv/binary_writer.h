@@ -49,9 +49,6 @@ class BinaryWriter {
     std::vector<uint32_t>& result() { return out_; }
 
   private:
-    void process_instruction(const Instruction& inst);
-    void process_op(const Operand& op);
-
     std::vector<uint32_t> out_;
 };
 
@@ -16,8 +16,6 @@
 #define SRC_TINT_WRITER_SPIRV_BUILDER_H_
 
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "spirv/unified1/spirv.h"
@@ -38,6 +36,8 @@
 #include "src/tint/scope_stack.h"
 #include "src/tint/sem/builtin.h"
 #include "src/tint/type/storage_texture.h"
+#include "src/tint/utils/hashmap.h"
+#include "src/tint/utils/hashset.h"
 #include "src/tint/writer/spirv/function.h"
 #include "src/tint/writer/spirv/scalar_constant.h"
 
@@ -80,7 +80,13 @@ class Builder {
     /// @param program the program
     /// @param zero_initialize_workgroup_memory `true` to initialize all the
     /// variables in the Workgroup address space with OpConstantNull
-    explicit Builder(const Program* program, bool zero_initialize_workgroup_memory = false);
+    /// @param encode_words `true` to encode the instructions as SPIR-V words as they are
+    /// generated, instead of keeping them as Instruction lists. The section accessors, such as
+    /// types(), return empty lists in this mode, so it is only meant to be used when the builder
+    /// is written to a binary.
+    explicit Builder(const Program* program,
+                     bool zero_initialize_workgroup_memory = false,
+                     bool encode_words = false);
     ~Builder();
 
     /// Generates the SPIR-V instructions for the given program
@@ -107,76 +113,81 @@ class Builder {
 
     /// Iterates over all the instructions in the correct order and calls the
     /// given callback
+    /// @note the instructions encoded as words are not visited
     /// @param cb the callback to execute
     void iterate(std::function<void(const Instruction&)> cb) const;
 
+    /// Appends the SPIR-V words of all the instructions, in the correct order, to @p words
+    /// @param words the words to append the module to
+    void append_words(std::vector<uint32_t>& words) const;
+
     /// Adds an instruction to the list of capabilities, if the capability
     /// hasn't already been added.
     /// @param cap the capability to set
     void push_capability(uint32_t cap);
     /// @returns the capabilities
-    const InstructionList& capabilities() const { return capabilities_; }
+    const InstructionList& capabilities() const { return capabilities_.instructions(); }
     /// Adds an instruction to the extensions
     /// @param extension the name of the extension
     void push_extension(const char* extension);
     /// @returns the extensions
-    const InstructionList& extensions() const { return extensions_; }
+    const InstructionList& extensions() const { return extensions_.instructions(); }
     /// Adds an instruction to the ext import
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_ext_import(spv::Op op, const OperandList& operands) {
-        ext_imports_.push_back(Instruction{op, operands});
+        ext_imports_.push_back(op, operands);
     }
     /// @returns the ext imports
-    const InstructionList& ext_imports() const { return ext_imports_; }
+    const InstructionList& ext_imports() const { return ext_imports_.instructions(); }
     /// Adds an instruction to the memory model
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_memory_model(spv::Op op, const OperandList& operands) {
-        memory_model_.push_back(Instruction{op, operands});
+        memory_model_.push_back(op, operands);
     }
     /// @returns the memory model
-    const InstructionList& memory_model() const { return memory_model_; }
+    const InstructionList& memory_model() const { return memory_model_.instructions(); }
     /// Adds an instruction to the entry points
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_entry_point(spv::Op op, const OperandList& operands) {
-        entry_points_.push_back(Instruction{op, operands});
+        entry_points_.push_back(op, operands);
     }
     /// @returns the entry points
-    const InstructionList& entry_points() const { return entry_points_; }
+    const InstructionList& entry_points() const { return entry_points_.instructions(); }
     /// Adds an instruction to the execution modes
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_execution_mode(spv::Op op, const OperandList& operands) {
-        execution_modes_.push_back(Instruction{op, operands});
+        execution_modes_.push_back(op, operands);
     }
     /// @returns the execution modes
-    const InstructionList& execution_modes() const { return execution_modes_; }
+    const InstructionList& execution_modes() const { return execution_modes_.instructions(); }
     /// Adds an instruction to the debug
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_debug(spv::Op op, const OperandList& operands) {
-        debug_.push_back(Instruction{op, operands});
+        debug_.push_back(op, operands);
     }
     /// @returns the debug instructions
-    const InstructionList& debug() const { return debug_; }
+    const InstructionList& debug() const { return debug_.instructions(); }
     /// Adds an instruction to the types
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_type(spv::Op op, const OperandList& operands) {
-        types_.push_back(Instruction{op, operands});
+        types_.push_back(op, operands);
     }
     /// @returns the type instructions
-    const InstructionList& types() const { return types_; }
+    const InstructionList& types() const { return types_.instructions(); }
     /// Adds an instruction to the annotations
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_annot(spv::Op op, const OperandList& operands) {
-        annotations_.push_back(Instruction{op, operands});
+        annotations_.push_back(op, operands);
     }
     /// @returns the annotations
-    const InstructionList& annots() const { return annotations_; }
+    const InstructionList& annots() const { return annotations_.instructions(); }
 
     /// Adds a function to the builder
     /// @param func the function to add
@@ -593,15 +604,16 @@ class Builder {
     std::string error_;
     uint32_t next_id_ = 1;
     uint32_t current_label_id_ = 0;
-    InstructionList capabilities_;
-    InstructionList extensions_;
-    InstructionList ext_imports_;
-    InstructionList memory_model_;
-    InstructionList entry_points_;
-    InstructionList execution_modes_;
-    InstructionList debug_;
-    InstructionList types_;
-    InstructionList annotations_;
+    bool encode_words_ = false;
+    InstructionSection capabilities_;
+    InstructionSection extensions_;
+    InstructionSection ext_imports_;
+    InstructionSection memory_model_;
+    InstructionSection entry_points_;
+    InstructionSection execution_modes_;
+    InstructionSection debug_;
+    InstructionSection types_;
+    InstructionSection annotations_;
     std::vector<Function> functions_;
 
     // Scope holds per-block information
@@ -609,23 +621,23 @@ class Builder {
         Scope();
         Scope(const Scope&);
         ~Scope();
-        std::unordered_map<OperandListKey, uint32_t> type_init_to_id_;
+        utils::Hashmap<OperandListKey, uint32_t, 4> type_init_to_id_;
     };
 
-    std::unordered_map<const sem::Variable*, uint32_t> var_to_id_;
-    std::unordered_map<uint32_t, const sem::Variable*> id_to_var_;
-    std::unordered_map<std::string, uint32_t> import_name_to_id_;
-    std::unordered_map<Symbol, uint32_t> func_symbol_to_id_;
-    std::unordered_map<sem::CallTargetSignature, uint32_t> func_sig_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> type_to_id_;
-    std::unordered_map<ScalarConstant, uint32_t> const_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> const_null_to_id_;
-    std::unordered_map<uint64_t, uint32_t> const_splat_to_id_;
-    std::unordered_map<const type::Type*, uint32_t> texture_type_to_sampled_image_type_id_;
+    utils::Hashmap<const sem::Variable*, uint32_t, 16> var_to_id_;
+    utils::Hashmap<uint32_t, const sem::Variable*, 16> id_to_var_;
+    utils::Hashmap<std::string, uint32_t, 4> import_name_to_id_;
+    utils::Hashmap<Symbol, uint32_t, 8> func_symbol_to_id_;
+    utils::Hashmap<sem::CallTargetSignature, uint32_t, 8> func_sig_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 16> type_to_id_;
+    utils::Hashmap<ScalarConstant, uint32_t, 16> const_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 8> const_null_to_id_;
+    utils::Hashmap<uint64_t, uint32_t, 8> const_splat_to_id_;
+    utils::Hashmap<const type::Type*, uint32_t, 4> texture_type_to_sampled_image_type_id_;
     std::vector<Scope> scope_stack_;
     std::vector<uint32_t> merge_stack_;
     std::vector<uint32_t> continue_stack_;
-    std::unordered_set<uint32_t> capability_set_;
+    utils::Hashset<uint32_t, 8> capability_set_;
     bool zero_initialize_workgroup_memory_ = false;
 
     struct ContinuingInfo {
@@ -15,6 +15,8 @@
 #include "src/tint/writer/spirv/spv_dump.h"
 #include "src/tint/writer/spirv/test_helper.h"
 
+using namespace tint::number_suffixes;  // NOLINT
+
 namespace tint::writer::spirv {
 namespace {
 
@@ -66,5 +68,47 @@ TEST_F(BuilderTest, DeclareExtension) {
     EXPECT_EQ(DumpInstructions(b.extensions()), "OpExtension \"SPV_KHR_integer_dot_product\"\n");
 }
 
+TEST_F(BuilderTest, EncodeWords_MatchesInstructions) {
+    // struct Data {
+    //   d : f32;
+    // };
+    // @binding(0) @group(0) var<storage, read_write> data : Data;
+    //
+    // @compute @workgroup_size(1)
+    // fn main() {
+    //   var v : vec3<f32> = vec3<f32>(data.d);
+    //   if (v.x > 1.0) {
+    //     data.d = v.y;
+    //   }
+    // }
+    auto* s = Structure("Data", utils::Vector{Member("d", ty.f32())});
+    GlobalVar("data", ty.Of(s), builtin::AddressSpace::kStorage, builtin::Access::kReadWrite,
+              Binding(0_a), Group(0_a));
+    Func("main", utils::Empty, ty.void_(),
+         utils::Vector{
+             Decl(Var("v", ty.vec3<f32>(), vec3<f32>(MemberAccessor("data", "d")))),
+             If(GreaterThan(MemberAccessor("v", "x"), 1_f),
+                Block(Assign(MemberAccessor("data", "d"), MemberAccessor("v", "y")))),
+         },
+         utils::Vector{Stage(ast::PipelineStage::kCompute), WorkgroupSize(1_i)});
+
+    spirv::Builder& b = SanitizeAndBuild();
+    ASSERT_TRUE(b.Build()) << b.error();
+
+    spirv::Builder encoded(program.get(), /* zero_initialize_workgroup_memory */ false,
+                           /* encode_words */ true);
+    ASSERT_TRUE(encoded.Build()) << encoded.error();
+    EXPECT_TRUE(encoded.types().empty());
+    EXPECT_EQ(encoded.total_size(), b.total_size());
+
+    BinaryWriter expected;
+    expected.WriteHeader(b.id_bound());
+    expected.WriteBuilder(&b);
+    BinaryWriter got;
+    got.WriteHeader(encoded.id_bound());
+    got.WriteBuilder(&encoded);
+    EXPECT_EQ(got.result(), expected.result());
+}
+
 }  // namespace
 }  // namespace tint::writer::spirv
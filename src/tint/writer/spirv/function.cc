@@ -15,13 +15,24 @@
 #include "src/tint/writer/spirv/function.h"
 
 namespace tint::writer::spirv {
+namespace {
+
+// The number of words reserved for the body of a function that encodes words.
+constexpr uint32_t kReservedInstructionWords = 256;
+
+}  // namespace
 
 Function::Function() : declaration_(Instruction{spv::Op::OpNop, {}}), label_op_(Operand(0u)) {}
 
 Function::Function(const Instruction& declaration,
                    const Operand& label_op,
-                   const InstructionList& params)
-    : declaration_(declaration), label_op_(label_op), params_(params) {}
+                   const InstructionList& params,
+                   bool encode_words)
+    : declaration_(declaration),
+      label_op_(label_op),
+      params_(params),
+      vars_(encode_words),
+      instructions_(encode_words, kReservedInstructionWords) {}
 
 Function::Function(const Function& other) = default;
 
@@ -36,14 +47,25 @@ void Function::iterate(std::function<void(const Instruction&)> cb) const {
 
     cb(Instruction{spv::Op::OpLabel, {label_op_}});
 
-    for (const auto& var : vars_) {
+    for (const auto& var : vars_.instructions()) {
         cb(var);
     }
-    for (const auto& inst : instructions_) {
+    for (const auto& inst : instructions_.instructions()) {
         cb(inst);
     }
 
     cb(Instruction{spv::Op::OpFunctionEnd, {}});
 }
 
+void Function::append_words(std::vector<uint32_t>& words) const {
+    EncodeInstruction(declaration_.opcode(), declaration_.operands(), words);
+    for (const auto& param : params_) {
+        EncodeInstruction(param.opcode(), param.operands(), words);
+    }
+    EncodeInstruction(spv::Op::OpLabel, {label_op_}, words);
+    vars_.append_words(words);
+    instructions_.append_words(words);
+    EncodeInstruction(spv::Op::OpFunctionEnd, {}, words);
+}
+
 }  // namespace tint::writer::spirv
@@ -16,6 +16,7 @@
 #define SRC_TINT_WRITER_SPIRV_FUNCTION_H_
 
 #include <functional>
+#include <vector>
 
 #include "src/tint/writer/spirv/instruction.h"
 
@@ -32,18 +33,26 @@ class Function {
     /// @param declaration the function declaration
     /// @param label_op the operand for function's entry block label
     /// @param params the function parameters
+    /// @param encode_words `true` to encode the variables and instructions of the function as
+    /// SPIR-V words as they are pushed
     Function(const Instruction& declaration,
              const Operand& label_op,
-             const InstructionList& params);
+             const InstructionList& params,
+             bool encode_words = false);
     /// Copy constructor
     /// @param other the function to copy
     Function(const Function& other);
     ~Function();
 
     /// Iterates over the function call the cb on each instruction
+    /// @note the variables and instructions encoded as words are not visited
     /// @param cb the callback to call
     void iterate(std::function<void(const Instruction&)> cb) const;
 
+    /// Appends the SPIR-V words of the function to @p words
+    /// @param words the words to append the function to
+    void append_words(std::vector<uint32_t>& words) const;
+
     /// @returns the declaration
     const Instruction& declaration() const { return declaration_; }
 
@@ -54,33 +63,31 @@ class Function {
     /// @param op the op to set
     /// @param operands the operands for the instruction
     void push_inst(spv::Op op, const OperandList& operands) {
-        instructions_.push_back(Instruction{op, operands});
+        instructions_.push_back(op, operands);
     }
     /// @returns the instruction list
-    const InstructionList& instructions() const { return instructions_; }
+    const InstructionList& instructions() const { return instructions_.instructions(); }
+    /// @returns the op of the last instruction added with push_inst(), or OpNop if there is none
+    spv::Op last_inst_op() const { return instructions_.last_op(); }
 
     /// Adds a variable to the variable list
     /// @param operands the operands for the variable
     void push_var(const OperandList& operands) {
-        vars_.push_back(Instruction{spv::Op::OpVariable, operands});
+        vars_.push_back(spv::Op::OpVariable, operands);
     }
     /// @returns the variable list
-    const InstructionList& variables() const { return vars_; }
+    const InstructionList& variables() const { return vars_.instructions(); }
 
     /// @returns the word length of the function
     uint32_t word_length() const {
-        // 1 for the Label and 1 for the FunctionEnd
-        uint32_t size = 2 + declaration_.word_length();
+        // 2 for the Label and 1 for the FunctionEnd
+        uint32_t size = 3 + declaration_.word_length();
 
         for (const auto& param : params_) {
             size += param.word_length();
         }
-        for (const auto& var : vars_) {
-            size += var.word_length();
-        }
-        for (const auto& inst : instructions_) {
-            size += inst.word_length();
-        }
+        size += vars_.word_length();
+        size += instructions_.word_length();
         return size;
     }
 
@@ -88,8 +95,8 @@ class Function {
     Instruction declaration_;
     Operand label_op_;
     InstructionList params_;
-    InstructionList vars_;
-    InstructionList instructions_;
+    InstructionSection vars_;
+    InstructionSection instructions_;
 };
 
 }  // namespace tint::writer::spirv
@@ -15,6 +15,8 @@
 #include <string>
 
 #include "src/tint/bench/benchmark.h"
+#include "src/tint/writer/spirv/binary_writer.h"
+#include "src/tint/writer/spirv/generator_impl.h"
 
 namespace tint::writer::spirv {
 namespace {
@@ -26,15 +28,63 @@ void GenerateSPIRV(benchmark::State& state, std::string input_name) {
         return;
     }
     auto& program = std::get<bench::ProgramAndFile>(res).program;
+    size_t spirv_words = 0;
+    uint64_t allocations = 0;
     for (auto _ : state) {
+        bench::ScopedAllocationCounter allocation_counter;
         auto res = Generate(&program, {});
+        allocations += allocation_counter.Count();
         if (!res.error.empty()) {
             state.SkipWithError(res.error.c_str());
         }
+        spirv_words = res.spirv.size();
     }
+    bench::ReportOutput(state, spirv_words * sizeof(uint32_t), allocations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateSPIRV);
 
+/// Builds and writes the SPIR-V of an already sanitized program, with the instructions kept as
+/// Instruction lists or directly encoded as words.
+void BuildSPIRV(benchmark::State& state, std::string input_name, bool encode_words) {
+    auto res = bench::LoadProgram(input_name);
+    if (auto err = std::get_if<bench::Error>(&res)) {
+        state.SkipWithError(err->msg.c_str());
+        return;
+    }
+    auto sanitized = Sanitize(&std::get<bench::ProgramAndFile>(res).program, {});
+    if (!sanitized.program.IsValid()) {
+        state.SkipWithError(sanitized.program.Diagnostics().str().c_str());
+        return;
+    }
+    size_t spirv_words = 0;
+    uint64_t allocations = 0;
+    for (auto _ : state) {
+        bench::ScopedAllocationCounter allocation_counter;
+        Builder builder(&sanitized.program, /* zero_initialize_workgroup_memory */ false,
+                        encode_words);
+        if (!builder.Build()) {
+            state.SkipWithError(builder.error().c_str());
+        }
+        BinaryWriter writer;
+        writer.WriteHeader(builder.id_bound());
+        writer.WriteBuilder(&builder);
+        allocations += allocation_counter.Count();
+        spirv_words = writer.result().size();
+    }
+    bench::ReportOutput(state, spirv_words * sizeof(uint32_t), allocations);
+}
+
+void BuildSPIRVInstructions(benchmark::State& state, std::string input_name) {
+    BuildSPIRV(state, input_name, /* encode_words */ false);
+}
+
+void BuildSPIRVWords(benchmark::State& state, std::string input_name) {
+    BuildSPIRV(state, input_name, /* encode_words */ true);
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(BuildSPIRVInstructions);
+TINT_BENCHMARK_WGSL_PROGRAMS(BuildSPIRVWords);
+
 }  // namespace
 }  // namespace tint::writer::spirv
@@ -173,7 +173,7 @@ SanitizedResult Sanitize(const Program* in, const Options& options) {
 }
 
 GeneratorImpl::GeneratorImpl(const Program* program, bool zero_initialize_workgroup_memory)
-    : builder_(program, zero_initialize_workgroup_memory) {}
+    : builder_(program, zero_initialize_workgroup_memory, /* encode_words */ true) {}
 
 bool GeneratorImpl::Generate() {
     if (builder_.Build()) {
@@ -14,6 +14,8 @@
 
 #include "src/tint/writer/spirv/instruction.h"
 
+#include <cstring>
+#include <string>
 #include <utility>
 
 namespace tint::writer::spirv {
@@ -33,4 +35,72 @@ uint32_t Instruction::word_length() const {
     return size;
 }
 
+void EncodeInstruction(spv::Op op, const OperandList& operands, std::vector<uint32_t>& words) {
+    // The word count is only known once the operands are encoded, so the first word is patched
+    // at the end.
+    size_t start = words.size();
+    words.push_back(0);
+    for (const auto& operand : operands) {
+        if (auto* i = std::get_if<uint32_t>(&operand)) {
+            words.push_back(*i);
+        } else if (auto* f = std::get_if<float>(&operand)) {
+            uint32_t word;
+            memcpy(&word, f, sizeof(word));
+            words.push_back(word);
+        } else if (auto* str = std::get_if<std::string>(&operand)) {
+            size_t idx = words.size();
+            words.resize(idx + OperandLength(operand), 0);
+            memcpy(words.data() + idx, str->c_str(), str->size() + 1);
+        }
+    }
+    auto word_count = static_cast<uint32_t>(words.size() - start);
+    words[start] = word_count << 16 | static_cast<uint32_t>(op);
+}
+
+InstructionSection::InstructionSection(bool encode_words, uint32_t reserved_words)
+    : encode_words_(encode_words), reserved_words_(reserved_words) {}
+
+InstructionSection::InstructionSection(const InstructionSection&) = default;
+
+InstructionSection::InstructionSection(InstructionSection&&) = default;
+
+InstructionSection::~InstructionSection() = default;
+
+InstructionSection& InstructionSection::operator=(const InstructionSection&) = default;
+
+InstructionSection& InstructionSection::operator=(InstructionSection&&) = default;
+
+void InstructionSection::push_back(spv::Op op, const OperandList& operands) {
+    last_op_ = op;
+    if (!encode_words_) {
+        instructions_.push_back(Instruction{op, operands});
+        return;
+    }
+    if (words_.empty()) {
+        words_.reserve(reserved_words_);
+    }
+    EncodeInstruction(op, operands, words_);
+}
+
+uint32_t InstructionSection::word_length() const {
+    if (encode_words_) {
+        return static_cast<uint32_t>(words_.size());
+    }
+    uint32_t size = 0;
+    for (const auto& inst : instructions_) {
+        size += inst.word_length();
+    }
+    return size;
+}
+
+void InstructionSection::append_words(std::vector<uint32_t>& words) const {
+    if (encode_words_) {
+        words.insert(words.end(), words_.begin(), words_.end());
+        return;
+    }
+    for (const auto& inst : instructions_) {
+        EncodeInstruction(inst.opcode(), inst.operands(), words);
+    }
+}
+
 }  // namespace tint::writer::spirv
@@ -50,6 +50,69 @@ class Instruction {
 /// A list of instructions
 using InstructionList = std::vector<Instruction>;
 
+/// Encodes an instruction as SPIR-V words, appending them to @p words. String operands are
+/// encoded in place, nul-terminated and padded with zeros to a multiple of 4 bytes.
+/// @param op the instruction op
+/// @param operands the instruction operands
+/// @param words the words to append the instruction to
+void EncodeInstruction(spv::Op op, const OperandList& operands, std::vector<uint32_t>& words);
+
+/// A section of a SPIR-V module, or of a function body.
+/// By default the instructions of the section are kept as a list of Instruction, so that they
+/// can be inspected. When the section encodes words, the instructions are instead encoded into
+/// a single buffer of SPIR-V words as they are pushed, which avoids keeping an allocation per
+/// instruction and per string operand around until the module is written.
+class InstructionSection {
+  public:
+    /// Constructor
+    /// @param encode_words `true` to encode the instructions as SPIR-V words
+    /// @param reserved_words the number of words to reserve when the first instruction is
+    /// encoded
+    explicit InstructionSection(bool encode_words = false, uint32_t reserved_words = 0);
+    /// Copy constructor
+    InstructionSection(const InstructionSection&);
+    /// Move constructor
+    InstructionSection(InstructionSection&&);
+    ~InstructionSection();
+
+    /// Copy assignment operator
+    /// @returns this section
+    InstructionSection& operator=(const InstructionSection&);
+    /// Move assignment operator
+    /// @returns this section
+    InstructionSection& operator=(InstructionSection&&);
+
+    /// Adds an instruction to the section
+    /// @param op the op to set
+    /// @param operands the operands for the instruction
+    void push_back(spv::Op op, const OperandList& operands);
+
+    /// @returns true if no instruction was added to the section
+    bool empty() const { return instructions_.empty() && words_.empty(); }
+
+    /// @returns the op of the last instruction added to the section, or OpNop if the section is
+    /// empty
+    spv::Op last_op() const { return last_op_; }
+
+    /// @returns the instructions of the section. This is always empty when the section encodes
+    /// words.
+    const InstructionList& instructions() const { return instructions_; }
+
+    /// @returns the number of uint32_t's needed to hold the section
+    uint32_t word_length() const;
+
+    /// Appends the SPIR-V words of the section to @p words
+    /// @param words the words to append the section to
+    void append_words(std::vector<uint32_t>& words) const;
+
+  private:
+    bool encode_words_ = false;
+    uint32_t reserved_words_ = 0;
+    spv::Op last_op_ = spv::Op::OpNop;
+    InstructionList instructions_;
+    std::vector<uint32_t> words_;
+};
+
 }  // namespace tint::writer::spirv
 
 #endif  // SRC_TINT_WRITER_SPIRV_INSTRUCTION_H_
@@ -15,6 +15,7 @@
 #include "src/tint/writer/text_generator.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 #include "src/tint/utils/map.h"
@@ -39,13 +40,13 @@ std::string TextGenerator::StructName(const sem::Struct* s) {
     return name;
 }
 
-std::string TextGenerator::TrimSuffix(std::string str, const std::string& suffix) {
+std::string TextGenerator::TrimSuffix(std::string_view str, std::string_view suffix) {
     if (str.size() >= suffix.size()) {
         if (str.substr(str.size() - suffix.size(), suffix.size()) == suffix) {
-            return str.substr(0, str.size() - suffix.size());
+            return std::string(str.substr(0, str.size() - suffix.size()));
         }
     }
-    return str;
+    return std::string(str);
 }
 
 TextGenerator::LineWriter::LineWriter(TextBuffer* buf) : buffer(buf) {}
@@ -61,6 +62,29 @@ TextGenerator::LineWriter::~LineWriter() {
     }
 }
 
+TextGenerator::TextArena::TextArena() : block_(inline_block_), block_size_(kInlineSize) {}
+
+TextGenerator::TextArena::~TextArena() = default;
+
+std::string_view TextGenerator::TextArena::Add(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    if (text.size() > block_size_ - block_used_) {
+        // Grow the blocks geometrically, so that large outputs only need a few of them.
+        constexpr size_t kMaxBlockSize = 64 * 1024;
+        size_t size = std::max(text.size(), std::min(kMaxBlockSize, block_size_ * 2));
+        blocks_.emplace_back(std::make_unique<char[]>(size));
+        block_ = blocks_.back().get();
+        block_size_ = size;
+        block_used_ = 0;
+    }
+    char* out = block_ + block_used_;
+    memcpy(out, text.data(), text.size());
+    block_used_ += text.size();
+    return std::string_view(out, text.size());
+}
+
 TextGenerator::TextBuffer::TextBuffer() = default;
 TextGenerator::TextBuffer::~TextBuffer() = default;
 
@@ -72,11 +96,36 @@ void TextGenerator::TextBuffer::DecrementIndent() {
     current_indent = std::max(2u, current_indent) - 2u;
 }
 
-void TextGenerator::TextBuffer::Append(const std::string& line) {
-    lines.emplace_back(Line{current_indent, line});
+std::string_view TextGenerator::TextBuffer::AddToArena(std::string_view line) {
+    if (line.empty()) {
+        return {};
+    }
+    if (!arena_) {
+        arena_ = std::make_shared<TextArena>();
+    }
+    return arena_->Add(line);
+}
+
+void TextGenerator::TextBuffer::ShareArenas(const TextBuffer& tb) {
+    if (tb.arena_) {
+        ShareArena(tb.arena_);
+    }
+    for (auto& arena : tb.shared_arenas_) {
+        ShareArena(arena);
+    }
+}
+
+void TextGenerator::TextBuffer::ShareArena(const std::shared_ptr<const TextArena>& arena) {
+    if (arena != arena_ && shared_arena_set_.Add(arena.get())) {
+        shared_arenas_.push_back(arena);
+    }
 }
 
-void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, uint32_t indent) {
+void TextGenerator::TextBuffer::Append(std::string_view line) {
+    lines.emplace_back(Line{current_indent, AddToArena(line)});
+}
+
+void TextGenerator::TextBuffer::Insert(std::string_view line, size_t before, uint32_t indent) {
     if (TINT_UNLIKELY(before >= lines.size())) {
         diag::List d;
         TINT_ICE(Writer, d) << "TextBuffer::Insert() called with before >= lines.size()\n"
@@ -85,12 +134,13 @@ void TextGenerator::TextBuffer::Insert(const std::string& line, size_t before, u
         return;
     }
     using DT = decltype(lines)::difference_type;
-    lines.insert(lines.begin() + static_cast<DT>(before), Line{indent, line});
+    lines.insert(lines.begin() + static_cast<DT>(before), Line{indent, AddToArena(line)});
 }
 
 void TextGenerator::TextBuffer::Append(const TextBuffer& tb) {
+    ShareArenas(tb);
+    lines.reserve(lines.size() + tb.lines.size());
     for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
         lines.emplace_back(Line{current_indent + line.indent, line.content});
     }
 }
@@ -103,28 +153,35 @@ void TextGenerator::TextBuffer::Insert(const TextBuffer& tb, size_t before, uint
                             << "  lines.size(): " << lines.size();
         return;
     }
-    size_t idx = 0;
-    for (auto& line : tb.lines) {
-        // TODO(bclayton): inefficient, consider optimizing
-        using DT = decltype(lines)::difference_type;
-        lines.insert(lines.begin() + static_cast<DT>(before + idx),
-                     Line{indent + line.indent, line.content});
-        idx++;
+    ShareArenas(tb);
+    // Shift the lines after the insertion point only once, for all the inserted lines.
+    using DT = decltype(lines)::difference_type;
+    auto first = lines.insert(lines.begin() + static_cast<DT>(before), tb.lines.begin(),
+                              tb.lines.end());
+    for (auto it = first; it != first + static_cast<DT>(tb.lines.size()); ++it) {
+        it->indent += indent;
     }
 }
 
 std::string TextGenerator::TextBuffer::String(uint32_t indent /* = 0 */) const {
-    utils::StringStream ss;
+    size_t size = 0;
     for (auto& line : lines) {
         if (!line.content.empty()) {
-            for (uint32_t i = 0; i < indent + line.indent; i++) {
-                ss << " ";
-            }
-            ss << line.content;
+            size += indent + line.indent + line.content.size();
         }
-        ss << std::endl;
+        size++;
     }
-    return ss.str();
+
+    std::string str;
+    str.reserve(size);
+    for (auto& line : lines) {
+        if (!line.content.empty()) {
+            str.append(indent + line.indent, ' ');
+            str.append(line.content);
+        }
+        str.push_back('\n');
+    }
+    return str;
 }
 
 TextGenerator::ScopedParen::ScopedParen(utils::StringStream& stream) : s(stream) {
@@ -15,13 +15,16 @@
 #ifndef SRC_TINT_WRITER_TEXT_GENERATOR_H_
 #define SRC_TINT_WRITER_TEXT_GENERATOR_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "src/tint/diagnostic/diagnostic.h"
 #include "src/tint/program_builder.h"
+#include "src/tint/utils/hashset.h"
 #include "src/tint/utils/string_stream.h"
 
 namespace tint::writer {
@@ -33,11 +36,49 @@ class TextGenerator {
     struct Line {
         /// The indentation of the line in blankspace
         uint32_t indent = 0;
-        /// The content of the line, without a trailing newline character
-        std::string content;
+        /// The content of the line, without a trailing newline character. The characters are
+        /// held by the TextArena of the TextBuffer that the line was first written to.
+        std::string_view content;
+    };
+
+    /// TextArena holds the characters of the lines written to a TextBuffer in a few large blocks,
+    /// so that each line does not need its own allocation. Characters added to the arena never
+    /// move, so lines can keep pointing to them for as long as the arena is alive.
+    class TextArena {
+      public:
+        /// Constructor
+        TextArena();
+        /// Destructor
+        ~TextArena();
+
+        /// Copies `text` into the arena
+        /// @param text the text to copy
+        /// @returns a view of the copy of `text` held by the arena
+        std::string_view Add(std::string_view text);
+
+      private:
+        TextArena(const TextArena&) = delete;
+        TextArena& operator=(const TextArena&) = delete;
+
+        /// The number of characters held inline, which is enough for most nested buffers
+        static constexpr size_t kInlineSize = 256;
+
+        /// The heap allocated blocks
+        std::vector<std::unique_ptr<char[]>> blocks_;
+        /// The block new text is added to
+        char* block_;
+        /// The size of `block_`
+        size_t block_size_;
+        /// The number of characters used in `block_`
+        size_t block_used_ = 0;
+        /// The characters held inline, used until the first heap allocated block
+        char inline_block_[kInlineSize];
     };
 
     /// TextBuffer holds a list of lines of text.
+    /// The characters of the lines are held by TextArenas that are shared between the buffers
+    /// that have lines pointing to them. This makes appending or inserting the lines of another
+    /// buffer a copy of the line views only, and not of their characters.
     struct TextBuffer {
         // Constructor
         TextBuffer();
@@ -55,13 +96,13 @@ class TextGenerator {
 
         /// Appends the line to the end of the TextBuffer
         /// @param line the line to append to the TextBuffer
-        void Append(const std::string& line);
+        void Append(std::string_view line);
 
         /// Inserts the line to the TextBuffer before the line with index `before`
         /// @param line the line to append to the TextBuffer
         /// @param before the zero-based index of the line to insert the text before
         /// @param indent the indentation to apply to the inserted lines
-        void Insert(const std::string& line, size_t before, uint32_t indent);
+        void Insert(std::string_view line, size_t before, uint32_t indent);
 
         /// Appends the lines of `tb` to the end of this TextBuffer
         /// @param tb the TextBuffer to append to the end of this TextBuffer
@@ -84,6 +125,27 @@ class TextGenerator {
 
         /// The lines
         std::vector<Line> lines;
+
+      private:
+        /// Copies `line` into the arena of this buffer
+        /// @param line the line to copy
+        /// @returns a view of the copy of the line
+        std::string_view AddToArena(std::string_view line);
+
+        /// Keeps the arenas holding the lines of `tb` alive for as long as this buffer
+        /// @param tb the TextBuffer whose lines are appended or inserted into this buffer
+        void ShareArenas(const TextBuffer& tb);
+
+        /// Keeps `arena` alive for as long as this buffer
+        /// @param arena the arena to share
+        void ShareArena(const std::shared_ptr<const TextArena>& arena);
+
+        /// The arena holding the lines written to this buffer, created on the first line
+        std::shared_ptr<TextArena> arena_;
+        /// The arenas of the buffers that lines were appended or inserted from
+        std::vector<std::shared_ptr<const TextArena>> shared_arenas_;
+        /// The arenas in `shared_arenas_`, to add each of them only once
+        utils::Hashset<const TextArena*, 4> shared_arena_set_;
     };
 
     /// Constructor
@@ -121,7 +183,7 @@ class TextGenerator {
     /// @param suffix the suffix to remove
     /// @return returns str without the provided trailing suffix string. If str
     /// doesn't end with suffix, str is returned unchanged.
-    std::string TrimSuffix(std::string str, const std::string& suffix);
+    std::string TrimSuffix(std::string_view str, std::string_view suffix);
 
   protected:
     /// LineWriter is a helper that acts as a string buffer, who's content is
@@ -42,5 +42,51 @@ TEST(TextGeneratorTest, UniqueIdentifier_ConflictWithExisting) {
     ASSERT_EQ(gen.UniqueIdentifier("ident"), "ident_5");
 }
 
+TEST(TextGeneratorTest, TextBuffer_AppendAndInsertLines) {
+    TextGenerator::TextBuffer buf;
+    buf.Append("a");
+    buf.IncrementIndent();
+    buf.Append(std::string("b"));
+    buf.Append("");
+    buf.DecrementIndent();
+    buf.Insert("c", 1, 4);
+
+    ASSERT_EQ(buf.lines.size(), 4u);
+    EXPECT_EQ(buf.lines[1].content, "c");
+    EXPECT_EQ(buf.String(), "a\n    c\n  b\n\n");
+    EXPECT_EQ(buf.String(1), " a\n     c\n   b\n\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_OutlivesAppendedBuffers) {
+    TextGenerator::TextBuffer buf;
+    buf.Append("first");
+    buf.Append("last");
+    {
+        TextGenerator::TextBuffer nested;
+        nested.Append("nested 1");
+        {
+            // Enough lines to not fit in the first block of the arena.
+            TextGenerator::TextBuffer inner;
+            inner.IncrementIndent();
+            for (int i = 0; i < 100; i++) {
+                inner.Append("inner " + std::to_string(i));
+            }
+            nested.Append(inner);
+        }
+        nested.Append("nested 2");
+        buf.Insert(nested, 1, 2);
+        buf.Append(nested);
+    }
+
+    std::string inserted;
+    std::string appended;
+    for (int i = 0; i < 100; i++) {
+        inserted += "    inner " + std::to_string(i) + "\n";
+        appended += "  inner " + std::to_string(i) + "\n";
+    }
+    EXPECT_EQ(buf.String(), "first\n  nested 1\n" + inserted + "  nested 2\nlast\nnested 1\n" +
+                                appended + "nested 2\n");
+}
+
 }  // namespace
 }  // namespace tint::writer
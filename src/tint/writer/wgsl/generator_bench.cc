@@ -26,12 +26,18 @@ void GenerateWGSL(benchmark::State& state, std::string input_name) {
         return;
     }
     auto& program = std::get<bench::ProgramAndFile>(res).program;
+    size_t output_size = 0;
+    uint64_t allocations = 0;
     for (auto _ : state) {
+        bench::ScopedAllocationCounter allocation_counter;
         auto res = Generate(&program, {});
+        allocations += allocation_counter.Count();
         if (!res.error.empty()) {
             state.SkipWithError(res.error.c_str());
         }
+        output_size = res.wgsl.size();
     }
+    bench::ReportOutput(state, output_size, allocations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateWGSL);